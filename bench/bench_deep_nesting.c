@@ -7,6 +7,7 @@
 #include "tinyxml_stub.h"
 
 static unsigned char tag_cb(char* t){ return SXMLExplorerContinue; }
+static unsigned char skip_tag_cb(char* t){ return strcmp(t, "child") == 0 ? SXMLExplorerSkip : SXMLExplorerContinue; }
 static unsigned char content_cb(char* c){ return SXMLExplorerContinue; }
 static unsigned char key_cb(char* k){ return SXMLExplorerContinue; }
 static unsigned char val_cb(char* v){ return SXMLExplorerContinue; }
@@ -24,11 +25,12 @@ static void build_xml(char** out, int depth){
     *out = buf;
 }
 
-static size_t mem_usage_sparsexml(char* xml, double* t){
+static size_t mem_usage_sparsexml(char* xml, double* t, unsigned char path, unsigned char skip){
     struct mallinfo2 mi_before = mallinfo2();
     clock_t t_start = clock();
     SXMLExplorer *ex = sxml_make_explorer();
-    sxml_register_func(ex, tag_cb, content_cb, key_cb, val_cb);
+    sxml_register_func(ex, skip ? skip_tag_cb : tag_cb, content_cb, key_cb, val_cb);
+    sxml_enable_element_path(ex, path);
     sxml_run_explorer(ex, xml);
     clock_t t_end = clock();
     struct mallinfo2 mi_after = mallinfo2();
@@ -77,12 +79,20 @@ int main(int argc,char **argv)
     if(argc>1) depth = atoi(argv[1]);
     char* xml = NULL;
     build_xml(&xml, depth);
-    double s_time = 0.0, e_time = 0.0, t_time = 0.0;
-    size_t sxml = mem_usage_sparsexml(xml, &s_time);
+    double s_time = 0.0, p_time = 0.0, k_time = 0.0, e_time = 0.0, t_time = 0.0;
+    size_t sxml = mem_usage_sparsexml(xml, &s_time, 0, 0);
+    // Same run with the element stack and joined path maintained
+    size_t path = mem_usage_sparsexml(xml, &p_time, 1, 0);
+    // The outermost <child> answers Skip: the rest is one depth-counted scan
+    size_t skip = mem_usage_sparsexml(xml, &k_time, 0, 1);
     size_t expat = mem_usage_expat(xml, &e_time);
     size_t tiny = mem_usage_tinyxml(xml, &t_time);
     printf("%-12s | %8d | %18zu | %14zu | %14zu | %16.6f | %16.6f | %16.6f\n",
            "deep_nesting", depth, sxml, expat, tiny, s_time, e_time, t_time);
+    printf("%-12s | %8d | %18zu | %14zu | %14zu | %16.6f | %16.6f | %16.6f\n",
+           "deep_path", depth, path, expat, tiny, p_time, e_time, t_time);
+    printf("%-12s | %8d | %18zu | %14zu | %14zu | %16.6f | %16.6f | %16.6f\n",
+           "deep_skip", depth, skip, expat, tiny, k_time, e_time, t_time);
     free(xml);
     return 0;
 }
@@ -10,6 +10,7 @@ static unsigned char tag_cb(char* t){ return SXMLExplorerContinue; }
 static unsigned char content_cb(char* c){ return SXMLExplorerContinue; }
 static unsigned char key_cb(char* k){ return SXMLExplorerContinue; }
 static unsigned char val_cb(char* v){ return SXMLExplorerContinue; }
+static unsigned char start_cb(void* u, char* name, unsigned int len, SXMLAttribute* attrs, unsigned int count){ return SXMLExplorerContinue; }
 
 static void build_xml(char** out, int count){
     size_t size = strlen("<root />") + count * 16 + 1;
@@ -24,11 +25,25 @@ static void build_xml(char** out, int count){
     *out = buf;
 }
 
-static size_t mem_usage_sparsexml(char* xml, double* t){
+#define ATTRS_EAGER 0
+#define ATTRS_BATCHED 1
+#define ATTRS_LAZY 2
+
+static size_t mem_usage_sparsexml(char* xml, double* t, unsigned char mode){
     struct mallinfo2 mi_before = mallinfo2();
     clock_t t_start = clock();
     SXMLExplorer *ex = sxml_make_explorer();
-    sxml_register_func(ex, tag_cb, content_cb, key_cb, val_cb);
+    if(mode == ATTRS_BATCHED){
+        // One call per start tag instead of two per attribute
+        sxml_register_func(ex, NULL, content_cb, NULL, NULL);
+        sxml_register_start_element_func(ex, start_cb, NULL);
+    } else if(mode == ATTRS_LAZY){
+        // Attributes are never tokenized unless the tag callback asks
+        sxml_register_func(ex, tag_cb, content_cb, key_cb, val_cb);
+        sxml_enable_lazy_attributes(ex, 1);
+    } else {
+        sxml_register_func(ex, tag_cb, content_cb, key_cb, val_cb);
+    }
     sxml_run_explorer(ex, xml);
     clock_t t_end = clock();
     struct mallinfo2 mi_after = mallinfo2();
@@ -77,12 +92,18 @@ int main(int argc,char **argv)
     if(argc>1) count = atoi(argv[1]);
     char* xml = NULL;
     build_xml(&xml, count);
-    double s_time = 0.0, e_time = 0.0, t_time = 0.0;
-    size_t sxml = mem_usage_sparsexml(xml, &s_time);
+    double s_time = 0.0, b_time = 0.0, l_time = 0.0, e_time = 0.0, t_time = 0.0;
+    size_t sxml = mem_usage_sparsexml(xml, &s_time, ATTRS_EAGER);
+    size_t batched = mem_usage_sparsexml(xml, &b_time, ATTRS_BATCHED);
+    size_t lazy = mem_usage_sparsexml(xml, &l_time, ATTRS_LAZY);
     size_t expat = mem_usage_expat(xml, &e_time);
     size_t tiny = mem_usage_tinyxml(xml, &t_time);
     printf("%-12s | %8d | %18zu | %14zu | %14zu | %16.6f | %16.6f | %16.6f\n",
            "many_attrs", count, sxml, expat, tiny, s_time, e_time, t_time);
+    printf("%-12s | %8d | %18zu | %14zu | %14zu | %16.6f | %16.6f | %16.6f\n",
+           "attrs_batch", count, batched, expat, tiny, b_time, e_time, t_time);
+    printf("%-12s | %8d | %18zu | %14zu | %14zu | %16.6f | %16.6f | %16.6f\n",
+           "attrs_lazy", count, lazy, expat, tiny, l_time, e_time, t_time);
     free(xml);
     return 0;
 }
@@ -74,12 +74,20 @@ static void expat_char_mixed(void *userData, const char *s, int len){
     (void)userData; (void)s; (void)len;
 }
 
-void bench_sparsexml_mixed(int iterations, size_t *avg_mem, size_t *max_mem){
+void bench_sparsexml_mixed(int iterations, size_t *avg_mem, size_t *max_mem, unsigned char tag_scan, unsigned char blank_skip){
     size_t total = 0;
     size_t maximum = 0;
     for(int i=0; i<iterations; i++){
         SXMLExplorer* ex = sxml_make_explorer();
-        sxml_register_func(ex, dummy_tag_cb, dummy_content_cb, dummy_attr_key_cb, dummy_attr_value_cb);
+        if(tag_scan){
+            // Structure only: content is skipped, not buffered
+            sxml_register_func(ex, dummy_tag_cb, NULL, dummy_attr_key_cb, dummy_attr_value_cb);
+            sxml_enable_tag_scan(ex, 1);
+        } else {
+            sxml_register_func(ex, dummy_tag_cb, dummy_content_cb, dummy_attr_key_cb, dummy_attr_value_cb);
+            // Indentation runs dropped before the content callback
+            sxml_enable_whitespace_skip(ex, blank_skip);
+        }
         size_t used = malloc_usable_size(ex);
         if(used > maximum) maximum = used;
         total += used;
@@ -131,10 +139,22 @@ int bench_mixed_main(int argc, char **argv){
     clock_t start, end;
     size_t sparse_avg = 0, sparse_max = 0;
     start = clock();
-    bench_sparsexml_mixed(iter, &sparse_avg, &sparse_max);
+    bench_sparsexml_mixed(iter, &sparse_avg, &sparse_max, 0, 0);
     end = clock();
     double sparse_time = (double)(end - start) / CLOCKS_PER_SEC;
 
+    size_t scan_avg = 0, scan_max = 0;
+    start = clock();
+    bench_sparsexml_mixed(iter, &scan_avg, &scan_max, 1, 0);
+    end = clock();
+    double scan_time = (double)(end - start) / CLOCKS_PER_SEC;
+
+    size_t blank_avg = 0, blank_max = 0;
+    start = clock();
+    bench_sparsexml_mixed(iter, &blank_avg, &blank_max, 0, 1);
+    end = clock();
+    double blank_time = (double)(end - start) / CLOCKS_PER_SEC;
+
     size_t expat_avg = 0, expat_max = 0;
     start = clock();
     bench_expat_mixed(iter, &expat_avg, &expat_max);
@@ -150,5 +170,11 @@ int bench_mixed_main(int argc, char **argv){
     printf("%-12s | %8d | %18zu | %14zu | %14zu | %16.6f | %16.6f | %16.6f\n",
            "mixed", iter, sparse_avg, expat_avg, tiny_avg,
            sparse_time, expat_time, tiny_time);
+    printf("%-12s | %8d | %18zu | %14zu | %14zu | %16.6f | %16.6f | %16.6f\n",
+           "mixed_tags", iter, scan_avg, expat_avg, tiny_avg,
+           scan_time, expat_time, tiny_time);
+    printf("%-12s | %8d | %18zu | %14zu | %14zu | %16.6f | %16.6f | %16.6f\n",
+           "mixed_blank", iter, blank_avg, expat_avg, tiny_avg,
+           blank_time, expat_time, tiny_time);
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,321 @@
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "sparsexml-aggregate.h"
+
+#define SXMLAggregateNoField 0xFF
+#define SXMLAggregateInitialGroups 64
+
+typedef struct {
+  SXMLSpan keys[SXMLAggregateKeys];
+  SXMLSpan present[SXMLAggregateValues];  // Count paths, bound as text
+  double values[SXMLAggregateValues];
+} SXMLAggregateRecord;
+
+typedef struct {
+  unsigned int hash;
+  unsigned int key;            // Offset into the pool: the key parts, each NUL-terminated
+} SXMLAggregateGroup;
+
+struct __SXMLAggregation {
+  SXMLBinding* binding;
+  SXMLAggregateRecord record;
+  unsigned int field_count;
+
+  unsigned int key_count;
+  unsigned char ops[SXMLAggregateValues];
+  unsigned char value_field[SXMLAggregateValues]; // Binding field index or SXMLAggregateNoField
+  unsigned int value_count;
+
+  SXMLAggregateGroup* groups;  // In order of first appearance
+  double* cells;               // value_count accumulators per group
+  unsigned int group_count;
+  unsigned int group_capacity;
+  unsigned int* slots;         // Group index + 1, 0 marks an empty slot
+  unsigned int slot_mask;
+  char* pool;
+  unsigned int pool_used;
+  unsigned int pool_capacity;
+};
+
+// =============================================================================
+// GROUP TABLE
+// =============================================================================
+
+static const char* priv_sxml_aggregate_part(const SXMLSpan* span, unsigned int* len) {
+  *len = span->text != NULL ? span->len : 0;
+  return span->text != NULL ? span->text : "";
+}
+
+// FNV-1a over the parts, each followed by a NUL as in the pool
+static unsigned int priv_sxml_aggregate_hash(const SXMLSpan* keys, unsigned int count) {
+  unsigned int hash = 2166136261u, i, j, len;
+
+  for (i = 0; i < count; i++) {
+    const char* part = priv_sxml_aggregate_part(&keys[i], &len);
+    for (j = 0; j < len; j++) {
+      hash = (hash ^ (unsigned char)part[j]) * 16777619u;
+    }
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+static unsigned char priv_sxml_aggregate_equal(SXMLAggregation* aggregation, const SXMLAggregateGroup* group, const SXMLSpan* keys) {
+  const char* stored = aggregation->pool + group->key;
+  unsigned int i, len;
+
+  for (i = 0; i < aggregation->key_count; i++) {
+    const char* part = priv_sxml_aggregate_part(&keys[i], &len);
+    if (memcmp(stored, part, len) != 0 || stored[len] != '\0') {
+      return 0;
+    }
+    stored += len + 1;
+  }
+  return 1;
+}
+
+// Doubles the groups, their cells and the slot index
+static unsigned char priv_sxml_aggregate_grow(SXMLAggregation* aggregation) {
+  unsigned int capacity = aggregation->group_capacity > 0 ? aggregation->group_capacity * 2 : SXMLAggregateInitialGroups;
+  unsigned int slot_count = capacity * 2, i;
+  SXMLAggregateGroup* groups;
+  double* cells;
+  unsigned int* slots;
+
+  groups = realloc(aggregation->groups, capacity * sizeof(SXMLAggregateGroup));
+  if (groups == NULL) {
+    return 0;
+  }
+  aggregation->groups = groups;
+  cells = realloc(aggregation->cells, (size_t)capacity * (aggregation->value_count > 0 ? aggregation->value_count : 1) * sizeof(double));
+  if (cells == NULL) {
+    return 0;
+  }
+  aggregation->cells = cells;
+  slots = calloc(slot_count, sizeof(unsigned int));
+  if (slots == NULL) {
+    return 0;
+  }
+  free(aggregation->slots);
+  aggregation->slots = slots;
+  aggregation->slot_mask = slot_count - 1;
+  aggregation->group_capacity = capacity;
+
+  for (i = 0; i < aggregation->group_count; i++) {
+    unsigned int slot = groups[i].hash & aggregation->slot_mask;
+    while (slots[slot] != 0) {
+      slot = (slot + 1) & aggregation->slot_mask;
+    }
+    slots[slot] = i + 1;
+  }
+  return 1;
+}
+
+static unsigned char priv_sxml_aggregate_store_key(SXMLAggregation* aggregation, const SXMLSpan* keys, SXMLAggregateGroup* group) {
+  unsigned int need = 0, i, len;
+
+  for (i = 0; i < aggregation->key_count; i++) {
+    priv_sxml_aggregate_part(&keys[i], &len);
+    need += len + 1;
+  }
+  if (aggregation->pool_used + need > aggregation->pool_capacity) {
+    unsigned int capacity = aggregation->pool_capacity > 0 ? aggregation->pool_capacity : SXMLBindArenaLength;
+    char* pool;
+    while (aggregation->pool_used + need > capacity) {
+      capacity *= 2;
+    }
+    pool = realloc(aggregation->pool, capacity);
+    if (pool == NULL) {
+      return 0;
+    }
+    aggregation->pool = pool;
+    aggregation->pool_capacity = capacity;
+  }
+
+  group->key = aggregation->pool_used;
+  for (i = 0; i < aggregation->key_count; i++) {
+    const char* part = priv_sxml_aggregate_part(&keys[i], &len);
+    memcpy(aggregation->pool + aggregation->pool_used, part, len);
+    aggregation->pool[aggregation->pool_used + len] = '\0';
+    aggregation->pool_used += len + 1;
+  }
+  return 1;
+}
+
+// Returns the accumulators of the record's group, adding the group on first
+// sight, or NULL when memory runs out
+static double* priv_sxml_aggregate_find(SXMLAggregation* aggregation, const SXMLSpan* keys) {
+  unsigned int hash = priv_sxml_aggregate_hash(keys, aggregation->key_count);
+  unsigned int slot, i;
+  SXMLAggregateGroup* group;
+  double* cells;
+
+  if (aggregation->group_capacity > 0) {
+    for (slot = hash & aggregation->slot_mask; aggregation->slots[slot] != 0; slot = (slot + 1) & aggregation->slot_mask) {
+      group = &aggregation->groups[aggregation->slots[slot] - 1];
+      if (group->hash == hash && priv_sxml_aggregate_equal(aggregation, group, keys)) {
+        return aggregation->cells + (size_t)(aggregation->slots[slot] - 1) * aggregation->value_count;
+      }
+    }
+  }
+  if (aggregation->group_count == aggregation->group_capacity && !priv_sxml_aggregate_grow(aggregation)) {
+    return NULL;
+  }
+
+  group = &aggregation->groups[aggregation->group_count];
+  group->hash = hash;
+  if (!priv_sxml_aggregate_store_key(aggregation, keys, group)) {
+    return NULL;
+  }
+  slot = hash & aggregation->slot_mask;
+  while (aggregation->slots[slot] != 0) {
+    slot = (slot + 1) & aggregation->slot_mask;
+  }
+  aggregation->slots[slot] = ++aggregation->group_count;
+
+  cells = aggregation->cells + (size_t)(aggregation->group_count - 1) * aggregation->value_count;
+  for (i = 0; i < aggregation->value_count; i++) {
+    cells[i] = aggregation->ops[i] == SXMLAggregateMin || aggregation->ops[i] == SXMLAggregateMax ? NAN : 0;
+  }
+  return cells;
+}
+
+// =============================================================================
+// RECORDS
+// =============================================================================
+
+static unsigned char priv_sxml_aggregate_record(void* user, void* record, unsigned long fields) {
+  SXMLAggregation* aggregation = user;
+  SXMLAggregateRecord* values = record;
+  double* cells;
+  unsigned int i;
+
+  cells = priv_sxml_aggregate_find(aggregation, values->keys);
+  if (cells == NULL) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  for (i = 0; i < aggregation->value_count; i++) {
+    unsigned int field = aggregation->value_field[i];
+    double value = values->values[i];
+
+    if (aggregation->ops[i] == SXMLAggregateCount) {
+      if (field == SXMLAggregateNoField || (fields & (1ul << field))) {
+        cells[i] += 1;
+      }
+      continue;
+    }
+    if (!(fields & (1ul << field)) || isnan(value)) {
+      continue;
+    }
+    switch (aggregation->ops[i]) {
+      case SXMLAggregateSum:
+        cells[i] += value;
+        break;
+      case SXMLAggregateMin:
+        cells[i] = isnan(cells[i]) || value < cells[i] ? value : cells[i];
+        break;
+      case SXMLAggregateMax:
+        cells[i] = isnan(cells[i]) || value > cells[i] ? value : cells[i];
+        break;
+    }
+  }
+  return SXMLExplorerContinue;
+}
+
+// =============================================================================
+// AGGREGATION
+// =============================================================================
+
+SXMLAggregation* sxml_make_aggregation(SXMLExplorer* explorer, const char* record) {
+  SXMLAggregation* aggregation = calloc(1, sizeof(SXMLAggregation));
+
+  if (aggregation == NULL) {
+    return NULL;
+  }
+  aggregation->binding = sxml_make_binding(explorer, record, &aggregation->record, sizeof(aggregation->record));
+  if (aggregation->binding == NULL) {
+    free(aggregation);
+    return NULL;
+  }
+  sxml_binding_register_record_func(aggregation->binding, priv_sxml_aggregate_record, aggregation);
+  return aggregation;
+}
+
+void sxml_destroy_aggregation(SXMLAggregation* aggregation) {
+  sxml_destroy_binding(aggregation->binding);
+  free(aggregation->groups);
+  free(aggregation->cells);
+  free(aggregation->slots);
+  free(aggregation->pool);
+  free(aggregation);
+}
+
+unsigned char sxml_aggregate_group(SXMLAggregation* aggregation, const char* path) {
+  unsigned char ret;
+
+  if (aggregation->key_count >= SXMLAggregateKeys || aggregation->group_count > 0) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  ret = sxml_bind_field(aggregation->binding, path, SXMLBindText,
+                        offsetof(SXMLAggregateRecord, keys) + aggregation->key_count * sizeof(SXMLSpan));
+  if (ret != SXMLExplorerContinue) {
+    return ret;
+  }
+  aggregation->key_count++;
+  aggregation->field_count++;
+  return SXMLExplorerContinue;
+}
+
+unsigned char sxml_aggregate(SXMLAggregation* aggregation, unsigned char op, const char* path) {
+  unsigned int i = aggregation->value_count;
+  unsigned char ret;
+
+  if (op > SXMLAggregateMax || (path == NULL && op != SXMLAggregateCount)) {
+    return SXMLExplorerErrorMalformedXML;
+  }
+  if (i >= SXMLAggregateValues || aggregation->group_count > 0) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  aggregation->value_field[i] = SXMLAggregateNoField;
+  if (path != NULL) {
+    ret = op == SXMLAggregateCount ?
+      sxml_bind_field(aggregation->binding, path, SXMLBindText, offsetof(SXMLAggregateRecord, present) + i * sizeof(SXMLSpan)) :
+      sxml_bind_field(aggregation->binding, path, SXMLBindDouble, offsetof(SXMLAggregateRecord, values) + i * sizeof(double));
+    if (ret != SXMLExplorerContinue) {
+      return ret;
+    }
+    aggregation->value_field[i] = aggregation->field_count++;
+  }
+  aggregation->ops[i] = op;
+  aggregation->value_count++;
+  return SXMLExplorerContinue;
+}
+
+unsigned int sxml_aggregation_groups(SXMLAggregation* aggregation) {
+  return aggregation->group_count;
+}
+
+unsigned char sxml_aggregation_emit(SXMLAggregation* aggregation, void* func, void* user) {
+  unsigned char (*result_func)(void *, const SXMLSpan *, unsigned int, const double *, unsigned int) = func;
+  SXMLSpan keys[SXMLAggregateKeys];
+  unsigned int group, i;
+
+  for (group = 0; group < aggregation->group_count; group++) {
+    const char* part = aggregation->pool + aggregation->groups[group].key;
+    unsigned char ret;
+    for (i = 0; i < aggregation->key_count; i++) {
+      keys[i].text = part;
+      keys[i].len = strlen(part);
+      part += keys[i].len + 1;
+    }
+    ret = result_func(user, keys, aggregation->key_count,
+                      aggregation->cells + (size_t)group * aggregation->value_count, aggregation->value_count);
+    if (ret != SXMLExplorerContinue) {
+      return ret;
+    }
+  }
+  return SXMLExplorerContinue;
+}
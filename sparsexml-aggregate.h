@@ -0,0 +1,56 @@
+#ifndef __SXMLAggregate__
+#define __SXMLAggregate__
+
+#include "sparsexml.h"
+#include "sparsexml-bind.h"
+
+/*
+ * Streaming aggregation: grouping and value paths relative to a record
+ * element, folded into per-group accumulators in one pass.
+ *
+ *   SXMLAggregation* a = sxml_make_aggregation(ex, "/library/books/book");
+ *   sxml_aggregate_group(a, "@category");
+ *   sxml_aggregate(a, SXMLAggregateCount, NULL);
+ *   sxml_aggregate(a, SXMLAggregateSum, "price");
+ *   sxml_run_explorer(ex, xml);
+ *   sxml_aggregation_emit(a, print_group, stdout);
+ *
+ * Paths are bound like record fields (see sparsexml-bind.h): each record
+ * contributes the first value of every path, and a record's key is the
+ * first value of each grouping path ("" when absent). Groups live in an
+ * open-addressed table with their keys in one pool and their accumulators
+ * in one array, all grown on demand, so memory follows the number of
+ * distinct keys and not the size of the input.
+ */
+
+#define SXMLAggregateKeys 4
+#define SXMLAggregateValues 16
+
+#define SXMLAggregateCount 0x00  // Records with the path present, every record without a path
+#define SXMLAggregateSum 0x01    // Sum of the numeric values
+#define SXMLAggregateMin 0x02    // Smallest numeric value, NaN when there was none
+#define SXMLAggregateMax 0x03    // Largest numeric value, NaN when there was none
+
+typedef struct __SXMLAggregation SXMLAggregation;
+
+// record is the absolute path of the record element (any binding record)
+SXMLAggregation* sxml_make_aggregation(SXMLExplorer*, const char* record);
+void sxml_destroy_aggregation(SXMLAggregation*);
+
+// Adds a grouping path; keys are compared as written. Returns
+// SXMLExplorerErrorBufferOverflow beyond SXMLAggregateKeys and
+// SXMLExplorerErrorMalformedXML for paths the binding rejects.
+unsigned char sxml_aggregate_group(SXMLAggregation*, const char* path);
+// Adds an aggregate over path (NULL counts records); results keep the
+// order of these calls. Numeric values use sxml_to_double and values that
+// do not convert (or are NaN) are ignored.
+unsigned char sxml_aggregate(SXMLAggregation*, unsigned char op, const char* path);
+
+unsigned int sxml_aggregation_groups(SXMLAggregation*);
+// Result func: unsigned char (*)(void* user, const SXMLSpan* keys, unsigned
+// int key_count, const double* values, unsigned int value_count), once per
+// group in order of first appearance; anything but SXMLExplorerContinue
+// stops and is returned
+unsigned char sxml_aggregation_emit(SXMLAggregation*, void*, void*);
+
+#endif
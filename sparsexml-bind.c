@@ -0,0 +1,209 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sparsexml-priv.h"
+#include "sparsexml-query.h"
+#include "sparsexml-bind.h"
+
+#define SXMLBindPathLength 256
+
+typedef struct {
+  unsigned char type;
+  unsigned int offset;
+} SXMLBindField;
+
+struct __SXMLBinding {
+  SXMLQuerySet* queries;
+  unsigned int record_query;
+  char record[SXMLBindPathLength];
+
+  unsigned char* storage;
+  unsigned int size;
+  SXMLBindField fields[SXMLBindFields];
+  unsigned int field_count;
+  unsigned char field_of[SXMLQueryMax];  // Field index + 1 by query id, 0 for none
+
+  char arena[SXMLBindArenaLength];       // Text of the current record
+  unsigned int arena_used;
+  unsigned long found;
+  unsigned char in_record;
+
+  unsigned char (*record_func)(void *, void *, unsigned long);
+  void* record_user;
+};
+
+// =============================================================================
+// VALUE CONVERSION
+// =============================================================================
+
+static unsigned int priv_sxml_bind_size(unsigned char type) {
+  switch (type) {
+    case SXMLBindText: return sizeof(SXMLSpan);
+    case SXMLBindInt: return sizeof(long long);
+    case SXMLBindDouble: return sizeof(double);
+    case SXMLBindBool: return sizeof(unsigned char);
+    case SXMLBindTimestamp: return sizeof(long long);
+  }
+  return 0;
+}
+
+unsigned char sxml_bind_value(unsigned char type, const char* value, unsigned int len, void* out) {
+  switch (type) {
+    case SXMLBindInt: return sxml_to_int(value, len, out);
+    case SXMLBindDouble: return sxml_to_double(value, len, out);
+    case SXMLBindBool: return sxml_to_bool(value, len, out);
+    case SXMLBindTimestamp: return sxml_to_timestamp(value, len, out, NULL);
+  }
+  return 0;
+}
+
+static unsigned char priv_sxml_bind_convert(SXMLBinding* binding, const SXMLBindField* field, const char* value, unsigned int len) {
+  unsigned char* slot = binding->storage + field->offset;
+  SXMLSpan span;
+
+  if (field->type != SXMLBindText) {
+    return sxml_bind_value(field->type, value, len, slot);
+  }
+  if (binding->arena_used + len + 1 > SXMLBindArenaLength) {
+    return 0;
+  }
+  span.text = binding->arena + binding->arena_used;
+  span.len = len;
+  memcpy(binding->arena + binding->arena_used, value, len);
+  binding->arena[binding->arena_used + len] = '\0';
+  binding->arena_used += len + 1;
+  memcpy(slot, &span, sizeof(span));
+  return 1;
+}
+
+// =============================================================================
+// RECORD EVENTS
+// =============================================================================
+
+static unsigned char priv_sxml_bind_match(void* user, unsigned int query, char* value, unsigned int len) {
+  SXMLBinding* binding = user;
+  unsigned int field;
+
+  if (query == binding->record_query) {
+    memset(binding->storage, 0, binding->size);
+    binding->arena_used = 0;
+    binding->found = 0;
+    binding->in_record = 1;
+    return SXMLExplorerContinue;
+  }
+  if (!binding->in_record || query >= SXMLQueryMax || binding->field_of[query] == 0) {
+    return SXMLExplorerContinue;
+  }
+  field = binding->field_of[query] - 1;
+  if (!(binding->found & (1ul << field)) && priv_sxml_bind_convert(binding, &binding->fields[field], value, len)) {
+    binding->found |= 1ul << field;
+  }
+  return SXMLExplorerContinue;
+}
+
+static unsigned char priv_sxml_bind_end(void* user, unsigned int query) {
+  SXMLBinding* binding = user;
+
+  if (query != binding->record_query || !binding->in_record) {
+    return SXMLExplorerContinue;
+  }
+  binding->in_record = 0;
+  if (binding->record_func == NULL) {
+    return SXMLExplorerContinue;
+  }
+  return binding->record_func(binding->record_user, binding->storage, binding->found);
+}
+
+// =============================================================================
+// BINDING TABLE
+// =============================================================================
+
+SXMLBinding* sxml_make_binding(SXMLExplorer* explorer, const char* record, void* storage, unsigned int size) {
+  SXMLBinding* binding;
+
+  if (strlen(record) >= SXMLBindPathLength) {
+    return NULL;
+  }
+  binding = calloc(1, sizeof(SXMLBinding));
+  if (binding == NULL) {
+    return NULL;
+  }
+  binding->queries = sxml_make_query_set(explorer);
+  if (binding->queries == NULL) {
+    free(binding);
+    return NULL;
+  }
+  binding->record_query = sxml_add_query(binding->queries, record);
+  if (binding->record_query == SXMLQueryInvalid) {
+    sxml_destroy_binding(binding);
+    return NULL;
+  }
+
+  strcpy(binding->record, record);
+  binding->storage = storage;
+  binding->size = size;
+  sxml_query_register_match_func(binding->queries, priv_sxml_bind_match, binding);
+  sxml_query_register_end_func(binding->queries, priv_sxml_bind_end, binding);
+
+  return binding;
+}
+
+void sxml_destroy_binding(SXMLBinding* binding) {
+  sxml_destroy_query_set(binding->queries);
+  free(binding);
+}
+
+// Element paths bind their text: the last step outside predicates decides
+static unsigned char priv_sxml_bind_is_element(const char* path) {
+  const char* last = path;
+  unsigned int depth = 0;
+  char quote = '\0';
+
+  for (; *path != '\0'; path++) {
+    if (quote != '\0') {
+      quote = *path == quote ? '\0' : quote;
+    } else if (*path == '\'' || *path == '"') {
+      quote = *path;
+    } else if (*path == '[') {
+      depth++;
+    } else if (*path == ']' && depth > 0) {
+      depth--;
+    } else if (*path == '/' && depth == 0) {
+      last = path + 1;
+    }
+  }
+  return *last != '@' && strcmp(last, "text()") != 0;
+}
+
+unsigned char sxml_bind_field(SXMLBinding* binding, const char* path, unsigned char type, unsigned int offset) {
+  char query[SXMLBindPathLength * 2];
+  unsigned int id, size = priv_sxml_bind_size(type);
+  int n;
+
+  if (size == 0 || offset + size > binding->size || *path == '\0') {
+    return SXMLExplorerErrorMalformedXML;
+  }
+  if (binding->field_count >= SXMLBindFields) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  n = snprintf(query, sizeof(query), "%s%s%s%s", binding->record, path[0] == '/' ? "" : "/", path,
+               priv_sxml_bind_is_element(path) ? "/text()" : "");
+  if (n < 0 || (unsigned int)n >= sizeof(query)) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  id = sxml_add_query(binding->queries, query);
+  if (id == SXMLQueryInvalid) {
+    return SXMLExplorerErrorMalformedXML;
+  }
+
+  binding->fields[binding->field_count].type = type;
+  binding->fields[binding->field_count].offset = offset;
+  binding->field_of[id] = ++binding->field_count;
+  return SXMLExplorerContinue;
+}
+
+void sxml_binding_register_record_func(SXMLBinding* binding, void* func, void* user) {
+  binding->record_func = func;
+  binding->record_user = user;
+}
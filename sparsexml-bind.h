@@ -0,0 +1,59 @@
+#ifndef __SXMLBind__
+#define __SXMLBind__
+
+#include "sparsexml.h"
+
+/*
+ * Record binding: a table of paths relative to a record element, each
+ * mapped to an offset and a type in a caller struct. The struct is cleared
+ * when a record starts, filled as its fields stream past and handed to one
+ * callback when the record ends.
+ *
+ *   SXMLBinding* b = sxml_make_binding(ex, "/rss/channel/item", &item, sizeof(item));
+ *   sxml_bind_field(b, "title", SXMLBindText, offsetof(Item, title));
+ *   sxml_bind_field(b, "guid/@isPermaLink", SXMLBindBool, offsetof(Item, permalink));
+ *
+ * Fields compile into one query set (see sparsexml-query.h), so each event
+ * is matched by the shared automaton and a match finds its field by query
+ * id. The first value of a field within a record wins. Text spans point
+ * into an arena owned by the binding and stay valid for the record func.
+ */
+
+#define SXMLBindFields 32
+#define SXMLBindArenaLength 4096
+
+#define SXMLBindText 0x00       // SXMLSpan
+#define SXMLBindInt 0x01        // long long
+#define SXMLBindDouble 0x02     // double
+#define SXMLBindBool 0x03       // unsigned char: "true"/"1" or "false"/"0"
+#define SXMLBindTimestamp 0x04  // long long: RFC 3339 as seconds since the epoch (UTC)
+
+typedef struct {
+  const char* text;
+  unsigned int len;
+} SXMLSpan;
+
+typedef struct __SXMLBinding SXMLBinding;
+
+// record is the absolute path of the record element; storage receives each
+// record and must stay valid while the explorer runs
+SXMLBinding* sxml_make_binding(SXMLExplorer*, const char* record, void* storage, unsigned int size);
+void sxml_destroy_binding(SXMLBinding*);
+
+// path is relative to the record: "title", "author/name", "@id",
+// "link[@rel='alternate']/@href", "text()" or "//category". Element paths
+// bind the element's text. Returns SXMLExplorerErrorMalformedXML for paths
+// the query engine does not support and SXMLExplorerErrorBufferOverflow
+// when the table is full.
+unsigned char sxml_bind_field(SXMLBinding*, const char* path, unsigned char type, unsigned int offset);
+
+// Record func: unsigned char (*)(void* user, void* record, unsigned long fields),
+// bit i of fields set when the i-th bound field was found and converted
+void sxml_binding_register_record_func(SXMLBinding*, void*, void*);
+
+// Converts one scalar value (any type but SXMLBindText) into out with the
+// explorer's typed conversions (sxml_to_int and friends); returns 1 on
+// success and leaves out alone otherwise
+unsigned char sxml_bind_value(unsigned char type, const char* value, unsigned int len, void* out);
+
+#endif
@@ -0,0 +1,237 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "sparsexml-columns.h"
+
+#define SXMLColumnsDataLength 4096
+#define SXMLColumnsDataMax 0x7FFFFFFFu  // int32 offsets
+
+typedef union {
+  SXMLSpan text;
+  long long integer;
+  double number;
+  unsigned char boolean;
+} SXMLColumnValue;
+
+typedef struct {
+  unsigned char* validity;
+  void* values;
+  char* data;
+  unsigned int data_used;
+  unsigned int data_capacity;
+  unsigned int null_count;
+} SXMLColumnBuffers;
+
+struct __SXMLColumns {
+  SXMLBinding* binding;
+  SXMLColumnValue record[SXMLColumnsMax];
+  unsigned int rows;           // Batch length
+  unsigned int length;         // Rows in the current batch
+  unsigned int column_count;
+  unsigned char types[SXMLColumnsMax];
+  SXMLColumnBuffers buffers[SXMLColumnsMax];
+  SXMLColumn views[SXMLColumnsMax];  // Handed to the batch func
+
+  unsigned char (*batch_func)(void *, const SXMLColumnBatch *);
+  void* batch_user;
+};
+
+// =============================================================================
+// BUFFERS
+// =============================================================================
+
+static unsigned int priv_sxml_columns_bitmap(unsigned int rows) {
+  return (rows + 7) / 8;
+}
+
+static unsigned int priv_sxml_columns_values(unsigned char type, unsigned int rows) {
+  switch (type) {
+    case SXMLBindText: return (rows + 1) * sizeof(int);
+    case SXMLBindBool: return priv_sxml_columns_bitmap(rows);
+  }
+  return rows * 8;
+}
+
+static void priv_sxml_columns_reset(SXMLColumns* columns) {
+  unsigned int i;
+
+  for (i = 0; i < columns->column_count; i++) {
+    SXMLColumnBuffers* buffers = &columns->buffers[i];
+    memset(buffers->validity, 0, priv_sxml_columns_bitmap(columns->rows));
+    if (columns->types[i] == SXMLBindBool) {
+      memset(buffers->values, 0, priv_sxml_columns_bitmap(columns->rows));
+    } else if (columns->types[i] == SXMLBindText) {
+      ((int*)buffers->values)[0] = 0;
+    }
+    buffers->data_used = 0;
+    buffers->null_count = 0;
+  }
+  columns->length = 0;
+}
+
+static unsigned char priv_sxml_columns_append_text(SXMLColumnBuffers* buffers, const SXMLSpan* span) {
+  if (span->len == 0) {
+    return 1;
+  }
+  if (buffers->data_used + span->len > buffers->data_capacity) {
+    unsigned long capacity = buffers->data_capacity > 0 ? buffers->data_capacity : SXMLColumnsDataLength;
+    char* data;
+    while (buffers->data_used + span->len > capacity) {
+      capacity *= 2;
+    }
+    if (capacity > SXMLColumnsDataMax) {
+      capacity = SXMLColumnsDataMax;
+      if (buffers->data_used + span->len > capacity) {
+        return 0;
+      }
+    }
+    data = realloc(buffers->data, capacity);
+    if (data == NULL) {
+      return 0;
+    }
+    buffers->data = data;
+    buffers->data_capacity = capacity;
+  }
+  memcpy(buffers->data + buffers->data_used, span->text, span->len);
+  buffers->data_used += span->len;
+  return 1;
+}
+
+// =============================================================================
+// ROWS AND BATCHES
+// =============================================================================
+
+unsigned char sxml_columns_flush(SXMLColumns* columns) {
+  SXMLColumnBatch batch;
+  unsigned char ret = SXMLExplorerContinue;
+  unsigned int i;
+
+  if (columns->length == 0) {
+    return SXMLExplorerContinue;
+  }
+  for (i = 0; i < columns->column_count; i++) {
+    SXMLColumn* view = &columns->views[i];
+    view->type = columns->types[i];
+    view->null_count = columns->buffers[i].null_count;
+    view->validity = columns->buffers[i].validity;
+    view->values = columns->buffers[i].values;
+    view->data = columns->types[i] == SXMLBindText ? columns->buffers[i].data : NULL;
+    view->data_len = columns->buffers[i].data_used;
+  }
+  batch.length = columns->length;
+  batch.column_count = columns->column_count;
+  batch.columns = columns->views;
+  if (columns->batch_func != NULL) {
+    ret = columns->batch_func(columns->batch_user, &batch);
+  }
+  priv_sxml_columns_reset(columns);
+  return ret;
+}
+
+static unsigned char priv_sxml_columns_record(void* user, void* record, unsigned long fields) {
+  SXMLColumns* columns = user;
+  const SXMLColumnValue* values = record;
+  unsigned int row = columns->length, byte = row / 8, i;
+  unsigned char mask = (unsigned char)(1 << (row % 8));
+  static const SXMLSpan empty = { "", 0 };
+
+  for (i = 0; i < columns->column_count; i++) {
+    SXMLColumnBuffers* buffers = &columns->buffers[i];
+    unsigned char present = (fields & (1ul << i)) != 0;
+
+    if (present) {
+      buffers->validity[byte] |= mask;
+    } else {
+      buffers->null_count++;
+    }
+    switch (columns->types[i]) {
+      case SXMLBindText:
+        if (!priv_sxml_columns_append_text(buffers, present ? &values[i].text : &empty)) {
+          return SXMLExplorerErrorBufferOverflow;
+        }
+        ((int*)buffers->values)[row + 1] = (int)buffers->data_used;
+        break;
+      case SXMLBindInt:
+      case SXMLBindTimestamp:
+        ((long long*)buffers->values)[row] = present ? values[i].integer : 0;
+        break;
+      case SXMLBindDouble:
+        ((double*)buffers->values)[row] = present ? values[i].number : 0;
+        break;
+      case SXMLBindBool:
+        if (present && values[i].boolean) {
+          ((unsigned char*)buffers->values)[byte] |= mask;
+        }
+        break;
+    }
+  }
+  if (++columns->length == columns->rows) {
+    return sxml_columns_flush(columns);
+  }
+  return SXMLExplorerContinue;
+}
+
+// =============================================================================
+// COLUMN TABLE
+// =============================================================================
+
+SXMLColumns* sxml_make_columns(SXMLExplorer* explorer, const char* record, unsigned int rows) {
+  SXMLColumns* columns = calloc(1, sizeof(SXMLColumns));
+
+  if (columns == NULL) {
+    return NULL;
+  }
+  columns->rows = rows > 0 ? rows : SXMLColumnsDefaultRows;
+  columns->binding = sxml_make_binding(explorer, record, columns->record, sizeof(columns->record));
+  if (columns->binding == NULL) {
+    free(columns);
+    return NULL;
+  }
+  sxml_binding_register_record_func(columns->binding, priv_sxml_columns_record, columns);
+  return columns;
+}
+
+void sxml_destroy_columns(SXMLColumns* columns) {
+  unsigned int i;
+
+  sxml_destroy_binding(columns->binding);
+  for (i = 0; i < columns->column_count; i++) {
+    free(columns->buffers[i].validity);
+    free(columns->buffers[i].values);
+    free(columns->buffers[i].data);
+  }
+  free(columns);
+}
+
+unsigned char sxml_add_column(SXMLColumns* columns, const char* path, unsigned char type) {
+  unsigned int i = columns->column_count;
+  SXMLColumnBuffers* buffers = &columns->buffers[i];
+  unsigned char ret;
+
+  if (i >= SXMLColumnsMax || columns->length > 0) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  buffers->validity = calloc(priv_sxml_columns_bitmap(columns->rows), 1);
+  buffers->values = calloc(priv_sxml_columns_values(type, columns->rows), 1);
+  if (buffers->validity == NULL || buffers->values == NULL) {
+    free(buffers->validity);
+    free(buffers->values);
+    memset(buffers, 0, sizeof(SXMLColumnBuffers));
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  ret = sxml_bind_field(columns->binding, path, type, i * sizeof(SXMLColumnValue));
+  if (ret != SXMLExplorerContinue) {
+    free(buffers->validity);
+    free(buffers->values);
+    memset(buffers, 0, sizeof(SXMLColumnBuffers));
+    return ret;
+  }
+  columns->types[i] = type;
+  columns->column_count++;
+  return SXMLExplorerContinue;
+}
+
+void sxml_columns_register_batch_func(SXMLColumns* columns, void* func, void* user) {
+  columns->batch_func = func;
+  columns->batch_user = user;
+}
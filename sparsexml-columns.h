@@ -0,0 +1,64 @@
+#ifndef __SXMLColumns__
+#define __SXMLColumns__
+
+#include "sparsexml.h"
+#include "sparsexml-bind.h"
+
+/*
+ * Columnar extraction: paths relative to a record element, each appended
+ * to a typed column. A record is a row; rows are collected into batches
+ * and each full batch is handed to one callback.
+ *
+ *   SXMLColumns* c = sxml_make_columns(ex, "/library/books/book", 4096);
+ *   sxml_add_column(c, "@id", SXMLBindText);
+ *   sxml_add_column(c, "publication/year", SXMLBindInt);
+ *   sxml_columns_register_batch_func(c, load_batch, table);
+ *   sxml_run_explorer(ex, xml);
+ *   sxml_columns_flush(c);                    // the last, partial batch
+ *
+ * Buffers follow the Arrow columnar layout: a validity bitmap per column
+ * (bit i, least significant first, set when row i has a value), int64
+ * values for SXMLBindInt and SXMLBindTimestamp (seconds, UTC), float64 for
+ * SXMLBindDouble, a bit-packed bitmap for SXMLBindBool, and int32 offsets
+ * (length + 1 entries) into one data buffer for SXMLBindText. Null slots
+ * hold zeros and empty strings. Paths are bound like record fields (see
+ * sparsexml-bind.h), so a row takes the first value of each path.
+ */
+
+#define SXMLColumnsMax SXMLBindFields
+#define SXMLColumnsDefaultRows 4096
+
+typedef struct {
+  unsigned char type;             // SXMLBind*
+  unsigned int null_count;
+  const unsigned char* validity;
+  const void* values;             // Values, bits for booleans, offsets for text
+  const char* data;               // Text bytes, NULL for other types
+  unsigned int data_len;
+} SXMLColumn;
+
+typedef struct {
+  unsigned int length;            // Rows
+  unsigned int column_count;
+  const SXMLColumn* columns;      // In order of sxml_add_column
+} SXMLColumnBatch;
+
+typedef struct __SXMLColumns SXMLColumns;
+
+// rows is the batch length (0 for SXMLColumnsDefaultRows)
+SXMLColumns* sxml_make_columns(SXMLExplorer*, const char* record, unsigned int rows);
+void sxml_destroy_columns(SXMLColumns*);
+
+// Returns SXMLExplorerErrorBufferOverflow beyond SXMLColumnsMax or once
+// rows exist, and SXMLExplorerErrorMalformedXML for paths or types the
+// binding rejects
+unsigned char sxml_add_column(SXMLColumns*, const char* path, unsigned char type);
+
+// Batch func: unsigned char (*)(void* user, const SXMLColumnBatch*). The
+// buffers are reused for the next batch once it returns; anything but
+// SXMLExplorerContinue stops the explorer.
+void sxml_columns_register_batch_func(SXMLColumns*, void*, void*);
+// Hands over the rows collected since the last batch, if any
+unsigned char sxml_columns_flush(SXMLColumns*);
+
+#endif
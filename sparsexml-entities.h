@@ -0,0 +1,2771 @@
+// Generated by tools/gen-entities.py -- do not edit.
+// HTML5 named character references (the five XML entities included)
+// behind a minimal perfect hash; values are UTF-8.
+#ifndef __SXMLEntities__
+#define __SXMLEntities__
+
+#define SXMLEntityCount 2125
+#define SXMLEntityBuckets 532
+#define SXMLEntityMaxNameLength 31
+
+typedef struct {
+  unsigned short name;       // Offset into sxml_entity_names
+  unsigned short value;      // Offset into sxml_entity_values
+  unsigned char name_len;
+  unsigned char value_len;
+  unsigned char xml;         // One of the five predefined XML entities
+} SXMLEntity;
+
+static const unsigned short sxml_entity_displacements[SXMLEntityBuckets] = {
+  80, 78, 49, 117, 39, 362, 180, 11, 13, 120, 133, 474,
+  44, 20, 27, 66, 99, 137, 4, 15, 22, 34, 115, 1,
+  1, 26, 2, 11, 26, 73, 74, 1, 20, 11, 1, 13,
+  278, 39, 22, 33, 4, 7, 2, 4, 27, 17, 0, 6,
+  1, 19, 128, 13, 1, 15, 1, 9, 10, 6, 88, 2,
+  8, 6, 3, 86, 7, 31, 29, 26, 8, 37, 73, 2,
+  0, 157, 2, 46, 21, 2, 269, 154, 1, 27, 1, 2,
+  10, 20, 39, 168, 21, 2, 54, 13, 63, 2, 15, 53,
+  2, 0, 7, 4, 9, 1, 117, 9, 1, 1, 180, 2,
+  575, 3, 38, 4, 2, 12, 1, 115, 390, 34, 127, 1,
+  148, 7, 26, 82, 12, 3, 6, 0, 70, 27, 68, 491,
+  1, 42, 88, 136, 10, 6, 136, 1, 16, 59, 38, 159,
+  179, 20, 19, 193, 7, 30, 116, 2, 122, 278, 12, 1,
+  1, 77, 54, 13, 24, 56, 7, 8, 86, 55, 80, 3,
+  13, 191, 373, 10, 79, 5, 255, 91, 15, 2, 3, 7,
+  3, 98, 4, 24, 129, 53, 31, 139, 27, 69, 1, 147,
+  2, 143, 181, 2, 44, 14, 70, 9, 187, 1, 2, 10,
+  4, 72, 3, 48, 22, 20, 11, 301, 101, 34, 1, 95,
+  24, 143, 115, 53, 17, 3, 5, 42, 92, 5, 364, 106,
+  72, 55, 2, 1, 26, 61, 12, 1, 4, 14, 272, 2,
+  165, 26, 60, 444, 1, 3, 58, 32, 12, 39, 11, 9,
+  4, 30, 157, 18, 45, 29, 140, 2, 167, 332, 6, 50,
+  31, 329, 11, 10, 1, 3, 32, 126, 152, 2, 295, 45,
+  9, 3, 2, 97, 29, 1, 7, 17, 36, 100, 29, 86,
+  201, 361, 143, 76, 3, 164, 308, 24, 11, 4, 121, 8,
+  65, 3, 895, 4, 159, 0, 29, 136, 9, 158, 20, 443,
+  253, 56, 746, 2, 336, 2, 24, 512, 31, 217, 237, 170,
+  145, 85, 4, 126, 410, 72, 54, 3, 114, 13, 14, 1260,
+  398, 1, 2865, 11, 79, 786, 665, 192, 161, 154, 395, 110,
+  133, 5, 1, 17, 1202, 7, 58, 31, 87, 5, 15, 2,
+  418, 8, 30, 4, 3, 16, 311, 1, 129, 4, 217, 50,
+  19, 0, 225, 171, 55, 49, 5, 5, 214, 326, 32, 928,
+  47, 1970, 242, 7, 25, 360, 427, 543, 2, 49, 81, 75,
+  320, 57, 5, 457, 322, 39, 107, 3, 521, 1, 602, 1022,
+  109, 590, 23, 24, 4, 96, 2, 23, 97, 72, 50, 349,
+  85, 1, 3, 21, 58, 1163, 80, 626, 9, 2, 137, 181,
+  42, 1290, 1185, 4, 269, 126, 1064, 57, 678, 63, 3, 487,
+  2125, 723, 2165, 1331, 91, 1, 2, 187, 8, 1852, 350, 3,
+  116, 114, 2056, 2, 584, 236, 26, 606, 41, 162, 61, 46,
+  662, 7, 14, 196, 15, 318, 2, 147, 3960, 8, 479, 75,
+  254, 1231, 136, 30, 68, 13, 1, 46, 177, 60, 13, 54,
+  266, 0, 12, 536, 565, 169, 846, 84, 9, 21, 282, 327,
+  523, 1377, 6, 5, 86, 7, 119, 19, 180, 51, 94, 1755,
+  98, 2, 26, 74, 1, 13, 0, 23, 1036, 13, 472, 12,
+  4, 38, 23, 1264,
+};
+
+static const SXMLEntity sxml_entity_table[SXMLEntityCount] = {
+  { 0, 0, 4, 1, 0 },
+  { 4, 1, 5, 2, 0 },
+  { 9, 3, 6, 2, 0 },
+  { 15, 5, 16, 3, 0 },
+  { 31, 8, 5, 3, 0 },
+  { 36, 11, 4, 3, 0 },
+  { 40, 14, 6, 3, 0 },
+  { 46, 17, 13, 3, 0 },
+  { 59, 20, 7, 3, 0 },
+  { 66, 23, 6, 3, 0 },
+  { 72, 26, 14, 2, 0 },
+  { 86, 28, 3, 3, 0 },
+  { 89, 31, 6, 2, 0 },
+  { 95, 33, 6, 3, 0 },
+  { 101, 36, 5, 3, 0 },
+  { 106, 39, 6, 3, 0 },
+  { 112, 42, 4, 3, 0 },
+  { 116, 45, 5, 3, 0 },
+  { 121, 48, 5, 3, 0 },
+  { 126, 51, 4, 3, 0 },
+  { 130, 54, 6, 2, 0 },
+  { 136, 56, 3, 6, 0 },
+  { 139, 62, 5, 3, 0 },
+  { 144, 65, 5, 3, 0 },
+  { 149, 68, 3, 2, 0 },
+  { 152, 70, 5, 3, 0 },
+  { 157, 73, 6, 3, 0 },
+  { 163, 76, 14, 3, 0 },
+  { 177, 79, 6, 3, 0 },
+  { 183, 82, 8, 3, 0 },
+  { 191, 85, 4, 3, 0 },
+  { 195, 88, 3, 3, 0 },
+  { 198, 91, 15, 3, 0 },
+  { 213, 94, 4, 2, 0 },
+  { 217, 96, 6, 3, 0 },
+  { 223, 99, 17, 3, 0 },
+  { 240, 102, 5, 2, 0 },
+  { 245, 104, 4, 4, 0 },
+  { 249, 108, 6, 2, 0 },
+  { 255, 110, 22, 3, 0 },
+  { 277, 113, 4, 2, 0 },
+  { 281, 115, 6, 1, 0 },
+  { 287, 116, 6, 3, 0 },
+  { 293, 119, 3, 3, 0 },
+  { 296, 122, 6, 3, 0 },
+  { 302, 125, 3, 2, 0 },
+  { 305, 127, 2, 2, 0 },
+  { 307, 129, 7, 3, 0 },
+  { 314, 132, 5, 3, 0 },
+  { 319, 135, 15, 2, 0 },
+  { 334, 137, 3, 4, 0 },
+  { 337, 141, 11, 3, 0 },
+  { 348, 144, 6, 3, 0 },
+  { 354, 147, 4, 4, 0 },
+  { 358, 151, 3, 3, 0 },
+  { 361, 154, 6, 3, 0 },
+  { 367, 157, 3, 1, 0 },
+  { 370, 158, 5, 3, 0 },
+  { 375, 161, 6, 3, 0 },
+  { 381, 164, 5, 3, 0 },
+  { 386, 167, 7, 3, 0 },
+  { 393, 170, 17, 3, 0 },
+  { 410, 173, 7, 3, 0 },
+  { 417, 176, 5, 5, 0 },
+  { 422, 181, 18, 3, 0 },
+  { 440, 184, 5, 3, 0 },
+  { 445, 187, 9, 5, 0 },
+  { 454, 192, 5, 3, 0 },
+  { 459, 195, 11, 3, 0 },
+  { 470, 198, 4, 3, 0 },
+  { 474, 201, 5, 3, 0 },
+  { 479, 204, 4, 3, 0 },
+  { 483, 207, 11, 3, 0 },
+  { 494, 210, 6, 2, 0 },
+  { 500, 212, 6, 3, 0 },
+  { 506, 215, 4, 2, 0 },
+  { 510, 217, 10, 3, 0 },
+  { 520, 220, 6, 2, 0 },
+  { 526, 222, 5, 2, 0 },
+  { 531, 224, 2, 3, 0 },
+  { 533, 227, 5, 3, 0 },
+  { 538, 230, 6, 2, 0 },
+  { 544, 232, 4, 3, 0 },
+  { 548, 235, 3, 2, 0 },
+  { 551, 237, 11, 3, 0 },
+  { 562, 240, 4, 3, 0 },
+  { 566, 243, 7, 3, 0 },
+  { 573, 246, 10, 3, 0 },
+  { 583, 249, 17, 3, 0 },
+  { 600, 252, 6, 1, 0 },
+  { 606, 253, 5, 2, 0 },
+  { 611, 255, 5, 3, 0 },
+  { 616, 258, 5, 2, 0 },
+  { 621, 260, 7, 2, 0 },
+  { 628, 262, 11, 3, 0 },
+  { 639, 265, 4, 2, 0 },
+  { 643, 267, 4, 3, 0 },
+  { 647, 270, 10, 3, 0 },
+  { 657, 273, 4, 3, 0 },
+  { 661, 276, 4, 3, 0 },
+  { 665, 279, 4, 4, 0 },
+  { 669, 283, 12, 3, 0 },
+  { 681, 286, 9, 3, 0 },
+  { 690, 289, 10, 3, 0 },
+  { 700, 292, 4, 3, 0 },
+  { 704, 295, 5, 6, 0 },
+  { 709, 301, 6, 3, 0 },
+  { 715, 304, 6, 3, 0 },
+  { 721, 307, 5, 3, 0 },
+  { 726, 310, 3, 2, 0 },
+  { 729, 312, 8, 3, 0 },
+  { 737, 315, 4, 4, 0 },
+  { 741, 319, 4, 4, 0 },
+  { 745, 323, 3, 4, 0 },
+  { 748, 327, 7, 3, 0 },
+  { 755, 330, 7, 3, 0 },
+  { 762, 333, 8, 2, 0 },
+  { 770, 335, 5, 3, 0 },
+  { 775, 338, 4, 4, 0 },
+  { 779, 342, 4, 2, 0 },
+  { 783, 344, 7, 3, 0 },
+  { 790, 347, 5, 3, 0 },
+  { 795, 350, 6, 5, 0 },
+  { 801, 355, 5, 3, 0 },
+  { 806, 358, 10, 3, 0 },
+  { 816, 361, 8, 3, 0 },
+  { 824, 364, 7, 2, 0 },
+  { 831, 366, 5, 3, 0 },
+  { 836, 369, 5, 2, 0 },
+  { 841, 371, 17, 3, 0 },
+  { 858, 374, 3, 2, 0 },
+  { 861, 376, 5, 3, 0 },
+  { 866, 379, 5, 3, 0 },
+  { 871, 382, 3, 3, 0 },
+  { 874, 385, 16, 1, 0 },
+  { 890, 386, 4, 2, 0 },
+  { 894, 388, 5, 3, 0 },
+  { 899, 391, 4, 2, 0 },
+  { 903, 393, 8, 3, 0 },
+  { 911, 396, 2, 3, 0 },
+  { 913, 399, 5, 5, 0 },
+  { 918, 404, 4, 2, 0 },
+  { 922, 406, 5, 3, 0 },
+  { 927, 409, 19, 5, 0 },
+  { 946, 414, 13, 3, 0 },
+  { 959, 417, 5, 3, 0 },
+  { 964, 420, 3, 3, 0 },
+  { 967, 423, 5, 2, 0 },
+  { 972, 425, 5, 3, 0 },
+  { 977, 428, 11, 3, 0 },
+  { 988, 431, 4, 2, 0 },
+  { 992, 433, 3, 3, 0 },
+  { 995, 436, 2, 2, 0 },
+  { 997, 438, 6, 2, 0 },
+  { 1003, 440, 7, 3, 0 },
+  { 1010, 443, 4, 2, 0 },
+  { 1014, 445, 5, 3, 0 },
+  { 1019, 448, 8, 3, 0 },
+  { 1027, 451, 14, 3, 0 },
+  { 1041, 454, 7, 3, 0 },
+  { 1048, 457, 16, 3, 0 },
+  { 1064, 460, 3, 2, 0 },
+  { 1067, 462, 5, 5, 0 },
+  { 1072, 467, 9, 3, 0 },
+  { 1081, 470, 7, 3, 0 },
+  { 1088, 473, 3, 3, 0 },
+  { 1091, 476, 5, 5, 0 },
+  { 1096, 481, 2, 3, 0 },
+  { 1098, 484, 5, 3, 0 },
+  { 1103, 487, 5, 2, 0 },
+  { 1108, 489, 13, 3, 0 },
+  { 1121, 492, 4, 2, 0 },
+  { 1125, 494, 16, 3, 0 },
+  { 1141, 497, 13, 3, 0 },
+  { 1154, 500, 14, 3, 0 },
+  { 1168, 503, 5, 2, 0 },
+  { 1173, 505, 3, 2, 0 },
+  { 1176, 507, 18, 3, 0 },
+  { 1194, 510, 5, 3, 0 },
+  { 1199, 513, 14, 3, 0 },
+  { 1213, 516, 17, 5, 0 },
+  { 1230, 521, 5, 3, 0 },
+  { 1235, 524, 13, 3, 0 },
+  { 1248, 527, 5, 2, 0 },
+  { 1253, 529, 6, 2, 0 },
+  { 1259, 531, 6, 2, 0 },
+  { 1265, 533, 6, 2, 0 },
+  { 1271, 535, 5, 3, 0 },
+  { 1276, 538, 6, 3, 0 },
+  { 1282, 541, 4, 3, 0 },
+  { 1286, 544, 4, 1, 1 },
+  { 1290, 545, 5, 3, 0 },
+  { 1295, 548, 9, 3, 0 },
+  { 1304, 551, 10, 3, 0 },
+  { 1314, 554, 4, 4, 0 },
+  { 1318, 558, 6, 6, 0 },
+  { 1324, 564, 4, 3, 0 },
+  { 1328, 567, 3, 4, 0 },
+  { 1331, 571, 20, 3, 0 },
+  { 1351, 574, 4, 4, 0 },
+  { 1355, 578, 14, 3, 0 },
+  { 1369, 581, 4, 4, 0 },
+  { 1373, 585, 8, 3, 0 },
+  { 1381, 588, 5, 3, 0 },
+  { 1386, 591, 13, 3, 0 },
+  { 1399, 594, 20, 5, 0 },
+  { 1419, 599, 5, 3, 0 },
+  { 1424, 602, 2, 3, 0 },
+  { 1426, 605, 9, 3, 0 },
+  { 1435, 608, 6, 3, 0 },
+  { 1441, 611, 7, 3, 0 },
+  { 1448, 614, 5, 3, 0 },
+  { 1453, 617, 6, 3, 0 },
+  { 1459, 620, 6, 2, 0 },
+  { 1465, 622, 4, 3, 0 },
+  { 1469, 625, 6, 3, 0 },
+  { 1475, 628, 10, 3, 0 },
+  { 1485, 631, 9, 3, 0 },
+  { 1494, 634, 5, 2, 0 },
+  { 1499, 636, 3, 2, 0 },
+  { 1502, 638, 7, 3, 0 },
+  { 1509, 641, 5, 3, 0 },
+  { 1514, 644, 4, 3, 0 },
+  { 1518, 647, 3, 3, 0 },
+  { 1521, 650, 3, 3, 0 },
+  { 1524, 653, 4, 3, 0 },
+  { 1528, 656, 5, 3, 0 },
+  { 1533, 659, 6, 3, 0 },
+  { 1539, 662, 5, 3, 0 },
+  { 1544, 665, 8, 3, 0 },
+  { 1552, 668, 5, 3, 0 },
+  { 1557, 671, 9, 3, 0 },
+  { 1566, 674, 4, 1, 0 },
+  { 1570, 675, 3, 4, 0 },
+  { 1573, 679, 12, 3, 0 },
+  { 1585, 682, 14, 3, 0 },
+  { 1599, 685, 6, 3, 0 },
+  { 1605, 688, 5, 3, 0 },
+  { 1610, 691, 2, 3, 0 },
+  { 1612, 694, 5, 3, 0 },
+  { 1617, 697, 4, 3, 0 },
+  { 1621, 700, 19, 3, 0 },
+  { 1640, 703, 3, 3, 0 },
+  { 1643, 706, 16, 5, 0 },
+  { 1659, 711, 9, 3, 0 },
+  { 1668, 714, 7, 2, 0 },
+  { 1675, 716, 5, 3, 0 },
+  { 1680, 719, 6, 2, 0 },
+  { 1686, 721, 6, 3, 0 },
+  { 1692, 724, 6, 3, 0 },
+  { 1698, 727, 5, 3, 0 },
+  { 1703, 730, 7, 2, 0 },
+  { 1710, 732, 6, 3, 0 },
+  { 1716, 735, 14, 3, 0 },
+  { 1730, 738, 5, 3, 0 },
+  { 1735, 741, 5, 3, 0 },
+  { 1740, 744, 6, 2, 0 },
+  { 1746, 746, 5, 3, 0 },
+  { 1751, 749, 7, 3, 0 },
+  { 1758, 752, 9, 3, 0 },
+  { 1767, 755, 4, 2, 0 },
+  { 1771, 757, 6, 3, 0 },
+  { 1777, 760, 5, 3, 0 },
+  { 1782, 763, 5, 3, 0 },
+  { 1787, 766, 7, 3, 0 },
+  { 1794, 769, 8, 3, 0 },
+  { 1802, 772, 4, 4, 0 },
+  { 1806, 776, 5, 3, 0 },
+  { 1811, 779, 4, 3, 0 },
+  { 1815, 782, 6, 3, 0 },
+  { 1821, 785, 6, 3, 0 },
+  { 1827, 788, 4, 4, 0 },
+  { 1831, 792, 7, 3, 0 },
+  { 1838, 795, 9, 3, 0 },
+  { 1847, 798, 3, 3, 0 },
+  { 1850, 801, 6, 3, 0 },
+  { 1856, 804, 4, 2, 0 },
+  { 1860, 806, 4, 4, 0 },
+  { 1864, 810, 5, 1, 0 },
+  { 1869, 811, 6, 2, 0 },
+  { 1875, 813, 8, 3, 0 },
+  { 1883, 816, 7, 2, 0 },
+  { 1890, 818, 5, 3, 0 },
+  { 1895, 821, 4, 4, 0 },
+  { 1899, 825, 3, 1, 0 },
+  { 1902, 826, 2, 3, 0 },
+  { 1904, 829, 6, 3, 0 },
+  { 1910, 832, 5, 3, 0 },
+  { 1915, 835, 9, 2, 0 },
+  { 1924, 837, 5, 3, 0 },
+  { 1929, 840, 11, 3, 0 },
+  { 1940, 843, 9, 3, 0 },
+  { 1949, 846, 5, 2, 0 },
+  { 1954, 848, 5, 3, 0 },
+  { 1959, 851, 4, 3, 0 },
+  { 1963, 854, 6, 3, 0 },
+  { 1969, 857, 11, 3, 0 },
+  { 1980, 860, 10, 3, 0 },
+  { 1990, 863, 6, 3, 0 },
+  { 1996, 866, 5, 3, 0 },
+  { 2001, 869, 10, 3, 0 },
+  { 2011, 872, 4, 3, 0 },
+  { 2015, 875, 5, 2, 0 },
+  { 2020, 877, 5, 3, 0 },
+  { 2025, 880, 3, 4, 0 },
+  { 2028, 884, 6, 2, 0 },
+  { 2034, 886, 6, 2, 0 },
+  { 2040, 888, 15, 3, 0 },
+  { 2055, 891, 5, 2, 0 },
+  { 2060, 893, 2, 3, 0 },
+  { 2062, 896, 10, 3, 0 },
+  { 2072, 899, 6, 3, 0 },
+  { 2078, 902, 7, 3, 0 },
+  { 2085, 905, 7, 3, 0 },
+  { 2092, 908, 8, 3, 0 },
+  { 2100, 911, 6, 3, 0 },
+  { 2106, 914, 9, 2, 0 },
+  { 2115, 916, 9, 3, 0 },
+  { 2124, 919, 8, 3, 0 },
+  { 2132, 922, 6, 3, 0 },
+  { 2138, 925, 4, 2, 0 },
+  { 2142, 927, 3, 2, 0 },
+  { 2145, 929, 5, 3, 0 },
+  { 2150, 932, 5, 3, 0 },
+  { 2155, 935, 3, 3, 0 },
+  { 2158, 938, 5, 2, 0 },
+  { 2163, 940, 6, 2, 0 },
+  { 2169, 942, 6, 3, 0 },
+  { 2175, 945, 3, 3, 0 },
+  { 2178, 948, 6, 3, 0 },
+  { 2184, 951, 5, 3, 0 },
+  { 2189, 954, 11, 3, 0 },
+  { 2200, 957, 4, 3, 0 },
+  { 2204, 960, 13, 6, 0 },
+  { 2217, 966, 4, 4, 0 },
+  { 2221, 970, 4, 3, 0 },
+  { 2225, 973, 5, 2, 0 },
+  { 2230, 975, 4, 3, 0 },
+  { 2234, 978, 5, 2, 0 },
+  { 2239, 980, 12, 3, 0 },
+  { 2251, 983, 5, 3, 0 },
+  { 2256, 986, 9, 5, 0 },
+  { 2265, 991, 13, 3, 0 },
+  { 2278, 994, 6, 3, 0 },
+  { 2284, 997, 19, 3, 0 },
+  { 2303, 1000, 5, 3, 0 },
+  { 2308, 1003, 7, 3, 0 },
+  { 2315, 1006, 5, 3, 0 },
+  { 2320, 1009, 3, 4, 0 },
+  { 2323, 1013, 6, 1, 0 },
+  { 2329, 1014, 3, 2, 0 },
+  { 2332, 1016, 4, 4, 0 },
+  { 2336, 1020, 5, 3, 0 },
+  { 2341, 1023, 6, 2, 0 },
+  { 2347, 1025, 3, 4, 0 },
+  { 2350, 1029, 6, 3, 0 },
+  { 2356, 1032, 2, 3, 0 },
+  { 2358, 1035, 6, 2, 0 },
+  { 2364, 1037, 4, 6, 0 },
+  { 2368, 1043, 2, 2, 0 },
+  { 2370, 1045, 5, 2, 0 },
+  { 2375, 1047, 3, 2, 0 },
+  { 2378, 1049, 5, 3, 0 },
+  { 2383, 1052, 8, 3, 0 },
+  { 2391, 1055, 6, 2, 0 },
+  { 2397, 1057, 6, 1, 0 },
+  { 2403, 1058, 10, 3, 0 },
+  { 2413, 1061, 4, 5, 0 },
+  { 2417, 1066, 8, 3, 0 },
+  { 2425, 1069, 4, 4, 0 },
+  { 2429, 1073, 8, 3, 0 },
+  { 2437, 1076, 14, 3, 0 },
+  { 2451, 1079, 6, 2, 0 },
+  { 2457, 1081, 7, 3, 0 },
+  { 2464, 1084, 7, 3, 0 },
+  { 2471, 1087, 8, 3, 0 },
+  { 2479, 1090, 6, 2, 0 },
+  { 2485, 1092, 8, 3, 0 },
+  { 2493, 1095, 3, 3, 0 },
+  { 2496, 1098, 7, 3, 0 },
+  { 2503, 1101, 4, 3, 0 },
+  { 2507, 1104, 5, 1, 0 },
+  { 2512, 1105, 14, 3, 0 },
+  { 2526, 1108, 4, 1, 0 },
+  { 2530, 1109, 4, 3, 0 },
+  { 2534, 1112, 5, 3, 0 },
+  { 2539, 1115, 6, 2, 0 },
+  { 2545, 1117, 7, 3, 0 },
+  { 2552, 1120, 4, 4, 0 },
+  { 2556, 1124, 10, 3, 0 },
+  { 2566, 1127, 5, 3, 0 },
+  { 2571, 1130, 10, 3, 0 },
+  { 2581, 1133, 5, 3, 0 },
+  { 2586, 1136, 5, 3, 0 },
+  { 2591, 1139, 4, 3, 0 },
+  { 2595, 1142, 5, 2, 0 },
+  { 2600, 1144, 21, 3, 0 },
+  { 2621, 1147, 3, 3, 0 },
+  { 2624, 1150, 8, 3, 0 },
+  { 2632, 1153, 2, 3, 0 },
+  { 2634, 1156, 6, 3, 0 },
+  { 2640, 1159, 5, 3, 0 },
+  { 2645, 1162, 10, 3, 0 },
+  { 2655, 1165, 4, 3, 0 },
+  { 2659, 1168, 2, 3, 0 },
+  { 2661, 1171, 4, 2, 0 },
+  { 2665, 1173, 4, 3, 0 },
+  { 2669, 1176, 6, 2, 0 },
+  { 2675, 1178, 7, 5, 0 },
+  { 2682, 1183, 8, 3, 0 },
+  { 2690, 1186, 6, 2, 0 },
+  { 2696, 1188, 4, 4, 0 },
+  { 2700, 1192, 7, 3, 0 },
+  { 2707, 1195, 8, 3, 0 },
+  { 2715, 1198, 3, 2, 0 },
+  { 2718, 1200, 3, 5, 0 },
+  { 2721, 1205, 10, 3, 0 },
+  { 2731, 1208, 17, 3, 0 },
+  { 2748, 1211, 4, 2, 0 },
+  { 2752, 1213, 4, 2, 0 },
+  { 2756, 1215, 6, 3, 0 },
+  { 2762, 1218, 5, 3, 0 },
+  { 2767, 1221, 9, 3, 0 },
+  { 2776, 1224, 14, 3, 0 },
+  { 2790, 1227, 5, 2, 0 },
+  { 2795, 1229, 6, 3, 0 },
+  { 2801, 1232, 5, 3, 0 },
+  { 2806, 1235, 7, 6, 0 },
+  { 2813, 1241, 5, 2, 0 },
+  { 2818, 1243, 16, 3, 0 },
+  { 2834, 1246, 4, 4, 0 },
+  { 2838, 1250, 8, 3, 0 },
+  { 2846, 1253, 4, 3, 0 },
+  { 2850, 1256, 13, 3, 0 },
+  { 2863, 1259, 4, 3, 0 },
+  { 2867, 1262, 6, 2, 0 },
+  { 2873, 1264, 4, 3, 0 },
+  { 2877, 1267, 5, 3, 0 },
+  { 2882, 1270, 5, 3, 0 },
+  { 2887, 1273, 5, 3, 0 },
+  { 2892, 1276, 11, 6, 0 },
+  { 2903, 1282, 7, 3, 0 },
+  { 2910, 1285, 19, 3, 0 },
+  { 2929, 1288, 4, 2, 0 },
+  { 2933, 1290, 13, 3, 0 },
+  { 2946, 1293, 4, 4, 0 },
+  { 2950, 1297, 5, 3, 0 },
+  { 2955, 1300, 5, 2, 0 },
+  { 2960, 1302, 4, 3, 0 },
+  { 2964, 1305, 10, 3, 0 },
+  { 2974, 1308, 15, 3, 0 },
+  { 2989, 1311, 2, 3, 0 },
+  { 2991, 1314, 13, 3, 0 },
+  { 3004, 1317, 3, 2, 0 },
+  { 3007, 1319, 5, 2, 0 },
+  { 3012, 1321, 20, 3, 0 },
+  { 3032, 1324, 11, 3, 0 },
+  { 3043, 1327, 9, 3, 0 },
+  { 3052, 1330, 8, 3, 0 },
+  { 3060, 1333, 3, 4, 0 },
+  { 3063, 1337, 5, 3, 0 },
+  { 3068, 1340, 5, 3, 0 },
+  { 3073, 1343, 6, 3, 0 },
+  { 3079, 1346, 3, 3, 0 },
+  { 3082, 1349, 6, 3, 0 },
+  { 3088, 1352, 4, 3, 0 },
+  { 3092, 1355, 11, 3, 0 },
+  { 3103, 1358, 4, 4, 0 },
+  { 3107, 1362, 3, 3, 0 },
+  { 3110, 1365, 6, 3, 0 },
+  { 3116, 1368, 6, 2, 0 },
+  { 3122, 1370, 6, 2, 0 },
+  { 3128, 1372, 4, 2, 0 },
+  { 3132, 1374, 3, 3, 0 },
+  { 3135, 1377, 6, 3, 0 },
+  { 3141, 1380, 8, 3, 0 },
+  { 3149, 1383, 4, 2, 0 },
+  { 3153, 1385, 4, 4, 0 },
+  { 3157, 1389, 21, 3, 0 },
+  { 3178, 1392, 3, 4, 0 },
+  { 3181, 1396, 5, 3, 0 },
+  { 3186, 1399, 6, 3, 0 },
+  { 3192, 1402, 3, 3, 0 },
+  { 3195, 1405, 6, 2, 0 },
+  { 3201, 1407, 7, 3, 0 },
+  { 3208, 1410, 6, 2, 0 },
+  { 3214, 1412, 6, 3, 0 },
+  { 3220, 1415, 8, 3, 0 },
+  { 3228, 1418, 3, 2, 0 },
+  { 3231, 1420, 6, 3, 0 },
+  { 3237, 1423, 3, 3, 0 },
+  { 3240, 1426, 10, 3, 0 },
+  { 3250, 1429, 8, 3, 0 },
+  { 3258, 1432, 6, 3, 0 },
+  { 3264, 1435, 5, 2, 0 },
+  { 3269, 1437, 5, 1, 0 },
+  { 3274, 1438, 12, 3, 0 },
+  { 3286, 1441, 3, 3, 0 },
+  { 3289, 1444, 5, 2, 0 },
+  { 3294, 1446, 6, 3, 0 },
+  { 3300, 1449, 6, 2, 0 },
+  { 3306, 1451, 5, 3, 0 },
+  { 3311, 1454, 5, 3, 0 },
+  { 3316, 1457, 5, 2, 0 },
+  { 3321, 1459, 12, 3, 0 },
+  { 3333, 1462, 5, 3, 0 },
+  { 3338, 1465, 4, 6, 0 },
+  { 3342, 1471, 3, 3, 0 },
+  { 3345, 1474, 4, 3, 0 },
+  { 3349, 1477, 2, 3, 0 },
+  { 3351, 1480, 4, 1, 0 },
+  { 3355, 1481, 6, 3, 0 },
+  { 3361, 1484, 6, 2, 0 },
+  { 3367, 1486, 6, 3, 0 },
+  { 3373, 1489, 5, 6, 0 },
+  { 3378, 1495, 3, 1, 0 },
+  { 3381, 1496, 6, 2, 0 },
+  { 3387, 1498, 4, 3, 0 },
+  { 3391, 1501, 6, 3, 0 },
+  { 3397, 1504, 4, 6, 0 },
+  { 3401, 1510, 2, 3, 0 },
+  { 3403, 1513, 10, 3, 0 },
+  { 3413, 1516, 5, 2, 0 },
+  { 3418, 1518, 3, 3, 0 },
+  { 3421, 1521, 6, 3, 0 },
+  { 3427, 1524, 15, 3, 0 },
+  { 3442, 1527, 6, 1, 0 },
+  { 3448, 1528, 6, 2, 0 },
+  { 3454, 1530, 3, 4, 0 },
+  { 3457, 1534, 3, 1, 0 },
+  { 3460, 1535, 7, 6, 0 },
+  { 3467, 1541, 6, 2, 0 },
+  { 3473, 1543, 4, 2, 0 },
+  { 3477, 1545, 15, 3, 0 },
+  { 3492, 1548, 3, 3, 0 },
+  { 3495, 1551, 6, 3, 0 },
+  { 3501, 1554, 4, 2, 0 },
+  { 3505, 1556, 6, 3, 0 },
+  { 3511, 1559, 6, 3, 0 },
+  { 3517, 1562, 6, 3, 0 },
+  { 3523, 1565, 5, 2, 0 },
+  { 3528, 1567, 5, 3, 0 },
+  { 3533, 1570, 10, 3, 0 },
+  { 3543, 1573, 6, 3, 0 },
+  { 3549, 1576, 14, 3, 0 },
+  { 3563, 1579, 3, 4, 0 },
+  { 3566, 1583, 4, 2, 0 },
+  { 3570, 1585, 3, 4, 0 },
+  { 3573, 1589, 5, 2, 0 },
+  { 3578, 1591, 8, 3, 0 },
+  { 3586, 1594, 8, 3, 0 },
+  { 3594, 1597, 15, 3, 0 },
+  { 3609, 1600, 4, 3, 0 },
+  { 3613, 1603, 14, 3, 0 },
+  { 3627, 1606, 11, 3, 0 },
+  { 3638, 1609, 2, 3, 0 },
+  { 3640, 1612, 18, 3, 0 },
+  { 3658, 1615, 5, 2, 0 },
+  { 3663, 1617, 6, 3, 0 },
+  { 3669, 1620, 6, 3, 0 },
+  { 3675, 1623, 6, 3, 0 },
+  { 3681, 1626, 6, 3, 0 },
+  { 3687, 1629, 4, 3, 0 },
+  { 3691, 1632, 4, 3, 0 },
+  { 3695, 1635, 3, 3, 0 },
+  { 3698, 1638, 3, 4, 0 },
+  { 3701, 1642, 6, 2, 0 },
+  { 3707, 1644, 4, 3, 0 },
+  { 3711, 1647, 9, 3, 0 },
+  { 3720, 1650, 8, 3, 0 },
+  { 3728, 1653, 6, 3, 0 },
+  { 3734, 1656, 7, 3, 0 },
+  { 3741, 1659, 10, 2, 0 },
+  { 3751, 1661, 8, 3, 0 },
+  { 3759, 1664, 13, 3, 0 },
+  { 3772, 1667, 8, 3, 0 },
+  { 3780, 1670, 3, 3, 0 },
+  { 3783, 1673, 8, 3, 0 },
+  { 3791, 1676, 17, 3, 0 },
+  { 3808, 1679, 4, 3, 0 },
+  { 3812, 1682, 5, 3, 0 },
+  { 3817, 1685, 5, 3, 0 },
+  { 3822, 1688, 5, 3, 0 },
+  { 3827, 1691, 8, 3, 0 },
+  { 3835, 1694, 2, 3, 0 },
+  { 3837, 1697, 6, 3, 0 },
+  { 3843, 1700, 8, 3, 0 },
+  { 3851, 1703, 5, 3, 0 },
+  { 3856, 1706, 4, 4, 0 },
+  { 3860, 1710, 4, 4, 0 },
+  { 3864, 1714, 10, 3, 0 },
+  { 3874, 1717, 4, 4, 0 },
+  { 3878, 1721, 5, 3, 0 },
+  { 3883, 1724, 9, 3, 0 },
+  { 3892, 1727, 9, 3, 0 },
+  { 3901, 1730, 16, 3, 0 },
+  { 3917, 1733, 3, 3, 0 },
+  { 3920, 1736, 5, 2, 0 },
+  { 3925, 1738, 5, 3, 0 },
+  { 3930, 1741, 6, 3, 0 },
+  { 3936, 1744, 16, 2, 0 },
+  { 3952, 1746, 9, 3, 0 },
+  { 3961, 1749, 9, 3, 0 },
+  { 3970, 1752, 5, 3, 0 },
+  { 3975, 1755, 3, 2, 0 },
+  { 3978, 1757, 12, 3, 0 },
+  { 3990, 1760, 4, 3, 0 },
+  { 3994, 1763, 7, 3, 0 },
+  { 4001, 1766, 7, 3, 0 },
+  { 4008, 1769, 3, 3, 0 },
+  { 4011, 1772, 7, 3, 0 },
+  { 4018, 1775, 7, 3, 0 },
+  { 4025, 1778, 8, 3, 0 },
+  { 4033, 1781, 4, 4, 0 },
+  { 4037, 1785, 4, 2, 0 },
+  { 4041, 1787, 11, 3, 0 },
+  { 4052, 1790, 16, 3, 0 },
+  { 4068, 1793, 5, 6, 0 },
+  { 4073, 1799, 7, 3, 0 },
+  { 4080, 1802, 5, 3, 0 },
+  { 4085, 1805, 11, 3, 0 },
+  { 4096, 1808, 4, 3, 0 },
+  { 4100, 1811, 18, 5, 0 },
+  { 4118, 1816, 4, 2, 0 },
+  { 4122, 1818, 8, 3, 0 },
+  { 4130, 1821, 5, 3, 0 },
+  { 4135, 1824, 5, 3, 0 },
+  { 4140, 1827, 4, 1, 0 },
+  { 4144, 1828, 7, 3, 0 },
+  { 4151, 1831, 8, 5, 0 },
+  { 4159, 1836, 5, 3, 0 },
+  { 4164, 1839, 13, 3, 0 },
+  { 4177, 1842, 6, 3, 0 },
+  { 4183, 1845, 5, 3, 0 },
+  { 4188, 1848, 14, 3, 0 },
+  { 4202, 1851, 7, 3, 0 },
+  { 4209, 1854, 6, 3, 0 },
+  { 4215, 1857, 7, 3, 0 },
+  { 4222, 1860, 4, 2, 0 },
+  { 4226, 1862, 10, 3, 0 },
+  { 4236, 1865, 6, 3, 0 },
+  { 4242, 1868, 8, 3, 0 },
+  { 4250, 1871, 17, 3, 0 },
+  { 4267, 1874, 3, 3, 0 },
+  { 4270, 1877, 14, 3, 0 },
+  { 4284, 1880, 3, 2, 0 },
+  { 4287, 1882, 5, 3, 0 },
+  { 4292, 1885, 4, 4, 0 },
+  { 4296, 1889, 16, 3, 0 },
+  { 4312, 1892, 9, 3, 0 },
+  { 4321, 1895, 4, 3, 0 },
+  { 4325, 1898, 4, 3, 0 },
+  { 4329, 1901, 5, 3, 0 },
+  { 4334, 1904, 6, 3, 0 },
+  { 4340, 1907, 16, 3, 0 },
+  { 4356, 1910, 14, 3, 0 },
+  { 4370, 1913, 6, 3, 0 },
+  { 4376, 1916, 6, 2, 0 },
+  { 4382, 1918, 8, 2, 0 },
+  { 4390, 1920, 4, 3, 0 },
+  { 4394, 1923, 12, 3, 0 },
+  { 4406, 1926, 4, 3, 0 },
+  { 4410, 1929, 14, 3, 0 },
+  { 4424, 1932, 4, 3, 0 },
+  { 4428, 1935, 11, 3, 0 },
+  { 4439, 1938, 6, 3, 0 },
+  { 4445, 1941, 5, 5, 0 },
+  { 4450, 1946, 5, 3, 0 },
+  { 4455, 1949, 4, 4, 0 },
+  { 4459, 1953, 6, 3, 0 },
+  { 4465, 1956, 4, 3, 0 },
+  { 4469, 1959, 5, 3, 0 },
+  { 4474, 1962, 6, 3, 0 },
+  { 4480, 1965, 5, 2, 0 },
+  { 4485, 1967, 3, 2, 0 },
+  { 4488, 1969, 6, 3, 0 },
+  { 4494, 1972, 6, 3, 0 },
+  { 4500, 1975, 8, 3, 0 },
+  { 4508, 1978, 6, 2, 0 },
+  { 4514, 1980, 2, 3, 0 },
+  { 4516, 1983, 4, 4, 0 },
+  { 4520, 1987, 13, 3, 0 },
+  { 4533, 1990, 4, 2, 0 },
+  { 4537, 1992, 6, 3, 0 },
+  { 4543, 1995, 2, 3, 0 },
+  { 4545, 1998, 3, 4, 0 },
+  { 4548, 2002, 5, 2, 0 },
+  { 4553, 2004, 5, 3, 0 },
+  { 4558, 2007, 5, 2, 0 },
+  { 4563, 2009, 8, 3, 0 },
+  { 4571, 2012, 5, 2, 0 },
+  { 4576, 2014, 6, 2, 0 },
+  { 4582, 2016, 6, 3, 0 },
+  { 4588, 2019, 3, 4, 0 },
+  { 4591, 2023, 13, 3, 0 },
+  { 4604, 2026, 18, 3, 0 },
+  { 4622, 2029, 5, 3, 0 },
+  { 4627, 2032, 6, 2, 0 },
+  { 4633, 2034, 18, 3, 0 },
+  { 4651, 2037, 4, 2, 0 },
+  { 4655, 2039, 8, 3, 0 },
+  { 4663, 2042, 5, 2, 0 },
+  { 4668, 2044, 8, 3, 0 },
+  { 4676, 2047, 7, 3, 0 },
+  { 4683, 2050, 4, 3, 0 },
+  { 4687, 2053, 5, 3, 0 },
+  { 4692, 2056, 5, 3, 0 },
+  { 4697, 2059, 6, 2, 0 },
+  { 4703, 2061, 5, 3, 0 },
+  { 4708, 2064, 7, 2, 0 },
+  { 4715, 2066, 5, 2, 0 },
+  { 4720, 2068, 9, 3, 0 },
+  { 4729, 2071, 4, 2, 0 },
+  { 4733, 2073, 5, 3, 0 },
+  { 4738, 2076, 6, 3, 0 },
+  { 4744, 2079, 7, 3, 0 },
+  { 4751, 2082, 10, 3, 0 },
+  { 4761, 2085, 15, 3, 0 },
+  { 4776, 2088, 4, 2, 0 },
+  { 4780, 2090, 7, 3, 0 },
+  { 4787, 2093, 5, 3, 0 },
+  { 4792, 2096, 4, 2, 0 },
+  { 4796, 2098, 6, 2, 0 },
+  { 4802, 2100, 5, 3, 0 },
+  { 4807, 2103, 13, 3, 0 },
+  { 4820, 2106, 17, 3, 0 },
+  { 4837, 2109, 6, 3, 0 },
+  { 4843, 2112, 6, 3, 0 },
+  { 4849, 2115, 6, 3, 0 },
+  { 4855, 2118, 3, 2, 0 },
+  { 4858, 2120, 3, 3, 0 },
+  { 4861, 2123, 6, 2, 0 },
+  { 4867, 2125, 4, 3, 0 },
+  { 4871, 2128, 10, 3, 0 },
+  { 4881, 2131, 9, 3, 0 },
+  { 4890, 2134, 6, 2, 0 },
+  { 4896, 2136, 5, 3, 0 },
+  { 4901, 2139, 5, 3, 0 },
+  { 4906, 2142, 7, 3, 0 },
+  { 4913, 2145, 5, 2, 0 },
+  { 4918, 2147, 5, 3, 0 },
+  { 4923, 2150, 3, 2, 0 },
+  { 4926, 2152, 5, 5, 0 },
+  { 4931, 2157, 5, 3, 0 },
+  { 4936, 2160, 4, 3, 0 },
+  { 4940, 2163, 6, 1, 0 },
+  { 4946, 2164, 6, 3, 0 },
+  { 4952, 2167, 5, 3, 0 },
+  { 4957, 2170, 9, 3, 0 },
+  { 4966, 2173, 3, 2, 0 },
+  { 4969, 2175, 5, 3, 0 },
+  { 4974, 2178, 9, 3, 0 },
+  { 4983, 2181, 2, 1, 1 },
+  { 4985, 2182, 14, 3, 0 },
+  { 4999, 2185, 6, 3, 0 },
+  { 5005, 2188, 6, 3, 0 },
+  { 5011, 2191, 14, 3, 0 },
+  { 5025, 2194, 17, 3, 0 },
+  { 5042, 2197, 6, 3, 0 },
+  { 5048, 2200, 6, 3, 0 },
+  { 5054, 2203, 5, 3, 0 },
+  { 5059, 2206, 7, 3, 0 },
+  { 5066, 2209, 6, 3, 0 },
+  { 5072, 2212, 6, 3, 0 },
+  { 5078, 2215, 4, 3, 0 },
+  { 5082, 2218, 8, 3, 0 },
+  { 5090, 2221, 6, 3, 0 },
+  { 5096, 2224, 5, 3, 0 },
+  { 5101, 2227, 2, 1, 1 },
+  { 5103, 2228, 9, 3, 0 },
+  { 5112, 2231, 5, 3, 0 },
+  { 5117, 2234, 4, 2, 0 },
+  { 5121, 2236, 3, 2, 0 },
+  { 5124, 2238, 14, 3, 0 },
+  { 5138, 2241, 12, 3, 0 },
+  { 5150, 2244, 8, 3, 0 },
+  { 5158, 2247, 6, 3, 0 },
+  { 5164, 2250, 3, 4, 0 },
+  { 5167, 2254, 4, 5, 0 },
+  { 5171, 2259, 6, 2, 0 },
+  { 5177, 2261, 4, 2, 0 },
+  { 5181, 2263, 8, 3, 0 },
+  { 5189, 2266, 4, 4, 0 },
+  { 5193, 2270, 3, 3, 0 },
+  { 5196, 2273, 3, 3, 0 },
+  { 5199, 2276, 5, 3, 0 },
+  { 5204, 2279, 4, 3, 0 },
+  { 5208, 2282, 5, 3, 0 },
+  { 5213, 2285, 4, 1, 0 },
+  { 5217, 2286, 6, 2, 0 },
+  { 5223, 2288, 7, 2, 0 },
+  { 5230, 2290, 4, 3, 0 },
+  { 5234, 2293, 7, 3, 0 },
+  { 5241, 2296, 9, 3, 0 },
+  { 5250, 2299, 4, 4, 0 },
+  { 5254, 2303, 3, 3, 0 },
+  { 5257, 2306, 6, 3, 0 },
+  { 5263, 2309, 5, 3, 0 },
+  { 5268, 2312, 14, 3, 0 },
+  { 5282, 2315, 4, 2, 0 },
+  { 5286, 2317, 5, 2, 0 },
+  { 5291, 2319, 5, 3, 0 },
+  { 5296, 2322, 15, 3, 0 },
+  { 5311, 2325, 4, 6, 0 },
+  { 5315, 2331, 10, 3, 0 },
+  { 5325, 2334, 3, 2, 0 },
+  { 5328, 2336, 3, 2, 0 },
+  { 5331, 2338, 15, 3, 0 },
+  { 5346, 2341, 8, 3, 0 },
+  { 5354, 2344, 7, 3, 0 },
+  { 5361, 2347, 4, 4, 0 },
+  { 5365, 2351, 20, 3, 0 },
+  { 5385, 2354, 3, 3, 0 },
+  { 5388, 2357, 5, 2, 0 },
+  { 5393, 2359, 8, 2, 0 },
+  { 5401, 2361, 7, 3, 0 },
+  { 5408, 2364, 6, 3, 0 },
+  { 5414, 2367, 4, 3, 0 },
+  { 5418, 2370, 19, 5, 0 },
+  { 5437, 2375, 5, 3, 0 },
+  { 5442, 2378, 5, 2, 0 },
+  { 5447, 2380, 6, 3, 0 },
+  { 5453, 2383, 3, 2, 0 },
+  { 5456, 2385, 4, 2, 0 },
+  { 5460, 2387, 8, 3, 0 },
+  { 5468, 2390, 5, 3, 0 },
+  { 5473, 2393, 2, 3, 0 },
+  { 5475, 2396, 13, 3, 0 },
+  { 5488, 2399, 14, 3, 0 },
+  { 5502, 2402, 17, 3, 0 },
+  { 5519, 2405, 7, 3, 0 },
+  { 5526, 2408, 6, 3, 0 },
+  { 5532, 2411, 15, 3, 0 },
+  { 5547, 2414, 9, 3, 0 },
+  { 5556, 2417, 6, 2, 0 },
+  { 5562, 2419, 7, 3, 0 },
+  { 5569, 2422, 5, 3, 0 },
+  { 5574, 2425, 5, 2, 0 },
+  { 5579, 2427, 6, 3, 0 },
+  { 5585, 2430, 15, 3, 0 },
+  { 5600, 2433, 6, 3, 0 },
+  { 5606, 2436, 6, 3, 0 },
+  { 5612, 2439, 6, 2, 0 },
+  { 5618, 2441, 5, 3, 0 },
+  { 5623, 2444, 4, 5, 0 },
+  { 5627, 2449, 4, 2, 0 },
+  { 5631, 2451, 6, 3, 0 },
+  { 5637, 2454, 16, 3, 0 },
+  { 5653, 2457, 21, 3, 0 },
+  { 5674, 2460, 4, 3, 0 },
+  { 5678, 2463, 16, 3, 0 },
+  { 5694, 2466, 17, 3, 0 },
+  { 5711, 2469, 8, 3, 0 },
+  { 5719, 2472, 5, 1, 0 },
+  { 5724, 2473, 7, 3, 0 },
+  { 5731, 2476, 3, 2, 0 },
+  { 5734, 2478, 6, 3, 0 },
+  { 5740, 2481, 6, 3, 0 },
+  { 5746, 2484, 6, 3, 0 },
+  { 5752, 2487, 4, 3, 0 },
+  { 5756, 2490, 6, 3, 0 },
+  { 5762, 2493, 3, 2, 0 },
+  { 5765, 2495, 8, 3, 0 },
+  { 5773, 2498, 8, 3, 0 },
+  { 5781, 2501, 6, 3, 0 },
+  { 5787, 2504, 5, 3, 0 },
+  { 5792, 2507, 5, 3, 0 },
+  { 5797, 2510, 4, 4, 0 },
+  { 5801, 2514, 4, 3, 0 },
+  { 5805, 2517, 2, 3, 0 },
+  { 5807, 2520, 11, 2, 0 },
+  { 5818, 2522, 14, 3, 0 },
+  { 5832, 2525, 9, 3, 0 },
+  { 5841, 2528, 5, 3, 0 },
+  { 5846, 2531, 2, 3, 0 },
+  { 5848, 2534, 5, 2, 0 },
+  { 5853, 2536, 6, 3, 0 },
+  { 5859, 2539, 10, 3, 0 },
+  { 5869, 2542, 4, 3, 0 },
+  { 5873, 2545, 20, 3, 0 },
+  { 5893, 2548, 5, 2, 0 },
+  { 5898, 2550, 9, 6, 0 },
+  { 5907, 2556, 7, 3, 0 },
+  { 5914, 2559, 6, 3, 0 },
+  { 5920, 2562, 7, 3, 0 },
+  { 5927, 2565, 3, 1, 0 },
+  { 5930, 2566, 4, 3, 0 },
+  { 5934, 2569, 3, 6, 0 },
+  { 5937, 2575, 10, 3, 0 },
+  { 5947, 2578, 6, 3, 0 },
+  { 5953, 2581, 6, 3, 0 },
+  { 5959, 2584, 4, 3, 0 },
+  { 5963, 2587, 3, 5, 0 },
+  { 5966, 2592, 6, 3, 0 },
+  { 5972, 2595, 17, 3, 0 },
+  { 5989, 2598, 17, 3, 0 },
+  { 6006, 2601, 7, 3, 0 },
+  { 6013, 2604, 5, 3, 0 },
+  { 6018, 2607, 5, 2, 0 },
+  { 6023, 2609, 4, 3, 0 },
+  { 6027, 2612, 3, 3, 0 },
+  { 6030, 2615, 6, 2, 0 },
+  { 6036, 2617, 6, 3, 0 },
+  { 6042, 2620, 6, 3, 0 },
+  { 6048, 2623, 8, 3, 0 },
+  { 6056, 2626, 16, 3, 0 },
+  { 6072, 2629, 4, 3, 0 },
+  { 6076, 2632, 3, 2, 0 },
+  { 6079, 2634, 6, 2, 0 },
+  { 6085, 2636, 7, 3, 0 },
+  { 6092, 2639, 14, 3, 0 },
+  { 6106, 2642, 3, 4, 0 },
+  { 6109, 2646, 4, 2, 0 },
+  { 6113, 2648, 6, 2, 0 },
+  { 6119, 2650, 6, 2, 0 },
+  { 6125, 2652, 6, 3, 0 },
+  { 6131, 2655, 2, 3, 0 },
+  { 6133, 2658, 5, 2, 0 },
+  { 6138, 2660, 9, 3, 0 },
+  { 6147, 2663, 2, 3, 0 },
+  { 6149, 2666, 4, 3, 0 },
+  { 6153, 2669, 5, 3, 0 },
+  { 6158, 2672, 4, 3, 0 },
+  { 6162, 2675, 3, 4, 0 },
+  { 6165, 2679, 12, 3, 0 },
+  { 6177, 2682, 13, 3, 0 },
+  { 6190, 2685, 16, 3, 0 },
+  { 6206, 2688, 5, 3, 0 },
+  { 6211, 2691, 12, 3, 0 },
+  { 6223, 2694, 11, 3, 0 },
+  { 6234, 2697, 4, 4, 0 },
+  { 6238, 2701, 3, 2, 0 },
+  { 6241, 2703, 5, 2, 0 },
+  { 6246, 2705, 5, 2, 0 },
+  { 6251, 2707, 3, 3, 0 },
+  { 6254, 2710, 6, 3, 0 },
+  { 6260, 2713, 6, 2, 0 },
+  { 6266, 2715, 4, 3, 0 },
+  { 6270, 2718, 3, 2, 0 },
+  { 6273, 2720, 18, 3, 0 },
+  { 6291, 2723, 6, 3, 0 },
+  { 6297, 2726, 5, 3, 0 },
+  { 6302, 2729, 8, 3, 0 },
+  { 6310, 2732, 5, 3, 0 },
+  { 6315, 2735, 5, 3, 0 },
+  { 6320, 2738, 4, 4, 0 },
+  { 6324, 2742, 5, 2, 0 },
+  { 6329, 2744, 5, 3, 0 },
+  { 6334, 2747, 6, 2, 0 },
+  { 6340, 2749, 5, 3, 0 },
+  { 6345, 2752, 4, 4, 0 },
+  { 6349, 2756, 4, 3, 0 },
+  { 6353, 2759, 5, 3, 0 },
+  { 6358, 2762, 4, 3, 0 },
+  { 6362, 2765, 6, 3, 0 },
+  { 6368, 2768, 5, 3, 0 },
+  { 6373, 2771, 8, 3, 0 },
+  { 6381, 2774, 6, 3, 0 },
+  { 6387, 2777, 4, 2, 0 },
+  { 6391, 2779, 4, 4, 0 },
+  { 6395, 2783, 4, 3, 0 },
+  { 6399, 2786, 6, 3, 0 },
+  { 6405, 2789, 3, 3, 0 },
+  { 6408, 2792, 7, 3, 0 },
+  { 6415, 2795, 4, 4, 0 },
+  { 6419, 2799, 11, 3, 0 },
+  { 6430, 2802, 7, 5, 0 },
+  { 6437, 2807, 14, 3, 0 },
+  { 6451, 2810, 4, 3, 0 },
+  { 6455, 2813, 4, 3, 0 },
+  { 6459, 2816, 7, 3, 0 },
+  { 6466, 2819, 5, 3, 0 },
+  { 6471, 2822, 3, 4, 0 },
+  { 6474, 2826, 6, 3, 0 },
+  { 6480, 2829, 13, 5, 0 },
+  { 6493, 2834, 4, 6, 0 },
+  { 6497, 2840, 6, 3, 0 },
+  { 6503, 2843, 5, 3, 0 },
+  { 6508, 2846, 6, 3, 0 },
+  { 6514, 2849, 5, 3, 0 },
+  { 6519, 2852, 5, 3, 0 },
+  { 6524, 2855, 6, 2, 0 },
+  { 6530, 2857, 4, 6, 0 },
+  { 6534, 2863, 6, 6, 0 },
+  { 6540, 2869, 2, 3, 0 },
+  { 6542, 2872, 5, 3, 0 },
+  { 6547, 2875, 6, 3, 0 },
+  { 6553, 2878, 8, 3, 0 },
+  { 6561, 2881, 19, 3, 0 },
+  { 6580, 2884, 6, 3, 0 },
+  { 6586, 2887, 7, 3, 0 },
+  { 6593, 2890, 4, 3, 0 },
+  { 6597, 2893, 5, 3, 0 },
+  { 6602, 2896, 4, 2, 0 },
+  { 6606, 2898, 7, 3, 0 },
+  { 6613, 2901, 6, 3, 0 },
+  { 6619, 2904, 10, 3, 0 },
+  { 6629, 2907, 18, 3, 0 },
+  { 6647, 2910, 5, 3, 0 },
+  { 6652, 2913, 5, 3, 0 },
+  { 6657, 2916, 6, 3, 0 },
+  { 6663, 2919, 3, 3, 0 },
+  { 6666, 2922, 6, 3, 0 },
+  { 6672, 2925, 15, 3, 0 },
+  { 6687, 2928, 8, 3, 0 },
+  { 6695, 2931, 4, 3, 0 },
+  { 6699, 2934, 11, 2, 0 },
+  { 6710, 2936, 4, 4, 0 },
+  { 6714, 2940, 7, 3, 0 },
+  { 6721, 2943, 4, 2, 0 },
+  { 6725, 2945, 5, 3, 0 },
+  { 6730, 2948, 5, 2, 0 },
+  { 6735, 2950, 4, 3, 0 },
+  { 6739, 2953, 9, 6, 0 },
+  { 6748, 2959, 3, 4, 0 },
+  { 6751, 2963, 15, 3, 0 },
+  { 6766, 2966, 18, 3, 0 },
+  { 6784, 2969, 10, 3, 0 },
+  { 6794, 2972, 4, 3, 0 },
+  { 6798, 2975, 6, 3, 0 },
+  { 6804, 2978, 4, 2, 0 },
+  { 6808, 2980, 3, 5, 0 },
+  { 6811, 2985, 15, 3, 0 },
+  { 6826, 2988, 7, 3, 0 },
+  { 6833, 2991, 7, 3, 0 },
+  { 6840, 2994, 2, 3, 0 },
+  { 6842, 2997, 5, 2, 0 },
+  { 6847, 2999, 6, 5, 0 },
+  { 6853, 3004, 6, 3, 0 },
+  { 6859, 3007, 5, 3, 0 },
+  { 6864, 3010, 2, 2, 0 },
+  { 6866, 3012, 3, 5, 0 },
+  { 6869, 3017, 13, 3, 0 },
+  { 6882, 3020, 4, 2, 0 },
+  { 6886, 3022, 7, 6, 0 },
+  { 6893, 3028, 8, 3, 0 },
+  { 6901, 3031, 5, 2, 0 },
+  { 6906, 3033, 5, 3, 0 },
+  { 6911, 3036, 4, 2, 0 },
+  { 6915, 3038, 18, 3, 0 },
+  { 6933, 3041, 18, 3, 0 },
+  { 6951, 3044, 6, 3, 0 },
+  { 6957, 3047, 13, 3, 0 },
+  { 6970, 3050, 7, 3, 0 },
+  { 6977, 3053, 7, 3, 0 },
+  { 6984, 3056, 4, 4, 0 },
+  { 6988, 3060, 6, 3, 0 },
+  { 6994, 3063, 4, 3, 0 },
+  { 6998, 3066, 5, 3, 0 },
+  { 7003, 3069, 6, 3, 0 },
+  { 7009, 3072, 5, 3, 0 },
+  { 7014, 3075, 20, 3, 0 },
+  { 7034, 3078, 5, 2, 0 },
+  { 7039, 3080, 9, 3, 0 },
+  { 7048, 3083, 5, 2, 0 },
+  { 7053, 3085, 6, 3, 0 },
+  { 7059, 3088, 5, 3, 0 },
+  { 7064, 3091, 6, 2, 0 },
+  { 7070, 3093, 8, 3, 0 },
+  { 7078, 3096, 16, 3, 0 },
+  { 7094, 3099, 15, 5, 0 },
+  { 7109, 3104, 6, 3, 0 },
+  { 7115, 3107, 5, 2, 0 },
+  { 7120, 3109, 4, 2, 0 },
+  { 7124, 3111, 6, 3, 0 },
+  { 7130, 3114, 4, 4, 0 },
+  { 7134, 3118, 3, 3, 0 },
+  { 7137, 3121, 6, 1, 0 },
+  { 7143, 3122, 6, 3, 0 },
+  { 7149, 3125, 4, 4, 0 },
+  { 7153, 3129, 4, 4, 0 },
+  { 7157, 3133, 10, 5, 0 },
+  { 7167, 3138, 4, 4, 0 },
+  { 7171, 3142, 5, 3, 0 },
+  { 7176, 3145, 3, 4, 0 },
+  { 7179, 3149, 5, 2, 0 },
+  { 7184, 3151, 24, 3, 0 },
+  { 7208, 3154, 5, 3, 0 },
+  { 7213, 3157, 5, 3, 0 },
+  { 7218, 3160, 3, 3, 0 },
+  { 7221, 3163, 2, 3, 0 },
+  { 7223, 3166, 4, 3, 0 },
+  { 7227, 3169, 4, 2, 0 },
+  { 7231, 3171, 6, 3, 0 },
+  { 7237, 3174, 5, 3, 0 },
+  { 7242, 3177, 18, 3, 0 },
+  { 7260, 3180, 3, 2, 0 },
+  { 7263, 3182, 4, 4, 0 },
+  { 7267, 3186, 5, 3, 0 },
+  { 7272, 3189, 13, 3, 0 },
+  { 7285, 3192, 8, 3, 0 },
+  { 7293, 3195, 3, 3, 0 },
+  { 7296, 3198, 6, 2, 0 },
+  { 7302, 3200, 5, 3, 0 },
+  { 7307, 3203, 5, 3, 0 },
+  { 7312, 3206, 4, 3, 0 },
+  { 7316, 3209, 4, 3, 0 },
+  { 7320, 3212, 5, 3, 0 },
+  { 7325, 3215, 4, 2, 0 },
+  { 7329, 3217, 4, 3, 0 },
+  { 7333, 3220, 6, 2, 0 },
+  { 7339, 3222, 6, 1, 0 },
+  { 7345, 3223, 6, 2, 0 },
+  { 7351, 3225, 3, 2, 0 },
+  { 7354, 3227, 6, 2, 0 },
+  { 7360, 3229, 4, 3, 0 },
+  { 7364, 3232, 5, 3, 0 },
+  { 7369, 3235, 5, 3, 0 },
+  { 7374, 3238, 6, 3, 0 },
+  { 7380, 3241, 5, 3, 0 },
+  { 7385, 3244, 6, 3, 0 },
+  { 7391, 3247, 5, 5, 0 },
+  { 7396, 3252, 6, 3, 0 },
+  { 7402, 3255, 5, 2, 0 },
+  { 7407, 3257, 17, 3, 0 },
+  { 7424, 3260, 7, 3, 0 },
+  { 7431, 3263, 11, 3, 0 },
+  { 7442, 3266, 5, 3, 0 },
+  { 7447, 3269, 3, 5, 0 },
+  { 7450, 3274, 15, 3, 0 },
+  { 7465, 3277, 6, 3, 0 },
+  { 7471, 3280, 8, 2, 0 },
+  { 7479, 3282, 6, 2, 0 },
+  { 7485, 3284, 4, 3, 0 },
+  { 7489, 3287, 6, 3, 0 },
+  { 7495, 3290, 16, 3, 0 },
+  { 7511, 3293, 5, 3, 0 },
+  { 7516, 3296, 5, 2, 0 },
+  { 7521, 3298, 8, 3, 0 },
+  { 7529, 3301, 7, 3, 0 },
+  { 7536, 3304, 4, 2, 0 },
+  { 7540, 3306, 3, 4, 0 },
+  { 7543, 3310, 8, 3, 0 },
+  { 7551, 3313, 4, 4, 0 },
+  { 7555, 3317, 16, 2, 0 },
+  { 7571, 3319, 9, 3, 0 },
+  { 7580, 3322, 3, 2, 0 },
+  { 7583, 3324, 6, 3, 0 },
+  { 7589, 3327, 4, 4, 0 },
+  { 7593, 3331, 5, 3, 0 },
+  { 7598, 3334, 7, 3, 0 },
+  { 7605, 3337, 8, 3, 0 },
+  { 7613, 3340, 4, 3, 0 },
+  { 7617, 3343, 3, 4, 0 },
+  { 7620, 3347, 6, 2, 0 },
+  { 7626, 3349, 3, 3, 0 },
+  { 7629, 3352, 3, 3, 0 },
+  { 7632, 3355, 3, 3, 0 },
+  { 7635, 3358, 4, 3, 0 },
+  { 7639, 3361, 4, 4, 0 },
+  { 7643, 3365, 5, 2, 0 },
+  { 7648, 3367, 7, 3, 0 },
+  { 7655, 3370, 4, 2, 0 },
+  { 7659, 3372, 5, 3, 0 },
+  { 7664, 3375, 6, 3, 0 },
+  { 7670, 3378, 4, 2, 0 },
+  { 7674, 3380, 4, 1, 0 },
+  { 7678, 3381, 6, 3, 0 },
+  { 7684, 3384, 11, 3, 0 },
+  { 7695, 3387, 13, 3, 0 },
+  { 7708, 3390, 4, 3, 0 },
+  { 7712, 3393, 5, 3, 0 },
+  { 7717, 3396, 2, 3, 0 },
+  { 7719, 3399, 5, 3, 0 },
+  { 7724, 3402, 7, 3, 0 },
+  { 7731, 3405, 20, 3, 0 },
+  { 7751, 3408, 5, 3, 0 },
+  { 7756, 3411, 7, 3, 0 },
+  { 7763, 3414, 6, 3, 0 },
+  { 7769, 3417, 4, 2, 0 },
+  { 7773, 3419, 5, 3, 0 },
+  { 7778, 3422, 5, 2, 0 },
+  { 7783, 3424, 3, 4, 0 },
+  { 7786, 3428, 7, 3, 0 },
+  { 7793, 3431, 15, 3, 0 },
+  { 7808, 3434, 4, 3, 0 },
+  { 7812, 3437, 6, 3, 0 },
+  { 7818, 3440, 5, 3, 0 },
+  { 7823, 3443, 3, 2, 0 },
+  { 7826, 3445, 4, 5, 0 },
+  { 7830, 3450, 7, 3, 0 },
+  { 7837, 3453, 5, 3, 0 },
+  { 7842, 3456, 4, 4, 0 },
+  { 7846, 3460, 5, 2, 0 },
+  { 7851, 3462, 5, 3, 0 },
+  { 7856, 3465, 17, 3, 0 },
+  { 7873, 3468, 5, 2, 0 },
+  { 7878, 3470, 9, 3, 0 },
+  { 7887, 3473, 14, 3, 0 },
+  { 7901, 3476, 3, 3, 0 },
+  { 7904, 3479, 6, 3, 0 },
+  { 7910, 3482, 4, 3, 0 },
+  { 7914, 3485, 4, 4, 0 },
+  { 7918, 3489, 18, 3, 0 },
+  { 7936, 3492, 6, 3, 0 },
+  { 7942, 3495, 11, 3, 0 },
+  { 7953, 3498, 6, 3, 0 },
+  { 7959, 3501, 6, 2, 0 },
+  { 7965, 3503, 11, 3, 0 },
+  { 7976, 3506, 5, 2, 0 },
+  { 7981, 3508, 8, 3, 0 },
+  { 7989, 3511, 17, 3, 0 },
+  { 8006, 3514, 5, 3, 0 },
+  { 8011, 3517, 3, 4, 0 },
+  { 8014, 3521, 3, 2, 0 },
+  { 8017, 3523, 3, 2, 0 },
+  { 8020, 3525, 15, 3, 0 },
+  { 8035, 3528, 5, 3, 0 },
+  { 8040, 3531, 4, 2, 0 },
+  { 8044, 3533, 7, 3, 0 },
+  { 8051, 3536, 4, 2, 0 },
+  { 8055, 3538, 3, 3, 0 },
+  { 8058, 3541, 3, 2, 0 },
+  { 8061, 3543, 5, 2, 0 },
+  { 8066, 3545, 8, 3, 0 },
+  { 8074, 3548, 6, 3, 0 },
+  { 8080, 3551, 3, 2, 0 },
+  { 8083, 3553, 8, 3, 0 },
+  { 8091, 3556, 5, 3, 0 },
+  { 8096, 3559, 4, 2, 0 },
+  { 8100, 3561, 4, 2, 0 },
+  { 8104, 3563, 10, 3, 0 },
+  { 8114, 3566, 6, 2, 0 },
+  { 8120, 3568, 4, 4, 0 },
+  { 8124, 3572, 4, 5, 0 },
+  { 8128, 3577, 6, 2, 0 },
+  { 8134, 3579, 13, 3, 0 },
+  { 8147, 3582, 6, 3, 0 },
+  { 8153, 3585, 8, 3, 0 },
+  { 8161, 3588, 4, 3, 0 },
+  { 8165, 3591, 6, 3, 0 },
+  { 8171, 3594, 5, 3, 0 },
+  { 8176, 3597, 13, 3, 0 },
+  { 8189, 3600, 5, 3, 0 },
+  { 8194, 3603, 4, 3, 0 },
+  { 8198, 3606, 4, 3, 0 },
+  { 8202, 3609, 5, 3, 0 },
+  { 8207, 3612, 4, 3, 0 },
+  { 8211, 3615, 3, 3, 0 },
+  { 8214, 3618, 6, 2, 0 },
+  { 8220, 3620, 4, 2, 0 },
+  { 8224, 3622, 3, 3, 0 },
+  { 8227, 3625, 7, 6, 0 },
+  { 8234, 3631, 5, 3, 0 },
+  { 8239, 3634, 7, 3, 0 },
+  { 8246, 3637, 5, 3, 0 },
+  { 8251, 3640, 4, 4, 0 },
+  { 8255, 3644, 5, 3, 0 },
+  { 8260, 3647, 7, 3, 0 },
+  { 8267, 3650, 6, 3, 0 },
+  { 8273, 3653, 6, 2, 0 },
+  { 8279, 3655, 4, 4, 0 },
+  { 8283, 3659, 9, 3, 0 },
+  { 8292, 3662, 8, 2, 0 },
+  { 8300, 3664, 4, 3, 0 },
+  { 8304, 3667, 3, 4, 0 },
+  { 8307, 3671, 5, 3, 0 },
+  { 8312, 3674, 13, 3, 0 },
+  { 8325, 3677, 5, 2, 0 },
+  { 8330, 3679, 4, 2, 0 },
+  { 8334, 3681, 3, 4, 0 },
+  { 8337, 3685, 4, 3, 0 },
+  { 8341, 3688, 5, 3, 0 },
+  { 8346, 3691, 6, 3, 0 },
+  { 8352, 3694, 16, 3, 0 },
+  { 8368, 3697, 18, 3, 0 },
+  { 8386, 3700, 3, 2, 0 },
+  { 8389, 3702, 20, 3, 0 },
+  { 8409, 3705, 8, 3, 0 },
+  { 8417, 3708, 3, 2, 0 },
+  { 8420, 3710, 13, 3, 0 },
+  { 8433, 3713, 11, 3, 0 },
+  { 8444, 3716, 6, 3, 0 },
+  { 8450, 3719, 16, 3, 0 },
+  { 8466, 3722, 17, 3, 0 },
+  { 8483, 3725, 6, 2, 0 },
+  { 8489, 3727, 6, 3, 0 },
+  { 8495, 3730, 6, 3, 0 },
+  { 8501, 3733, 3, 3, 0 },
+  { 8504, 3736, 4, 1, 0 },
+  { 8508, 3737, 4, 3, 0 },
+  { 8512, 3740, 12, 3, 0 },
+  { 8524, 3743, 6, 2, 0 },
+  { 8530, 3745, 5, 3, 0 },
+  { 8535, 3748, 5, 2, 0 },
+  { 8540, 3750, 4, 3, 0 },
+  { 8544, 3753, 8, 3, 0 },
+  { 8552, 3756, 15, 3, 0 },
+  { 8567, 3759, 2, 3, 0 },
+  { 8569, 3762, 4, 3, 0 },
+  { 8573, 3765, 4, 3, 0 },
+  { 8577, 3768, 4, 3, 0 },
+  { 8581, 3771, 10, 3, 0 },
+  { 8591, 3774, 4, 3, 0 },
+  { 8595, 3777, 7, 3, 0 },
+  { 8602, 3780, 4, 4, 0 },
+  { 8606, 3784, 4, 4, 0 },
+  { 8610, 3788, 6, 3, 0 },
+  { 8616, 3791, 5, 2, 0 },
+  { 8621, 3793, 6, 3, 0 },
+  { 8627, 3796, 9, 3, 0 },
+  { 8636, 3799, 4, 2, 0 },
+  { 8640, 3801, 5, 3, 0 },
+  { 8645, 3804, 5, 3, 0 },
+  { 8650, 3807, 4, 4, 0 },
+  { 8654, 3811, 4, 1, 0 },
+  { 8658, 3812, 6, 2, 0 },
+  { 8664, 3814, 5, 3, 0 },
+  { 8669, 3817, 7, 3, 0 },
+  { 8676, 3820, 5, 3, 0 },
+  { 8681, 3823, 4, 3, 0 },
+  { 8685, 3826, 4, 6, 0 },
+  { 8689, 3832, 8, 3, 0 },
+  { 8697, 3835, 4, 3, 0 },
+  { 8701, 3838, 3, 4, 0 },
+  { 8704, 3842, 5, 2, 0 },
+  { 8709, 3844, 4, 3, 0 },
+  { 8713, 3847, 4, 2, 0 },
+  { 8717, 3849, 5, 3, 0 },
+  { 8722, 3852, 8, 3, 0 },
+  { 8730, 3855, 3, 3, 0 },
+  { 8733, 3858, 4, 2, 0 },
+  { 8737, 3860, 6, 3, 0 },
+  { 8743, 3863, 6, 6, 0 },
+  { 8749, 3869, 3, 3, 0 },
+  { 8752, 3872, 8, 3, 0 },
+  { 8760, 3875, 3, 2, 0 },
+  { 8763, 3877, 5, 3, 0 },
+  { 8768, 3880, 7, 3, 0 },
+  { 8775, 3883, 5, 2, 0 },
+  { 8780, 3885, 4, 3, 0 },
+  { 8784, 3888, 14, 3, 0 },
+  { 8798, 3891, 5, 3, 0 },
+  { 8803, 3894, 4, 5, 0 },
+  { 8807, 3899, 4, 3, 0 },
+  { 8811, 3902, 9, 2, 0 },
+  { 8820, 3904, 5, 3, 0 },
+  { 8825, 3907, 4, 3, 0 },
+  { 8829, 3910, 5, 3, 0 },
+  { 8834, 3913, 3, 3, 0 },
+  { 8837, 3916, 2, 3, 0 },
+  { 8839, 3919, 8, 3, 0 },
+  { 8847, 3922, 5, 2, 0 },
+  { 8852, 3924, 6, 2, 0 },
+  { 8858, 3926, 15, 3, 0 },
+  { 8873, 3929, 12, 3, 0 },
+  { 8885, 3932, 3, 2, 0 },
+  { 8888, 3934, 5, 3, 0 },
+  { 8893, 3937, 4, 3, 0 },
+  { 8897, 3940, 4, 4, 0 },
+  { 8901, 3944, 5, 5, 0 },
+  { 8906, 3949, 6, 3, 0 },
+  { 8912, 3952, 20, 3, 0 },
+  { 8932, 3955, 21, 3, 0 },
+  { 8953, 3958, 6, 3, 0 },
+  { 8959, 3961, 5, 3, 0 },
+  { 8964, 3964, 3, 3, 0 },
+  { 8967, 3967, 4, 3, 0 },
+  { 8971, 3970, 4, 3, 0 },
+  { 8975, 3973, 5, 3, 0 },
+  { 8980, 3976, 5, 3, 0 },
+  { 8985, 3979, 12, 6, 0 },
+  { 8997, 3985, 5, 3, 0 },
+  { 9002, 3988, 5, 3, 0 },
+  { 9007, 3991, 7, 3, 0 },
+  { 9014, 3994, 6, 2, 0 },
+  { 9020, 3996, 5, 2, 0 },
+  { 9025, 3998, 5, 2, 0 },
+  { 9030, 4000, 2, 3, 0 },
+  { 9032, 4003, 4, 3, 0 },
+  { 9036, 4006, 8, 3, 0 },
+  { 9044, 4009, 14, 3, 0 },
+  { 9058, 4012, 6, 2, 0 },
+  { 9064, 4014, 14, 3, 0 },
+  { 9078, 4017, 6, 2, 0 },
+  { 9084, 4019, 4, 4, 0 },
+  { 9088, 4023, 8, 3, 0 },
+  { 9096, 4026, 4, 3, 0 },
+  { 9100, 4029, 8, 3, 0 },
+  { 9108, 4032, 5, 3, 0 },
+  { 9113, 4035, 17, 5, 0 },
+  { 9130, 4040, 3, 2, 0 },
+  { 9133, 4042, 4, 2, 0 },
+  { 9137, 4044, 10, 6, 0 },
+  { 9147, 4050, 5, 3, 0 },
+  { 9152, 4053, 3, 2, 0 },
+  { 9155, 4055, 6, 2, 0 },
+  { 9161, 4057, 15, 3, 0 },
+  { 9176, 4060, 6, 2, 0 },
+  { 9182, 4062, 7, 3, 0 },
+  { 9189, 4065, 6, 2, 0 },
+  { 9195, 4067, 4, 3, 0 },
+  { 9199, 4070, 11, 3, 0 },
+  { 9210, 4073, 7, 3, 0 },
+  { 9217, 4076, 4, 3, 0 },
+  { 9221, 4079, 5, 3, 0 },
+  { 9226, 4082, 3, 3, 0 },
+  { 9229, 4085, 3, 2, 0 },
+  { 9232, 4087, 5, 3, 0 },
+  { 9237, 4090, 8, 3, 0 },
+  { 9245, 4093, 5, 2, 0 },
+  { 9250, 4095, 4, 4, 0 },
+  { 9254, 4099, 4, 5, 0 },
+  { 9258, 4104, 5, 3, 0 },
+  { 9263, 4107, 6, 3, 0 },
+  { 9269, 4110, 4, 3, 0 },
+  { 9273, 4113, 5, 3, 0 },
+  { 9278, 4116, 3, 3, 0 },
+  { 9281, 4119, 3, 4, 0 },
+  { 9284, 4123, 3, 3, 0 },
+  { 9287, 4126, 5, 3, 0 },
+  { 9292, 4129, 2, 3, 0 },
+  { 9294, 4132, 11, 3, 0 },
+  { 9305, 4135, 6, 3, 0 },
+  { 9311, 4138, 4, 3, 0 },
+  { 9315, 4141, 7, 3, 0 },
+  { 9322, 4144, 5, 3, 0 },
+  { 9327, 4147, 5, 3, 0 },
+  { 9332, 4150, 8, 3, 0 },
+  { 9340, 4153, 6, 3, 0 },
+  { 9346, 4156, 4, 3, 0 },
+  { 9350, 4159, 10, 3, 0 },
+  { 9360, 4162, 4, 3, 0 },
+  { 9364, 4165, 6, 2, 0 },
+  { 9370, 4167, 4, 4, 0 },
+  { 9374, 4171, 7, 3, 0 },
+  { 9381, 4174, 4, 3, 0 },
+  { 9385, 4177, 6, 3, 0 },
+  { 9391, 4180, 5, 2, 0 },
+  { 9396, 4182, 15, 3, 0 },
+  { 9411, 4185, 5, 2, 0 },
+  { 9416, 4187, 5, 2, 0 },
+  { 9421, 4189, 5, 3, 0 },
+  { 9426, 4192, 4, 3, 0 },
+  { 9430, 4195, 5, 3, 0 },
+  { 9435, 4198, 4, 3, 0 },
+  { 9439, 4201, 4, 2, 0 },
+  { 9443, 4203, 4, 3, 0 },
+  { 9447, 4206, 19, 3, 0 },
+  { 9466, 4209, 5, 3, 0 },
+  { 9471, 4212, 12, 3, 0 },
+  { 9483, 4215, 6, 2, 0 },
+  { 9489, 4217, 5, 3, 0 },
+  { 9494, 4220, 4, 3, 0 },
+  { 9498, 4223, 3, 3, 0 },
+  { 9501, 4226, 5, 3, 0 },
+  { 9506, 4229, 6, 2, 0 },
+  { 9512, 4231, 21, 3, 0 },
+  { 9533, 4234, 13, 3, 0 },
+  { 9546, 4237, 5, 3, 0 },
+  { 9551, 4240, 5, 3, 0 },
+  { 9556, 4243, 5, 3, 0 },
+  { 9561, 4246, 6, 3, 0 },
+  { 9567, 4249, 4, 4, 0 },
+  { 9571, 4253, 6, 3, 0 },
+  { 9577, 4256, 8, 3, 0 },
+  { 9585, 4259, 4, 3, 0 },
+  { 9589, 4262, 6, 3, 0 },
+  { 9595, 4265, 6, 3, 0 },
+  { 9601, 4268, 6, 2, 0 },
+  { 9607, 4270, 5, 3, 0 },
+  { 9612, 4273, 4, 3, 0 },
+  { 9616, 4276, 6, 3, 0 },
+  { 9622, 4279, 12, 3, 0 },
+  { 9634, 4282, 6, 3, 0 },
+  { 9640, 4285, 7, 3, 0 },
+  { 9647, 4288, 5, 3, 0 },
+  { 9652, 4291, 5, 2, 0 },
+  { 9657, 4293, 13, 3, 0 },
+  { 9670, 4296, 4, 4, 0 },
+  { 9674, 4300, 13, 3, 0 },
+  { 9687, 4303, 6, 2, 0 },
+  { 9693, 4305, 6, 2, 0 },
+  { 9699, 4307, 6, 2, 0 },
+  { 9705, 4309, 14, 3, 0 },
+  { 9719, 4312, 5, 6, 0 },
+  { 9724, 4318, 6, 3, 0 },
+  { 9730, 4321, 4, 3, 0 },
+  { 9734, 4324, 10, 3, 0 },
+  { 9744, 4327, 4, 2, 0 },
+  { 9748, 4329, 3, 2, 0 },
+  { 9751, 4331, 9, 3, 0 },
+  { 9760, 4334, 5, 2, 0 },
+  { 9765, 4336, 5, 3, 0 },
+  { 9770, 4339, 4, 3, 0 },
+  { 9774, 4342, 2, 3, 0 },
+  { 9776, 4345, 7, 3, 0 },
+  { 9783, 4348, 9, 2, 0 },
+  { 9792, 4350, 9, 3, 0 },
+  { 9801, 4353, 7, 3, 0 },
+  { 9808, 4356, 12, 5, 0 },
+  { 9820, 4361, 4, 3, 0 },
+  { 9824, 4364, 5, 3, 0 },
+  { 9829, 4367, 4, 3, 0 },
+  { 9833, 4370, 15, 3, 0 },
+  { 9848, 4373, 4, 4, 0 },
+  { 9852, 4377, 13, 3, 0 },
+  { 9865, 4380, 5, 3, 0 },
+  { 9870, 4383, 22, 2, 0 },
+  { 9892, 4385, 6, 3, 0 },
+  { 9898, 4388, 6, 3, 0 },
+  { 9904, 4391, 3, 3, 0 },
+  { 9907, 4394, 14, 3, 0 },
+  { 9921, 4397, 3, 2, 0 },
+  { 9924, 4399, 6, 3, 0 },
+  { 9930, 4402, 4, 4, 0 },
+  { 9934, 4406, 12, 3, 0 },
+  { 9946, 4409, 3, 3, 0 },
+  { 9949, 4412, 5, 3, 0 },
+  { 9954, 4415, 4, 2, 0 },
+  { 9958, 4417, 6, 2, 0 },
+  { 9964, 4419, 6, 2, 0 },
+  { 9970, 4421, 6, 3, 0 },
+  { 9976, 4424, 16, 5, 0 },
+  { 9992, 4429, 5, 3, 0 },
+  { 9997, 4432, 8, 3, 0 },
+  { 10005, 4435, 11, 5, 0 },
+  { 10016, 4440, 6, 3, 0 },
+  { 10022, 4443, 6, 2, 0 },
+  { 10028, 4445, 2, 3, 0 },
+  { 10030, 4448, 5, 2, 0 },
+  { 10035, 4450, 7, 3, 0 },
+  { 10042, 4453, 4, 2, 0 },
+  { 10046, 4455, 3, 4, 0 },
+  { 10049, 4459, 4, 4, 0 },
+  { 10053, 4463, 6, 3, 0 },
+  { 10059, 4466, 6, 6, 0 },
+  { 10065, 4472, 10, 3, 0 },
+  { 10075, 4475, 6, 1, 0 },
+  { 10081, 4476, 4, 2, 0 },
+  { 10085, 4478, 4, 3, 0 },
+  { 10089, 4481, 5, 3, 0 },
+  { 10094, 4484, 5, 3, 0 },
+  { 10099, 4487, 5, 3, 0 },
+  { 10104, 4490, 4, 2, 0 },
+  { 10108, 4492, 4, 4, 0 },
+  { 10112, 4496, 5, 2, 0 },
+  { 10117, 4498, 3, 4, 0 },
+  { 10120, 4502, 3, 4, 0 },
+  { 10123, 4506, 6, 3, 0 },
+  { 10129, 4509, 6, 3, 0 },
+  { 10135, 4512, 13, 3, 0 },
+  { 10148, 4515, 6, 3, 0 },
+  { 10154, 4518, 7, 3, 0 },
+  { 10161, 4521, 6, 6, 0 },
+  { 10167, 4527, 9, 3, 0 },
+  { 10176, 4530, 6, 3, 0 },
+  { 10182, 4533, 3, 2, 0 },
+  { 10185, 4535, 8, 3, 0 },
+  { 10193, 4538, 3, 2, 0 },
+  { 10196, 4540, 4, 4, 0 },
+  { 10200, 4544, 6, 2, 0 },
+  { 10206, 4546, 21, 3, 0 },
+  { 10227, 4549, 16, 3, 0 },
+  { 10243, 4552, 4, 3, 0 },
+  { 10247, 4555, 6, 3, 0 },
+  { 10253, 4558, 6, 3, 0 },
+  { 10259, 4561, 5, 3, 0 },
+  { 10264, 4564, 6, 3, 0 },
+  { 10270, 4567, 5, 3, 0 },
+  { 10275, 4570, 4, 3, 0 },
+  { 10279, 4573, 3, 3, 0 },
+  { 10282, 4576, 6, 2, 0 },
+  { 10288, 4578, 3, 3, 0 },
+  { 10291, 4581, 11, 3, 0 },
+  { 10302, 4584, 3, 2, 0 },
+  { 10305, 4586, 4, 3, 0 },
+  { 10309, 4589, 3, 3, 0 },
+  { 10312, 4592, 5, 3, 0 },
+  { 10317, 4595, 6, 2, 0 },
+  { 10323, 4597, 3, 1, 1 },
+  { 10326, 4598, 12, 3, 0 },
+  { 10338, 4601, 4, 3, 0 },
+  { 10342, 4604, 4, 3, 0 },
+  { 10346, 4607, 5, 2, 0 },
+  { 10351, 4609, 15, 5, 0 },
+  { 10366, 4614, 3, 4, 0 },
+  { 10369, 4618, 5, 3, 0 },
+  { 10374, 4621, 3, 3, 0 },
+  { 10377, 4624, 5, 2, 0 },
+  { 10382, 4626, 3, 3, 0 },
+  { 10385, 4629, 16, 3, 0 },
+  { 10401, 4632, 10, 3, 0 },
+  { 10411, 4635, 12, 3, 0 },
+  { 10423, 4638, 7, 3, 0 },
+  { 10430, 4641, 4, 3, 0 },
+  { 10434, 4644, 4, 3, 0 },
+  { 10438, 4647, 4, 3, 0 },
+  { 10442, 4650, 5, 3, 0 },
+  { 10447, 4653, 6, 2, 0 },
+  { 10453, 4655, 3, 4, 0 },
+  { 10456, 4659, 8, 3, 0 },
+  { 10464, 4662, 5, 3, 0 },
+  { 10469, 4665, 4, 3, 0 },
+  { 10473, 4668, 8, 3, 0 },
+  { 10481, 4671, 8, 3, 0 },
+  { 10489, 4674, 6, 2, 0 },
+  { 10495, 4676, 3, 3, 0 },
+  { 10498, 4679, 6, 1, 0 },
+  { 10504, 4680, 4, 4, 0 },
+  { 10508, 4684, 3, 2, 0 },
+  { 10511, 4686, 5, 3, 0 },
+  { 10516, 4689, 4, 4, 0 },
+  { 10520, 4693, 3, 2, 0 },
+  { 10523, 4695, 7, 3, 0 },
+  { 10530, 4698, 6, 3, 0 },
+  { 10536, 4701, 15, 3, 0 },
+  { 10551, 4704, 7, 3, 0 },
+  { 10558, 4707, 6, 3, 0 },
+  { 10564, 4710, 3, 3, 0 },
+  { 10567, 4713, 4, 3, 0 },
+  { 10571, 4716, 9, 3, 0 },
+  { 10580, 4719, 6, 3, 0 },
+  { 10586, 4722, 7, 3, 0 },
+  { 10593, 4725, 6, 3, 0 },
+  { 10599, 4728, 12, 3, 0 },
+  { 10611, 4731, 5, 3, 0 },
+  { 10616, 4734, 6, 3, 0 },
+  { 10622, 4737, 4, 1, 0 },
+  { 10626, 4738, 4, 3, 0 },
+  { 10630, 4741, 4, 4, 0 },
+  { 10634, 4745, 4, 3, 0 },
+  { 10638, 4748, 5, 3, 0 },
+  { 10643, 4751, 3, 2, 0 },
+  { 10646, 4753, 5, 3, 0 },
+  { 10651, 4756, 6, 2, 0 },
+  { 10657, 4758, 7, 3, 0 },
+  { 10664, 4761, 6, 6, 0 },
+  { 10670, 4767, 8, 3, 0 },
+  { 10678, 4770, 14, 3, 0 },
+  { 10692, 4773, 4, 2, 0 },
+  { 10696, 4775, 6, 3, 0 },
+  { 10702, 4778, 4, 4, 0 },
+  { 10706, 4782, 5, 3, 0 },
+  { 10711, 4785, 4, 4, 0 },
+  { 10715, 4789, 21, 3, 0 },
+  { 10736, 4792, 4, 3, 0 },
+  { 10740, 4795, 6, 2, 0 },
+  { 10746, 4797, 14, 3, 0 },
+  { 10760, 4800, 6, 3, 0 },
+  { 10766, 4803, 15, 3, 0 },
+  { 10781, 4806, 5, 3, 0 },
+  { 10786, 4809, 3, 4, 0 },
+  { 10789, 4813, 3, 3, 0 },
+  { 10792, 4816, 3, 2, 0 },
+  { 10795, 4818, 3, 3, 0 },
+  { 10798, 4821, 6, 2, 0 },
+  { 10804, 4823, 5, 3, 0 },
+  { 10809, 4826, 4, 3, 0 },
+  { 10813, 4829, 14, 3, 0 },
+  { 10827, 4832, 4, 4, 0 },
+  { 10831, 4836, 3, 2, 0 },
+  { 10834, 4838, 6, 3, 0 },
+  { 10840, 4841, 5, 3, 0 },
+  { 10845, 4844, 3, 2, 0 },
+  { 10848, 4846, 5, 3, 0 },
+  { 10853, 4849, 5, 3, 0 },
+  { 10858, 4852, 16, 2, 0 },
+  { 10874, 4854, 4, 3, 0 },
+  { 10878, 4857, 2, 2, 0 },
+  { 10880, 4859, 2, 2, 0 },
+  { 10882, 4861, 4, 2, 0 },
+  { 10886, 4863, 5, 2, 0 },
+  { 10891, 4865, 7, 3, 0 },
+  { 10898, 4868, 6, 3, 0 },
+  { 10904, 4871, 9, 3, 0 },
+  { 10913, 4874, 3, 3, 0 },
+  { 10916, 4877, 3, 4, 0 },
+  { 10919, 4881, 11, 3, 0 },
+  { 10930, 4884, 5, 3, 0 },
+  { 10935, 4887, 11, 3, 0 },
+  { 10946, 4890, 6, 3, 0 },
+  { 10952, 4893, 17, 3, 0 },
+  { 10969, 4896, 6, 3, 0 },
+  { 10975, 4899, 4, 3, 0 },
+  { 10979, 4902, 14, 3, 0 },
+  { 10993, 4905, 6, 3, 0 },
+  { 10999, 4908, 6, 3, 0 },
+  { 11005, 4911, 7, 3, 0 },
+  { 11012, 4914, 3, 3, 0 },
+  { 11015, 4917, 3, 2, 0 },
+  { 11018, 4919, 13, 3, 0 },
+  { 11031, 4922, 3, 4, 0 },
+  { 11034, 4926, 5, 3, 0 },
+  { 11039, 4929, 13, 3, 0 },
+  { 11052, 4932, 3, 4, 0 },
+  { 11055, 4936, 7, 2, 0 },
+  { 11062, 4938, 6, 2, 0 },
+  { 11068, 4940, 8, 3, 0 },
+  { 11076, 4943, 8, 3, 0 },
+  { 11084, 4946, 5, 3, 0 },
+  { 11089, 4949, 4, 3, 0 },
+  { 11093, 4952, 3, 4, 0 },
+  { 11096, 4956, 2, 1, 0 },
+  { 11098, 4957, 6, 3, 0 },
+  { 11104, 4960, 5, 2, 0 },
+  { 11109, 4962, 5, 2, 0 },
+  { 11114, 4964, 3, 4, 0 },
+  { 11117, 4968, 3, 2, 0 },
+  { 11120, 4970, 8, 3, 0 },
+  { 11128, 4973, 7, 3, 0 },
+  { 11135, 4976, 4, 3, 0 },
+  { 11139, 4979, 15, 3, 0 },
+  { 11154, 4982, 5, 3, 0 },
+  { 11159, 4985, 14, 3, 0 },
+  { 11173, 4988, 4, 4, 0 },
+  { 11177, 4992, 6, 1, 0 },
+  { 11183, 4993, 7, 3, 0 },
+  { 11190, 4996, 6, 2, 0 },
+  { 11196, 4998, 6, 2, 0 },
+  { 11202, 5000, 6, 3, 0 },
+  { 11208, 5003, 6, 3, 0 },
+  { 11214, 5006, 5, 3, 0 },
+  { 11219, 5009, 7, 1, 0 },
+  { 11226, 5010, 4, 4, 0 },
+  { 11230, 5014, 7, 3, 0 },
+  { 11237, 5017, 6, 2, 0 },
+  { 11243, 5019, 4, 4, 0 },
+  { 11247, 5023, 5, 2, 0 },
+  { 11252, 5025, 2, 3, 0 },
+  { 11254, 5028, 4, 1, 0 },
+  { 11258, 5029, 9, 3, 0 },
+  { 11267, 5032, 7, 3, 0 },
+  { 11274, 5035, 3, 2, 0 },
+  { 11277, 5037, 6, 2, 0 },
+  { 11283, 5039, 9, 6, 0 },
+  { 11292, 5045, 6, 2, 0 },
+  { 11298, 5047, 12, 1, 0 },
+  { 11310, 5048, 17, 3, 0 },
+  { 11327, 5051, 6, 3, 0 },
+  { 11333, 5054, 4, 2, 0 },
+  { 11337, 5056, 5, 3, 0 },
+  { 11342, 5059, 4, 3, 0 },
+  { 11346, 5062, 4, 3, 0 },
+  { 11350, 5065, 3, 3, 0 },
+  { 11353, 5068, 6, 3, 0 },
+  { 11359, 5071, 2, 3, 0 },
+  { 11361, 5074, 6, 2, 0 },
+  { 11367, 5076, 5, 3, 0 },
+  { 11372, 5079, 5, 3, 0 },
+  { 11377, 5082, 9, 3, 0 },
+  { 11386, 5085, 4, 4, 0 },
+  { 11390, 5089, 7, 3, 0 },
+  { 11397, 5092, 3, 4, 0 },
+  { 11400, 5096, 4, 3, 0 },
+  { 11404, 5099, 5, 3, 0 },
+  { 11409, 5102, 10, 3, 0 },
+  { 11419, 5105, 3, 4, 0 },
+  { 11422, 5109, 5, 3, 0 },
+  { 11427, 5112, 4, 6, 0 },
+  { 11431, 5118, 7, 3, 0 },
+  { 11438, 5121, 2, 1, 0 },
+  { 11440, 5122, 11, 3, 0 },
+  { 11451, 5125, 7, 3, 0 },
+  { 11458, 5128, 11, 3, 0 },
+  { 11469, 5131, 6, 3, 0 },
+  { 11475, 5134, 6, 2, 0 },
+  { 11481, 5136, 3, 2, 0 },
+  { 11484, 5138, 5, 3, 0 },
+  { 11489, 5141, 6, 3, 0 },
+  { 11495, 5144, 7, 3, 0 },
+  { 11502, 5147, 12, 3, 0 },
+  { 11514, 5150, 3, 2, 0 },
+  { 11517, 5152, 24, 3, 0 },
+  { 11541, 5155, 10, 3, 0 },
+  { 11551, 5158, 7, 3, 0 },
+  { 11558, 5161, 7, 3, 0 },
+  { 11565, 5164, 12, 3, 0 },
+  { 11577, 5167, 5, 3, 0 },
+  { 11582, 5170, 6, 3, 0 },
+  { 11588, 5173, 12, 3, 0 },
+  { 11600, 5176, 6, 3, 0 },
+  { 11606, 5179, 6, 2, 0 },
+  { 11612, 5181, 4, 3, 0 },
+  { 11616, 5184, 19, 3, 0 },
+  { 11635, 5187, 4, 2, 0 },
+  { 11639, 5189, 11, 3, 0 },
+  { 11650, 5192, 11, 3, 0 },
+  { 11661, 5195, 6, 2, 0 },
+  { 11667, 5197, 7, 3, 0 },
+  { 11674, 5200, 7, 3, 0 },
+  { 11681, 5203, 5, 3, 0 },
+  { 11686, 5206, 6, 2, 0 },
+  { 11692, 5208, 6, 2, 0 },
+  { 11698, 5210, 4, 4, 0 },
+  { 11702, 5214, 6, 3, 0 },
+  { 11708, 5217, 14, 3, 0 },
+  { 11722, 5220, 6, 3, 0 },
+  { 11728, 5223, 6, 2, 0 },
+  { 11734, 5225, 14, 3, 0 },
+  { 11748, 5228, 16, 3, 0 },
+  { 11764, 5231, 6, 3, 0 },
+  { 11770, 5234, 8, 3, 0 },
+  { 11778, 5237, 6, 2, 0 },
+  { 11784, 5239, 6, 3, 0 },
+  { 11790, 5242, 5, 3, 0 },
+  { 11795, 5245, 6, 3, 0 },
+  { 11801, 5248, 9, 2, 0 },
+  { 11810, 5250, 3, 3, 0 },
+  { 11813, 5253, 11, 3, 0 },
+  { 11824, 5256, 6, 3, 0 },
+  { 11830, 5259, 17, 5, 0 },
+  { 11847, 5264, 5, 3, 0 },
+  { 11852, 5267, 7, 3, 0 },
+  { 11859, 5270, 8, 3, 0 },
+  { 11867, 5273, 5, 3, 0 },
+  { 11872, 5276, 7, 3, 0 },
+  { 11879, 5279, 3, 3, 0 },
+  { 11882, 5282, 6, 3, 0 },
+  { 11888, 5285, 5, 3, 0 },
+  { 11893, 5288, 6, 3, 0 },
+  { 11899, 5291, 6, 3, 0 },
+  { 11905, 5294, 4, 3, 0 },
+  { 11909, 5297, 7, 6, 0 },
+  { 11916, 5303, 6, 2, 0 },
+  { 11922, 5305, 6, 2, 0 },
+  { 11928, 5307, 3, 3, 0 },
+  { 11931, 5310, 16, 5, 0 },
+  { 11947, 5315, 5, 3, 0 },
+  { 11952, 5318, 6, 3, 0 },
+  { 11958, 5321, 5, 2, 0 },
+  { 11963, 5323, 5, 2, 0 },
+  { 11968, 5325, 4, 6, 0 },
+  { 11972, 5331, 5, 3, 0 },
+  { 11977, 5334, 9, 3, 0 },
+  { 11986, 5337, 5, 3, 0 },
+  { 11991, 5340, 14, 3, 0 },
+  { 12005, 5343, 3, 2, 0 },
+  { 12008, 5345, 5, 3, 0 },
+  { 12013, 5348, 2, 3, 0 },
+  { 12015, 5351, 5, 3, 0 },
+  { 12020, 5354, 4, 5, 0 },
+  { 12024, 5359, 8, 3, 0 },
+  { 12032, 5362, 6, 2, 0 },
+  { 12038, 5364, 6, 2, 0 },
+  { 12044, 5366, 5, 3, 0 },
+  { 12049, 5369, 4, 2, 0 },
+  { 12053, 5371, 5, 3, 0 },
+  { 12058, 5374, 15, 3, 0 },
+  { 12073, 5377, 3, 2, 0 },
+  { 12076, 5379, 5, 3, 0 },
+  { 12081, 5382, 13, 3, 0 },
+  { 12094, 5385, 5, 3, 0 },
+  { 12099, 5388, 8, 3, 0 },
+  { 12107, 5391, 5, 3, 0 },
+  { 12112, 5394, 5, 3, 0 },
+  { 12117, 5397, 3, 3, 0 },
+  { 12120, 5400, 5, 3, 0 },
+  { 12125, 5403, 4, 2, 0 },
+  { 12129, 5405, 7, 3, 0 },
+  { 12136, 5408, 4, 3, 0 },
+  { 12140, 5411, 6, 2, 0 },
+  { 12146, 5413, 4, 6, 0 },
+  { 12150, 5419, 9, 3, 0 },
+  { 12159, 5422, 6, 3, 0 },
+  { 12165, 5425, 4, 3, 0 },
+  { 12169, 5428, 4, 2, 0 },
+  { 12173, 5430, 5, 3, 0 },
+  { 12178, 5433, 20, 3, 0 },
+  { 12198, 5436, 6, 3, 0 },
+  { 12204, 5439, 17, 3, 0 },
+  { 12221, 5442, 4, 3, 0 },
+  { 12225, 5445, 5, 2, 0 },
+  { 12230, 5447, 12, 3, 0 },
+  { 12242, 5450, 6, 3, 0 },
+  { 12248, 5453, 8, 3, 0 },
+  { 12256, 5456, 6, 3, 0 },
+  { 12262, 5459, 7, 3, 0 },
+  { 12269, 5462, 4, 4, 0 },
+  { 12273, 5466, 12, 3, 0 },
+  { 12285, 5469, 8, 3, 0 },
+  { 12293, 5472, 7, 3, 0 },
+  { 12300, 5475, 5, 3, 0 },
+  { 12305, 5478, 16, 3, 0 },
+  { 12321, 5481, 5, 3, 0 },
+  { 12326, 5484, 6, 3, 0 },
+  { 12332, 5487, 6, 3, 0 },
+  { 12338, 5490, 6, 5, 0 },
+  { 12344, 5495, 4, 4, 0 },
+  { 12348, 5499, 8, 3, 0 },
+  { 12356, 5502, 5, 3, 0 },
+  { 12361, 5505, 4, 3, 0 },
+  { 12365, 5508, 2, 2, 0 },
+  { 12367, 5510, 5, 3, 0 },
+  { 12372, 5513, 6, 2, 0 },
+  { 12378, 5515, 11, 3, 0 },
+  { 12389, 5518, 5, 3, 0 },
+  { 12394, 5521, 31, 3, 0 },
+  { 12425, 5524, 5, 3, 0 },
+  { 12430, 5527, 6, 2, 0 },
+  { 12436, 5529, 5, 3, 0 },
+  { 12441, 5532, 15, 3, 0 },
+  { 12456, 5535, 3, 4, 0 },
+  { 12459, 5539, 6, 2, 0 },
+  { 12465, 5541, 5, 5, 0 },
+  { 12470, 5546, 6, 3, 0 },
+  { 12476, 5549, 6, 3, 0 },
+  { 12482, 5552, 13, 3, 0 },
+  { 12495, 5555, 11, 3, 0 },
+  { 12506, 5558, 2, 3, 0 },
+  { 12508, 5561, 6, 3, 0 },
+  { 12514, 5564, 3, 3, 0 },
+  { 12517, 5567, 10, 3, 0 },
+  { 12527, 5570, 12, 3, 0 },
+  { 12539, 5573, 4, 2, 0 },
+  { 12543, 5575, 6, 3, 0 },
+  { 12549, 5578, 5, 3, 0 },
+  { 12554, 5581, 5, 2, 0 },
+  { 12559, 5583, 6, 3, 0 },
+  { 12565, 5586, 5, 3, 0 },
+  { 12570, 5589, 11, 3, 0 },
+  { 12581, 5592, 4, 4, 0 },
+  { 12585, 5596, 8, 3, 0 },
+  { 12593, 5599, 4, 3, 0 },
+  { 12597, 5602, 10, 3, 0 },
+  { 12607, 5605, 7, 3, 0 },
+  { 12614, 5608, 6, 3, 0 },
+  { 12620, 5611, 3, 3, 0 },
+  { 12623, 5614, 18, 3, 0 },
+  { 12641, 5617, 6, 6, 0 },
+  { 12647, 5623, 6, 3, 0 },
+  { 12653, 5626, 5, 3, 0 },
+  { 12658, 5629, 12, 3, 0 },
+  { 12670, 5632, 4, 3, 0 },
+  { 12674, 5635, 13, 3, 0 },
+  { 12687, 5638, 3, 4, 0 },
+  { 12690, 5642, 4, 3, 0 },
+  { 12694, 5645, 2, 3, 0 },
+  { 12696, 5648, 4, 4, 0 },
+  { 12700, 5652, 4, 4, 0 },
+  { 12704, 5656, 6, 3, 0 },
+  { 12710, 5659, 6, 3, 0 },
+  { 12716, 5662, 13, 3, 0 },
+  { 12729, 5665, 7, 3, 0 },
+  { 12736, 5668, 3, 1, 0 },
+  { 12739, 5669, 6, 3, 0 },
+  { 12745, 5672, 3, 2, 0 },
+  { 12748, 5674, 5, 2, 0 },
+  { 12753, 5676, 6, 3, 0 },
+  { 12759, 5679, 3, 2, 0 },
+  { 12762, 5681, 7, 3, 0 },
+  { 12769, 5684, 7, 3, 0 },
+  { 12776, 5687, 5, 3, 0 },
+  { 12781, 5690, 8, 3, 0 },
+  { 12789, 5693, 7, 3, 0 },
+  { 12796, 5696, 8, 3, 0 },
+  { 12804, 5699, 9, 3, 0 },
+  { 12813, 5702, 4, 2, 0 },
+  { 12817, 5704, 5, 3, 0 },
+  { 12822, 5707, 6, 3, 0 },
+  { 12828, 5710, 8, 3, 0 },
+  { 12836, 5713, 6, 3, 0 },
+  { 12842, 5716, 5, 3, 0 },
+  { 12847, 5719, 8, 3, 0 },
+  { 12855, 5722, 4, 3, 0 },
+  { 12859, 5725, 6, 3, 0 },
+  { 12865, 5728, 6, 3, 0 },
+  { 12871, 5731, 5, 3, 0 },
+  { 12876, 5734, 10, 3, 0 },
+  { 12886, 5737, 4, 3, 0 },
+  { 12890, 5740, 7, 3, 0 },
+  { 12897, 5743, 5, 3, 0 },
+  { 12902, 5746, 5, 2, 0 },
+  { 12907, 5748, 6, 2, 0 },
+  { 12913, 5750, 4, 3, 0 },
+  { 12917, 5753, 9, 3, 0 },
+  { 12926, 5756, 5, 2, 0 },
+  { 12931, 5758, 15, 3, 0 },
+  { 12946, 5761, 6, 2, 0 },
+  { 12952, 5763, 8, 3, 0 },
+  { 12960, 5766, 5, 3, 0 },
+  { 12965, 5769, 5, 3, 0 },
+  { 12970, 5772, 8, 3, 0 },
+  { 12978, 5775, 9, 3, 0 },
+  { 12987, 5778, 8, 3, 0 },
+  { 12995, 5781, 13, 3, 0 },
+  { 13008, 5784, 7, 3, 0 },
+  { 13015, 5787, 4, 4, 0 },
+  { 13019, 5791, 5, 3, 0 },
+  { 13024, 5794, 3, 3, 0 },
+  { 13027, 5797, 10, 3, 0 },
+  { 13037, 5800, 3, 3, 0 },
+  { 13040, 5803, 6, 3, 0 },
+  { 13046, 5806, 5, 3, 0 },
+  { 13051, 5809, 18, 3, 0 },
+  { 13069, 5812, 5, 3, 0 },
+  { 13074, 5815, 3, 2, 0 },
+  { 13077, 5817, 4, 2, 0 },
+  { 13081, 5819, 8, 3, 0 },
+  { 13089, 5822, 5, 2, 0 },
+  { 13094, 5824, 4, 2, 0 },
+  { 13098, 5826, 6, 3, 0 },
+  { 13104, 5829, 7, 3, 0 },
+  { 13111, 5832, 6, 3, 0 },
+  { 13117, 5835, 6, 2, 0 },
+  { 13123, 5837, 6, 2, 0 },
+  { 13129, 5839, 5, 3, 0 },
+  { 13134, 5842, 4, 3, 0 },
+  { 13138, 5845, 6, 3, 0 },
+  { 13144, 5848, 14, 3, 0 },
+  { 13158, 5851, 14, 3, 0 },
+  { 13172, 5854, 4, 3, 0 },
+  { 13176, 5857, 2, 2, 0 },
+  { 13178, 5859, 2, 3, 0 },
+  { 13180, 5862, 6, 3, 0 },
+  { 13186, 5865, 5, 3, 0 },
+  { 13191, 5868, 12, 3, 0 },
+  { 13203, 5871, 13, 3, 0 },
+  { 13216, 5874, 6, 3, 0 },
+  { 13222, 5877, 2, 2, 0 },
+  { 13224, 5879, 3, 4, 0 },
+  { 13227, 5883, 3, 3, 0 },
+  { 13230, 5886, 5, 2, 0 },
+  { 13235, 5888, 13, 3, 0 },
+  { 13248, 5891, 6, 3, 0 },
+  { 13254, 5894, 4, 2, 0 },
+  { 13258, 5896, 7, 3, 0 },
+  { 13265, 5899, 5, 3, 0 },
+  { 13270, 5902, 7, 3, 0 },
+  { 13277, 5905, 5, 2, 0 },
+  { 13282, 5907, 19, 3, 0 },
+  { 13301, 5910, 6, 3, 0 },
+  { 13307, 5913, 10, 5, 0 },
+  { 13317, 5918, 5, 3, 0 },
+  { 13322, 5921, 17, 3, 0 },
+  { 13339, 5924, 4, 4, 0 },
+  { 13343, 5928, 3, 4, 0 },
+  { 13346, 5932, 5, 2, 0 },
+  { 13351, 5934, 20, 3, 0 },
+  { 13371, 5937, 8, 3, 0 },
+  { 13379, 5940, 8, 1, 0 },
+  { 13387, 5941, 17, 5, 0 },
+  { 13404, 5946, 3, 2, 0 },
+  { 13407, 5948, 9, 3, 0 },
+  { 13416, 5951, 4, 2, 0 },
+  { 13420, 5953, 7, 3, 0 },
+  { 13427, 5956, 2, 3, 0 },
+  { 13429, 5959, 3, 2, 0 },
+  { 13432, 5961, 6, 3, 0 },
+  { 13438, 5964, 5, 2, 0 },
+  { 13443, 5966, 6, 3, 0 },
+  { 13449, 5969, 6, 3, 0 },
+  { 13455, 5972, 6, 2, 0 },
+  { 13461, 5974, 6, 3, 0 },
+  { 13467, 5977, 4, 3, 0 },
+  { 13471, 5980, 4, 1, 1 },
+  { 13475, 5981, 4, 4, 0 },
+  { 13479, 5985, 4, 3, 0 },
+  { 13483, 5988, 7, 3, 0 },
+  { 13490, 5991, 6, 3, 0 },
+  { 13496, 5994, 6, 2, 0 },
+  { 13502, 5996, 4, 2, 0 },
+  { 13506, 5998, 5, 6, 0 },
+  { 13511, 6004, 8, 3, 0 },
+  { 13519, 6007, 4, 3, 0 },
+  { 13523, 6010, 6, 3, 0 },
+  { 13529, 6013, 11, 3, 0 },
+  { 13540, 6016, 5, 3, 0 },
+  { 13545, 6019, 4, 3, 0 },
+  { 13549, 6022, 6, 2, 0 },
+  { 13555, 6024, 4, 3, 0 },
+  { 13559, 6027, 6, 2, 0 },
+  { 13565, 6029, 14, 3, 0 },
+  { 13579, 6032, 6, 2, 0 },
+  { 13585, 6034, 5, 3, 0 },
+  { 13590, 6037, 14, 3, 0 },
+  { 13604, 6040, 6, 2, 0 },
+  { 13610, 6042, 3, 2, 0 },
+  { 13613, 6044, 5, 2, 0 },
+  { 13618, 6046, 4, 3, 0 },
+  { 13622, 6049, 7, 3, 0 },
+  { 13629, 6052, 4, 3, 0 },
+  { 13633, 6055, 4, 3, 0 },
+  { 13637, 6058, 6, 5, 0 },
+  { 13643, 6063, 5, 3, 0 },
+  { 13648, 6066, 3, 3, 0 },
+  { 13651, 6069, 3, 4, 0 },
+  { 13654, 6073, 4, 2, 0 },
+  { 13658, 6075, 8, 3, 0 },
+  { 13666, 6078, 5, 2, 0 },
+  { 13671, 6080, 5, 3, 0 },
+  { 13676, 6083, 12, 6, 0 },
+  { 13688, 6089, 3, 2, 0 },
+  { 13691, 6091, 6, 3, 0 },
+  { 13697, 6094, 6, 3, 0 },
+  { 13703, 6097, 6, 3, 0 },
+  { 13709, 6100, 4, 1, 0 },
+  { 13713, 6101, 5, 3, 0 },
+  { 13718, 6104, 6, 1, 0 },
+  { 13724, 6105, 16, 3, 0 },
+  { 13740, 6108, 3, 4, 0 },
+  { 13743, 6112, 3, 3, 0 },
+  { 13746, 6115, 4, 3, 0 },
+  { 13750, 6118, 4, 2, 0 },
+  { 13754, 6120, 5, 3, 0 },
+  { 13759, 6123, 6, 3, 0 },
+  { 13765, 6126, 3, 2, 0 },
+  { 13768, 6128, 8, 5, 0 },
+  { 13776, 6133, 14, 3, 0 },
+  { 13790, 6136, 17, 3, 0 },
+  { 13807, 6139, 23, 5, 0 },
+  { 13830, 6144, 10, 3, 0 },
+  { 13840, 6147, 15, 3, 0 },
+  { 13855, 6150, 6, 3, 0 },
+  { 13861, 6153, 6, 2, 0 },
+  { 13867, 6155, 5, 3, 0 },
+  { 13872, 6158, 5, 2, 0 },
+  { 13877, 6160, 6, 3, 0 },
+  { 13883, 6163, 6, 3, 0 },
+  { 13889, 6166, 15, 3, 0 },
+  { 13904, 6169, 4, 4, 0 },
+  { 13908, 6173, 3, 3, 0 },
+  { 13911, 6176, 7, 3, 0 },
+  { 13918, 6179, 4, 2, 0 },
+  { 13922, 6181, 3, 3, 0 },
+  { 13925, 6184, 3, 3, 0 },
+  { 13928, 6187, 4, 4, 0 },
+  { 13932, 6191, 16, 3, 0 },
+  { 13948, 6194, 10, 3, 0 },
+  { 13958, 6197, 3, 2, 0 },
+  { 13961, 6199, 3, 3, 0 },
+  { 13964, 6202, 5, 2, 0 },
+  { 13969, 6204, 7, 3, 0 },
+  { 13976, 6207, 13, 6, 0 },
+  { 13989, 6213, 15, 3, 0 },
+};
+
+static const char sxml_entity_names[] =
+  "bsolucircUacuteGreaterEqualLessseArrescrSupsetblacktriangletritimeprurel"
+  "DiacriticalDotprencaronnequivolarrcopysrcsupgsimedharlrHarScaronnLtrnmid"
+  "boxvhAcysqsuplowastLowerLeftArrowrAtailimagpartisinlshUpperRightArrow"
+  "GdotprimesLeftDoubleBracketAringYscrtcedilNotSquareSupersetEqualzeta"
+  "rbracebarwedlgERarrtldegNuCconintncongstraightepsilonGfrthickapprox"
+  "eparslYopflathairspHatvrtrimarkerColonnotnivcLeftDownTeeVectorElement"
+  "npartRightDownVectorBarboxVrngeqslantswarrCircleMinusCopflnsimsupE"
+  "RuleDelayedfrac14rataildzcyCirclePlusatildeiogonllvpropSHCHcypropchi"
+  "circledcircboxHrealinesubsetneqqDownLeftTeeVectorperiodsigmaroparEogon"
+  "omicronSmallCircleZHcyvArrRightFloorleqqcirEJopfLeftTeeArrowsubsetneq"
+  "ProportionscaplatesangsphotimesdharrscysqsupsetDopfXscrmfrluruharcularrp"
+  "circledRgneqqBopfiocyrbrkslubdquonbumpeboxulcircledastbackcongdigamma"
+  "nlsimUcircblacktriangleleftpivohbarxhArrandDiacriticalGraveyucynwarrKHcy"
+  "naturalswrnsupEYAcyparslNotRightTriangleBarRightTeeArrowtrisblozAogon"
+  "numspcurlyeqsuccaumlIntpimiddotisindotOumlsearrRightTeeleftleftarrows"
+  "demptyvEmptySmallSquareycynleqqbackprimeminusdunltnbumpgEdtdotCcirc"
+  "bigtriangleupedotrightharpoondowndivideontimesnshortparallelumacrPcy"
+  "DownRightVectorBarboxdlHorizontalLineNotNestedLessLessnlArrNotTildeTilde"
+  "ScircGcedilEcaronCcaronfrownrsquornsupquotboxVLDownArrowUnderBracenvgt"
+  "vsubnestarAfrNotSquareSubsetEqualIopfZeroWidthSpacejopfPrecedesnatur"
+  "measuredangleNotGreaterSlantEqualblankapnparalleltprimeequivDDxharr"
+  "SubsettcaronlnapangmsdLaplacetrfdotsquareacircPhicudarrlblk14ldshgescap"
+  "rangphoneseswardoteqcurlyveemDDotgtrapproxlsqbDfrLeftArrowBar"
+  "TildeFullEquallfloorltdotPrnlarrnleqSquareSupersetEqualsce"
+  "NotPrecedesEqualspadesuitOmicronlltriUbreveherconplusduRBarrepsilon"
+  "bkarowOpenCurlyQuoterarrcddarrzcaronoperpcurarrmOverBraceIotafrac45nspar"
+  "boxhdquestequrcorneraopfnrarrVbardivonxloplusjscrnotinvcLessTildelnE"
+  "lesdottscyxopfcolonubreveboxtimesUpsilonnrtrikscrTabgeapacirnprec"
+  "DownBreveangrtdiamondsuitMinusPlusOmegapluselangplankvUpdownarrow"
+  "RightArrowsolbaralephrightarrowQopfvarpictdotrfrTcedilNacute"
+  "DoubleLeftArrowDeltaddlessapproxcupdotgesdotocoloneqdrbkarowveebar"
+  "PlusMinuscheckmarklaemptyvrarrplcircdiexdtriboxuRsimfjligfrac12rmoustles"
+  "ldquoriiintsuccnapproxxveevarsupsetneqqnopfHscrgcircVertscirc"
+  "HumpDownHumpboxHunleqslantSupersetEqualnVDashDoubleLongLeftArrownabla"
+  "rotimeslceilNfrlbrackdcytscrbsimesigmavEfrthksimlegammadnvlePiHcircohm"
+  "sqcapprofsurfntildedollarRightarrowracetimesbarmopfsetminus"
+  "InvisibleCommaGbrevebigstarddotseqSuchThatlstrokcwconintintquatintncap"
+  "questhookrightarrowrparnmidboxDLfrac34lotimeszopfsuccapproxrlhar"
+  "precapproxxrArrTRADEtbrkYcircNotSucceedsSlantEqualangawconintOrmidcir"
+  "primeeqslantgtroscrLlsectsmtevarrhonsucceqtriminusTcaronzscrplussim"
+  "lurdsharEcynlEgtreqqlessRightAngleBracketparaEdotbecausesdotsupseteqq"
+  "RightVectorBardblacminusbboxvrnsubsetycircLeftUpDownVectorqopfpointint"
+  "anddVerticalTildesqufigraveprecxcirclarrbrtrifNotSupersetnotnivb"
+  "NegativeMediumSpacesup3DoubleLeftTeelopfffligBrevesparBernoullis"
+  "leftharpoondownImVeryThinSpaceumlthetaEmptyVerySmallSquareNotPrecedes"
+  "nshortmidplusacircfrrrarrstarfufishtnleodsoldsolbUpDownArrowWopfglj"
+  "lparltHstrokScedilUumlgelelsdotangmsdafgjcycopfCloseCurlyDoubleQuotewfr"
+  "supneBumpeqglEccaronsimplusLambdageslesbigwedgebcyfrac16Ifrsupsetneqq"
+  "approxeqCupCapjcirccommaHilbertSpacezwjocircsearhkIgravecuwedolciralpha"
+  "NotCongruentswArrlesgacdforkaclparparsimKcedillanglevnsubnumNtildengeq"
+  "boxboxcupsiivarnothingiukcygnElarrhkNotGreaterEquallowbarAgraveifrsol"
+  "nvltriekgreennbspShortRightArrownisrpargtyicyrfloornexistsmashpangst"
+  "erarrmapstoleftmodelsShortLeftArrowqfrZetaoframacrfpartintbbrktbrk"
+  "CloseCurlyQuoterealUpperLeftArrowcircleddashprblacktrianglerightIcirc"
+  "gtrsimffiligweierpphmmatflatdashCfrXfrYacuteodivMellintrfrtriltricolone"
+  "nearrowvarepsilonintlarhkshortparallelleqslantnapsuccnsim"
+  "DownLeftVectorBarrdshnhArrdtrifcsupemultimapornvHarrSucceedslhardqscr"
+  "LopfImaginaryIhscrgsimlThereforeNotCupCapLeftAngleBracketnprcedillrhar"
+  "nvDashDiacriticalAcutedownarrowCircleDotimageEtaexponentialePopfOverBar"
+  "uwanglerlmrarrbfssupedotgnapproxyopfoumlVerticalBarNotSupersetEqualsmtes"
+  "CayleysslarrSquareUnionlsimNotLeftTriangleBarrhovotimesasboxhDrobrkrcub"
+  "lbrksldnotindotgnsimleftharpoonupnvlArrharrwInvisibleTimesBecausespades"
+  "zigrarrnjcyUpTeeArrowqprimeUarrocirLeftTriangleEqualleqNotVerticalBarrho"
+  "rbbrkOopfDoubleRightArrowNotExistsdsolboxvsimlEproptotwoheadleftarrow"
+  "LongRightArrowsubdotDstrokvarsigmautriSquareSubsetimofGreaterGreaterNopf"
+  "nRightarrowemsp13nsubEboxDlJscrsupsimHopfrsquohslashtildeMcyllhardssmile"
+  "hkswarowOacutelgpopfUpEquilibriumyumlnsccueScVfrnaposgimelGcircDDotrahd"
+  "IogonrcaronlmoustJfrfallingdotseqRightDoubleBracketinfinRcaron"
+  "SucceedsSlantEqualfnofcupbrcapoeligsubseteqnexistsxmapforkvccupsscaron"
+  "boxvRCedillacaronsubseteqqYIcyudarrranglenotinvaupuparrows"
+  "DownRightVectorDJcysearrowvltrizhcyOdblacboxUrDifferentialD"
+  "NotTildeFullEqualrarrtlsucceqsimdotKcyogtCcedilBscrNotElementpitchfork"
+  "NcaronefDotutrifplustwoAmacrWedgeetanedotveeeqangemidastdrcornscnap"
+  "triangleqkcyerDotsupsetneqgtdowndownarrowshybullbigcupDoubleRightTee"
+  "FilledSmallSquarecirceqconintoplusDownTeethere4gtrdotltrilrcornersqsupe"
+  "cwintltLeftArrowsetmnSHcyjcyleftthreetimesLeftUpVectorrealpartfrac78Qfr"
+  "nLtvIacutechcyDotEqualpscrlegCapprsimscnElbarrvertccedilEpsilonsmid"
+  "becauseleftarrowGscrMapbigveePrimeShortDownArrowyacyuringnharr"
+  "downharpoonleftgeslcomplementrcyacyOverParenthesisangrtvbdbemptyvWscr"
+  "ReverseUpEquilibriummidacutethetasymplanckhlsquorsubENotGreaterFullEqual"
+  "lobrkJcircrarrhkpcymacrdotminusfraslDDRightArrowBarDownLeftVector"
+  "SquareSubsetEqualsuplarrlsaquotrianglerighteqnsubseteqLstroklessdotequiv"
+  "IukcydlcropntrianglelefteqlfishtExistsAacutebseminapEeumldfisht"
+  "vartrianglerightNotRightTriangleEqualgsimUnderParenthesis"
+  "blacktriangledownscpolintgravesubplusREGheartspreceqcylctydtribernoueng"
+  "elintershksearowtimesdodashwedgeropflatenestraightphidoublebarwedge"
+  "thereforeclubseljukcyfrac35curlywedgeLscrNotLeftTriangleEqualimped"
+  "lvertneqqdbkarowroplusbacksimastgtccnGtlesseqqgtrxoplusltrParFscrnLl"
+  "bprimeDoubleUpDownArrowrightleftharpoonsolcrossnotniszligrdcagapLcedil"
+  "capcaporigofsmeparslRightUpVectorBartoeaDcyEacutepluscirNestedLessLess"
+  "tfrAumlUtildeitildelarrplscJukcyThinSpaceGteparsubnEgneqnfrDownArrowBar"
+  "DoubleUpArrowrightrightarrowslrtriProportionalRrightarrowhopflcyEmacr"
+  "ThetaordbulletdstrokcsubmcySquareIntersectioneqcircbumpeangmsdacndash"
+  "ordersscrUringorarrkcedilrangeuopflneqbsolbsimlgtlParrangdNotTildesupsup"
+  "halfwopfgnapfemalebotsupplusKscrexpectationnpreceqntrianglerightMscrocir"
+  "submultlneqqlfrmcommaNotEqualTildegvnEiinfinrbarrwreathlsimgnotinsoftcy"
+  "nvgenparslitultriwedbarangmsdaeleftrightsquigarrowDaggerorderofoparboxuL"
+  "BetalarrsimcurarrUpArrowBarLongleftrightarrowcuporboxHDrsaquooltmstpos"
+  "circlearrowleftangmsdagBarvbackepsilontopfprecsimTScyloarrhcircmlcp"
+  "gvertneqqbfrnleftrightarrowPrecedesSlantEqualmapstodownecirintcalUpsiacE"
+  "LeftUpTeeVectorsimrarrlarrbfsLtGammanrarrwswnwarbumpExingERightTriangle"
+  "DZcybnequivintercalaringsrarrDScyRightDownTeeVectorLongLeftRightArrow"
+  "rarrapLeftVectorBarnapproxnsqsupecscrlharulmaltvBarvhamiltlbbrk"
+  "NestedGreaterGreaterWcircrationalspounddlcornplusbUdblacboxminus"
+  "ntrianglerighteqNotHumpDownHumpcupcapOcircLJcyfrac56uscrsumequalssupsub"
+  "FopfkopfnsubseteqqdscrrealsSfrOEligClockwiseContourIntegraleplusccapssmt"
+  "glhArrupsinvrArrloangRightTriangleEqualecysopfuplussmallsetminusIntegral"
+  "scEgbreveuhblkcueprldcaproduharlgdotsdotGammadcommatjsercyYcyZacutebeth"
+  "rlarrflligsubsimltrifecolonnapidbowtieSigmaNotReverseElementbigcirc"
+  "blacksquaresccuenGgNotLeftTriangledalethvarthetaOslashcongscnsim"
+  "GreaterFullEqualsubneimathangmsdadeqcolonzdotkfrtrpeziumOscr"
+  "DiacriticalTildebigotimesLcyiiiintwscrxlArrddaggershortmidapidUfrhstrok"
+  "SumapeHfrbnotrscrijligangrtvbZdotsbquoltimesCdotQUOTssetmnEquilibrium"
+  "NotTildeEqualbsimawintaflbrkenaturalDoubleLeftRightArrowltcirboxplus"
+  "incaredjcyboxDRepsivKfrNoBreakDoubleDownArrowodoturcropsqcupocynpre"
+  "topforkboxURnscromacrrhardGreaterSlantEqualgammaCongruentLeftDownVector"
+  "apEgesdotsextKopfDownRightTeeVectornearhkLeftCeilingtopbotplusmn"
+  "NotSucceedsbreveldrusharVerticalSeparatordisinxfrScyucyvartriangleleft"
+  "iprodCHcyangzarrYUcygElncyicircintegersvangrtVcycapbrcupVdashphivshcy"
+  "sqsupseteqotildeeopfnGtvyacutehookleftarrowbigcapmapstoupboxhcoprodnsime"
+  "PrecedesTildedashvRangointexistnsublrmAbreveYumlsupnsupsetudharsubrarr"
+  "uharriopfprcuediamonddaggernacuteoopfbacksimeqvarkappavBarOfrcrarr"
+  "RightUpVectorEcirciotadfrLangasympbottomUpArrowDownArrow"
+  "longleftrightarrowIcyOpenCurlyDoubleQuotethicksimnotleftarrowtail"
+  "MediumSpacesupsetRightUpTeeVectorNegativeThinSpacecurrensubsuptargetniv"
+  "lcubEscrblacklozengezacutecuveebepsinisdlnapproxbigtriangledowngglArr"
+  "compbumpEqualTildebbrklesssimfscrGopfrarrlpAEligffllignsupseteqKJcyrarrb"
+  "ldquoVscrexclsigmafsimeqrbrksldneArrororlvnErppolintprapzfrOmacrEsimcdot"
+  "amalgclubsuitgggcentemsp14vsupnEsubparallelNcysdotbsupdsubwcircrArr"
+  "LessSlantEquallsimenlespartcenterdotboxULrtrirbrkeCupRellcornerIJlig"
+  "lcaronLeftTriangleBarrisingdotseqshyisinExcupUscrnesimOtimes"
+  "DoubleLongRightArrowNegativeVeryThinSpaceColoneboxVliffomidzwnjUnion"
+  "Crossvarsupsetneqltrieblk34cirscirlmidotAlphaHacekmpStarLessLess"
+  "rightharpoonupAtildecurvearrowleftDcaronSopfbarwedgerarrcircledSEqual"
+  "NotLessSlantEqualGcyIOcyThickSpaceboxdRvcyZcaronnLeftrightarrowCacute"
+  "dwangleLacuteperpsucccurlyeqProductuarreDDotcupRholBarrlesdotoraeligAopf"
+  "ngesxodotdrcropDarrboxDrtoppfrRfrboxvlniGreaterLessulcornRarrDiamond"
+  "sqsubcrossprecnsimConintcireFouriertrfuArrbrvbarPscrrarrsimboxVeaster"
+  "uogonLeftUpVectorBarccircubrcynsucctintboxVHgscrEumlnsim"
+  "DownLeftRightVectorboxHULeftTriangleagraverAarrsimgSubVDashrcedil"
+  "NotPrecedesSlantEqualSucceedsTildenwArrboxdLsimgEnesearUopfominus"
+  "dzigrarrnldrnwarhklarrtlsacuteutdoteDotisinsvNotLessTilderarrfsgtquest"
+  "nsupethornlongleftarrowMopfLeftTeeVectorUgravedivideLmidotNotLessGreater"
+  "nvsimhellipvarrTildeTildeIdotreglesseqgtromegaroarrharroSsupmult"
+  "DoubleDotheartsuitccupssmNotHumpEqualntglcheckmaleLowerRightArrowSscr"
+  "PrecedesEqualbcongDiacriticalDoubleAcutetimesbSquaregeqNotSubsetEqualTau"
+  "squarebopfIntersectionegsdiamsIEcyoslashudblaclthreeNotSucceedsEqual"
+  "smileSupersetNotLessLessandandEgravelEUogonlesdotoringLfrXopfsupdot"
+  "sqcapsnleftarrowrbrackbetaSqrtDashvfltnsnrArrGJcyvscreogonffrFfrfrac25"
+  "numeroLongleftarrowxwedgerdldharvsubnETripleDotrharulyengeqslantOcynvlt"
+  "SOFTcyFilledVerySmallSquareDownArrowUpArrowlarrcapcupVerbarsharpltlarr"
+  "twixtntlgRshLcaronNotcurlyeqprecZcyemspelluuarrSacuteampGreaterEqualhbar"
+  "bullTSHcyNotSquareSubsetvfrlharulEgraquoLshNotRightTriangleNotGreater"
+  "ExponentialEnotnivadArrbNotlHarlAarrlambdajfrproflinehoarreuroeqvparsl"
+  "profalarutildeelspercntiscrtcyngsimVopfphinpolintlAtailrightsquigarrow"
+  "alefsymbarveeprEosolCoproductwedgeqltquesthorbarNotLessEqualUpTeeAssign"
+  "rsqbdarrvopfuHarminusTcyeqsiminodotsuphsubsqcupsbiguplusLeftRightArrow"
+  "uumllarrfsdopfgtdotgopfDoubleContourIntegralsungthetavlooparrowright"
+  "xotimeContourIntegralscsimPfrVeeUcyngtodblacTildeesimSquareSupersetQscr"
+  "Bcyfrac15rharudivlangdisinvNonBreakingSpacetriemupmdscykappasubedot"
+  "gtrarrcomplexesorvTfrnrightarrowduarrCircleTimesulcroptwoheadrightarrow"
+  "tridotRscrleftrightarrowrfishtsubsubsuccsimmhogcyLongLeftArrowhfrxutri"
+  "LessFullEqualBfrupsilonoacutesqsubsetbigsqcupmdashnparsfrGTtopcirlaquo"
+  "KappaWfrPsiemptysetcemptyvgeqqrightthreetimesboxvHNotGreaterLessNscr"
+  "lbracegtrlessecaronvarphihomthtlagranlhblkNewLinemscrasympeqlacuteCscr"
+  "aogonrxsemiHumpEquallozengetauuacuteNotSubsettstrokVerticalLine"
+  "DoubleVerticalBarlrhardiecyllarrZopfensplaplesgesinshchcynsmidgescc"
+  "varproptoTopfswarrowMfroastboxhuTildeEqualYfrthkapnangldrdharLT"
+  "SubsetEqualuparrowOverBracketsqsubeItildeicycsubecompfncudarrr"
+  "triangleleftJcyDoubleLongLeftRightArrownLeftarrownvinfinlbrkslu"
+  "UnderBracketsimnecirmidDownTeeArrowplanckegravelozfRightArrowLeftArrow"
+  "sup2LessGreaterquaternionshardcybigodotcongdotboxdrkappavcacuteyscr"
+  "forallLeftrightarrowfrac23iquesttrianglelefteqdownharpoonrightnvdash"
+  "imaglineRacutebumpeqfiligminusdCenterDotcirRightVectorsquarf"
+  "NotGreaterGreaternltrisuphsolangmsdaaboxhUNotLessAndegsdotboxUlnVdash"
+  "VdashlxnisnvrtrieOgraveograveZfrNotSucceedsTildeanglelatailmicroupsih"
+  "nvapxlarrUnionPlusrceilrightarrowtaildotcaretegisinsnscebigoplusscedil"
+  "HARDcycuescNJcyblk12leftrightarrowsFcyduhartrianglerightolinegesdotol"
+  "lsquonlessveevdashljcyruluhardHargacutecapsDownarrowfrac38subeiumlnhpar"
+  "NotDoubleVerticalBarfrac58LeftDownVectorBarLarrUmacrRightCeilingswarhk"
+  "raemptyvemptyvnwarrowascrShortUpArrowbsolhsubtriplusmumap"
+  "RightTriangleBarrdquoequestsfrownnotinEZscrNotEqualrarrwUarrnuboxVR"
+  "TstrokupdownarrowboxHdCounterClockwiseContourIntegralrBarrncedilrtrie"
+  "RightDownVectorafrabrevengeqqfrac18rthreePoincareplaneeqslantlessGg"
+  "capdotlnelmoustachetriangledownCOPYzeetrfemptyUbrcyDotDotnsube"
+  "preccurlyeqfopfprecneqqtdotsqsubseteqorslopensimeqDelReverseEquilibrium"
+  "vsupnecupcupboxVhRoundImpliesIscrupharpoonleftbnencupicEopfAscrmapsto"
+  "BarwedntriangleleftUpArrowAMPForAllzcytshcyprnsimfcydotplusnotinvbsupnE"
+  "succneqqUparrowPartialDLeftFloorkhcyxrarrvellipinfintieurcornlrarr"
+  "cirfnintandvnwnearpermilprnapLleftarrowdiambetweentradejmathRcedilprnE"
+  "gtreqlessiexclLeftRightVectoraacuteulcornerroangratioangmsdahBackslash"
+  "doteqdotlooparrowleftmaltesexscriiotangelongmapstognepuncspblock"
+  "NegativeThickSpacesdotepsiIumlandslopeImacrkjcysstarfnsqsubenltrielcedil"
+  "iacuteurtritosaplusdoRightTeeVectorLongrightarrowsimeMueenprcueboxur"
+  "GreaterTildeApplyFunctionVvdashXiufrmaptimesSucceedsEqualrtimesogon"
+  "LeftTeevDashlessgtrstrnsLeftArrowRightArrowcularrnsupseteqqgtcir"
+  "leftrightharpoonsTscrefrTHORNCapitalDifferentialDangmsdabUnderBar"
+  "NotSquareSupersetDotLeftarrowordmharrcirwpETHhyphenecirctelrecsubset"
+  "dcaronthinspRopfaposbscrsupepertenklarrlpracuteordfvnsuptrianglesucc"
+  "mnplusprecnapproxnearrrectugravexcapeacutelongrightarrowOtilderadic"
+  "upharpoonrightJsercyRcyimacrngtrintprodltccmldrnrarrclesccnscyfrcopy"
+  "supseteqemacrboxvLvarsubsetneqethxuplusfrac13nrtrieplusovbarverbar"
+  "circlearrowrightgfrSupqintsup1loparxsqcupChincongdotReverseElement"
+  "RightUpDownVectorNotNestedGreaterGreaterLeftVectorNotGreaterTildeapprox"
+  "NcedilofcirAcircrdquorcapandcurvearrowrightDscrrshvzigzagepsiglaparlscr"
+  "LessEqualGreaterrmoustacheENGsqudeltaImpliesvarsubsetneqqrightleftarrows";
+
+static const char sxml_entity_values[] =
+  "\134\303\273\303\232\342\213\233\342\207\230\342\204\257\342\213\221"
+  "\342\226\264\342\250\273\342\212\260\313\231\342\252\257\305\210"
+  "\342\211\242\342\206\272\342\204\227\342\253\220\342\252\216\342\207\203"
+  "\342\245\244\305\240\342\211\252\342\203\222\342\253\256\342\224\274"
+  "\320\220\342\212\220\342\210\227\342\206\231\342\244\234\342\204\221"
+  "\342\210\210\342\206\260\342\206\227\304\240\342\204\231\342\237\246"
+  "\303\205\360\235\222\264\305\243\342\213\243\316\266\175\342\214\205"
+  "\342\252\221\342\244\226\302\260\316\235\342\210\260\342\211\207\317\265"
+  "\360\235\224\212\342\211\210\342\247\243\360\235\225\220\342\252\253"
+  "\342\200\212\136\342\212\263\342\226\256\342\210\267\342\213\275"
+  "\342\245\241\342\210\210\342\210\202\314\270\342\245\225\342\225\237"
+  "\342\251\276\314\270\342\206\231\342\212\226\342\204\202\342\213\246"
+  "\342\253\206\342\247\264\302\274\342\244\232\321\237\342\212\225\303\243"
+  "\304\257\342\211\252\342\210\235\320\251\342\210\235\317\207\342\212\232"
+  "\342\225\220\342\204\233\342\253\213\342\245\236\056\317\203\342\246\206"
+  "\304\230\316\277\342\210\230\320\226\342\207\225\342\214\213\342\211\246"
+  "\342\247\203\360\235\225\201\342\206\244\342\212\212\342\210\267"
+  "\342\252\270\342\252\255\357\270\200\342\210\242\342\212\227\342\207\202"
+  "\321\201\342\212\220\360\235\224\273\360\235\222\263\360\235\224\252"
+  "\342\245\246\342\244\275\302\256\342\211\251\360\235\224\271\321\221"
+  "\342\246\220\342\200\236\342\211\217\314\270\342\224\230\342\212\233"
+  "\342\211\214\317\235\342\211\264\303\233\342\227\202\317\226\342\246\265"
+  "\342\237\272\342\210\247\140\321\216\342\206\226\320\245\342\204\225"
+  "\342\211\200\342\253\206\314\270\320\257\342\253\275\342\247\220\314\270"
+  "\342\206\246\342\247\215\342\227\212\304\204\342\200\207\342\213\237"
+  "\303\244\342\210\254\317\200\302\267\342\213\265\303\226\342\206\230"
+  "\342\212\242\342\207\207\342\246\261\342\227\273\321\213"
+  "\342\211\246\314\270\342\200\265\342\250\252\342\211\256"
+  "\342\211\216\314\270\342\211\247\342\213\261\304\210\342\226\263\304\227"
+  "\342\207\201\342\213\207\342\210\246\305\253\320\237\342\245\227"
+  "\342\224\220\342\224\200\342\252\241\314\270\342\207\215\342\211\211"
+  "\305\234\304\242\304\232\304\214\342\214\242\342\200\231\342\212\205\042"
+  "\342\225\243\342\206\223\342\217\237\076\342\203\222"
+  "\342\212\212\357\270\200\342\230\206\360\235\224\204\342\213\242"
+  "\360\235\225\200\342\200\213\360\235\225\233\342\211\272\342\231\256"
+  "\342\210\241\342\251\276\314\270\342\220\243\342\211\210\342\210\246"
+  "\342\200\264\342\251\270\342\237\267\342\213\220\305\245\342\252\211"
+  "\342\210\241\342\204\222\342\212\241\303\242\316\246\342\244\270"
+  "\342\226\221\342\206\262\342\251\276\342\210\251\342\237\251\342\230\216"
+  "\342\244\251\342\211\220\342\213\216\342\210\272\342\252\206\133"
+  "\360\235\224\207\342\207\244\342\211\205\342\214\212\342\213\226"
+  "\342\252\273\342\206\232\342\211\260\342\212\222\342\252\260"
+  "\342\252\257\314\270\342\231\240\316\237\342\227\272\305\254\342\212\271"
+  "\342\250\245\342\244\220\316\265\342\244\215\342\200\230\342\244\263"
+  "\342\207\212\305\276\342\246\271\342\244\274\342\217\236\316\231"
+  "\342\205\230\342\210\246\342\224\254\342\211\237\342\214\235"
+  "\360\235\225\222\342\206\233\342\253\253\342\213\207\342\250\255"
+  "\360\235\222\277\342\213\266\342\211\262\342\211\250\342\251\277\321\206"
+  "\360\235\225\251\072\305\255\342\212\240\316\245\342\213\253"
+  "\360\235\223\200\011\342\211\245\342\251\257\342\212\200\314\221"
+  "\342\210\237\342\231\246\342\210\223\316\251\342\251\262\342\237\250"
+  "\342\204\217\342\207\225\342\206\222\342\214\277\342\204\265\342\206\222"
+  "\342\204\232\317\226\342\213\257\360\235\224\257\305\242\305\203"
+  "\342\207\220\316\224\342\205\206\342\252\205\342\212\215\342\252\202"
+  "\342\211\224\342\244\220\342\212\273\302\261\342\234\223\342\246\264"
+  "\342\245\205\313\206\302\250\342\226\275\342\225\230\342\210\274\146\152"
+  "\302\275\342\216\261\342\251\275\342\200\236\342\210\255\342\252\272"
+  "\342\213\201\342\253\214\357\270\200\360\235\225\237\342\204\213\304\235"
+  "\342\200\226\305\235\342\211\216\342\225\247\342\251\275\314\270"
+  "\342\212\207\342\212\257\342\237\270\342\210\207\342\250\265\342\214\210"
+  "\360\235\224\221\133\320\264\360\235\223\211\342\213\215\317\202"
+  "\360\235\224\210\342\210\274\342\211\244\317\235\342\211\244\342\203\222"
+  "\316\240\304\244\316\251\342\212\223\342\214\223\303\261\044\342\207\222"
+  "\342\210\275\314\261\342\250\261\360\235\225\236\342\210\226\342\201\243"
+  "\304\236\342\230\205\342\251\267\342\210\213\305\202\342\210\262"
+  "\342\210\253\342\250\226\342\251\203\077\342\206\252\051\342\210\244"
+  "\342\225\227\302\276\342\250\264\360\235\225\253\342\252\270\342\207\214"
+  "\342\252\267\342\237\271\342\204\242\342\216\264\305\266\342\213\241"
+  "\342\210\240\342\210\263\342\251\224\342\253\260\342\200\262\342\252\226"
+  "\342\204\264\342\213\230\302\247\342\252\254\317\261\342\252\260\314\270"
+  "\342\250\272\305\244\360\235\223\217\342\250\246\342\245\212\320\255"
+  "\342\211\246\314\270\342\252\214\342\237\251\302\266\304\226\342\210\265"
+  "\342\211\220\342\253\206\342\245\223\313\235\342\212\237\342\224\234"
+  "\342\212\202\342\203\222\305\267\342\245\221\360\235\225\242\342\250\225"
+  "\342\251\234\342\211\200\342\226\252\303\254\342\211\272\342\227\257"
+  "\342\207\244\342\226\270\342\212\203\342\203\222\342\213\276\342\200\213"
+  "\302\263\342\253\244\360\235\225\235\357\254\200\313\230\342\210\245"
+  "\342\204\254\342\206\275\342\204\221\342\200\212\302\250\316\270"
+  "\342\226\253\342\212\200\342\210\244\342\250\243\360\235\224\240"
+  "\342\207\211\342\230\205\342\245\276\342\211\260\342\246\274\342\247\204"
+  "\342\206\225\360\235\225\216\342\252\244\342\246\223\304\246\305\236"
+  "\303\234\342\213\233\342\252\227\342\246\255\321\223\360\235\225\224"
+  "\342\200\235\360\235\224\264\342\212\213\342\211\216\342\252\222\304\215"
+  "\342\250\244\316\233\342\252\224\342\213\200\320\261\342\205\231"
+  "\342\204\221\342\253\214\342\211\212\342\211\215\304\265\054\342\204\213"
+  "\342\200\215\303\264\342\244\245\303\214\342\213\217\342\246\276\316\261"
+  "\342\211\242\342\207\231\342\213\232\357\270\200\342\210\277\342\213\224"
+  "\342\210\276\050\342\253\263\304\266\342\237\250\342\212\202\342\203\222"
+  "\043\303\221\342\211\261\342\247\211\342\210\252\357\270\200\342\205\210"
+  "\342\210\205\321\226\342\211\251\342\206\251\342\211\261\137\303\200"
+  "\360\235\224\246\057\342\212\264\342\203\222\304\270\302\240\342\206\222"
+  "\342\213\274\342\246\224\321\227\342\214\213\342\210\204\342\250\263"
+  "\303\205\342\245\261\342\206\244\342\212\247\342\206\220\360\235\224\256"
+  "\316\226\360\235\224\254\304\201\342\250\215\342\216\266\342\200\231"
+  "\342\204\234\342\206\226\342\212\235\342\211\272\342\226\270\303\216"
+  "\342\211\263\357\254\203\342\204\230\342\204\263\342\231\255\342\200\220"
+  "\342\204\255\360\235\224\233\303\235\342\250\270\342\204\263\342\247\216"
+  "\342\211\224\342\206\227\317\265\342\250\227\342\210\245\342\251\275"
+  "\342\211\211\342\213\251\342\245\226\342\206\263\342\207\216\342\226\276"
+  "\342\253\222\342\212\270\342\210\250\342\244\204\342\211\273\342\206\275"
+  "\360\235\223\206\360\235\225\203\342\205\210\360\235\222\275\342\252\220"
+  "\342\210\264\342\211\255\342\237\250\342\212\200\302\270\342\207\213"
+  "\342\212\255\302\264\342\206\223\342\212\231\342\204\221\316\227"
+  "\342\205\207\342\204\231\342\200\276\342\246\247\342\200\217\342\244\240"
+  "\342\253\204\342\252\212\360\235\225\252\303\266\342\210\243\342\212\211"
+  "\342\252\254\357\270\200\342\204\255\342\206\220\342\212\224\342\211\262"
+  "\342\247\217\314\270\317\261\342\250\266\342\225\245\342\237\247\175"
+  "\342\246\217\342\213\265\314\270\342\213\247\342\206\274\342\244\202"
+  "\342\206\255\342\201\242\342\210\265\342\231\240\342\207\235\321\232"
+  "\342\206\245\342\201\227\342\245\211\342\212\264\342\211\244\342\210\244"
+  "\317\201\342\235\263\360\235\225\206\342\207\222\342\210\204\342\247\266"
+  "\342\224\202\342\252\237\342\210\235\342\206\236\342\237\266\342\252\275"
+  "\304\220\317\202\342\226\265\342\212\217\342\212\267\342\252\242"
+  "\342\204\225\342\207\217\342\200\204\342\253\205\314\270\342\225\226"
+  "\360\235\222\245\342\253\210\342\204\215\342\200\231\342\204\217\313\234"
+  "\320\234\342\245\253\342\214\243\342\244\246\303\223\342\211\266"
+  "\360\235\225\241\342\245\256\303\277\342\213\241\342\252\274"
+  "\360\235\224\231\305\211\342\204\267\304\234\342\244\221\304\256\305\231"
+  "\342\216\260\360\235\224\215\342\211\222\342\237\247\342\210\236\305\230"
+  "\342\211\275\306\222\342\251\210\305\223\342\212\206\342\210\204"
+  "\342\237\274\342\253\231\342\251\214\305\241\342\225\236\302\270\313\207"
+  "\342\253\205\320\207\342\207\205\342\237\251\342\210\211\342\207\210"
+  "\342\207\201\320\202\342\206\230\342\212\262\320\266\305\220\342\225\231"
+  "\342\205\206\342\211\207\342\206\243\342\252\260\342\251\252\320\232"
+  "\342\247\201\303\207\342\204\254\342\210\211\342\213\224\305\207"
+  "\342\211\222\342\226\264\342\250\247\304\200\342\213\200\316\267"
+  "\342\211\220\314\270\342\211\232\342\246\244\052\342\214\237\342\252\272"
+  "\342\211\234\320\272\342\211\223\342\212\213\076\342\207\212\342\201\203"
+  "\342\213\203\342\212\250\342\227\274\342\211\227\342\210\256\342\212\225"
+  "\342\212\244\342\210\264\342\213\227\342\227\203\342\214\237\342\212\222"
+  "\342\210\261\074\342\206\220\342\210\226\320\250\320\271\342\213\213"
+  "\342\206\277\342\204\234\342\205\236\360\235\224\224\342\211\252\314\270"
+  "\303\215\321\207\342\211\220\360\235\223\205\342\213\232\342\213\222"
+  "\342\211\276\342\252\266\342\244\214\174\303\247\316\225\342\210\243"
+  "\342\210\265\342\206\220\360\235\222\242\342\244\205\342\213\201"
+  "\342\200\263\342\206\223\321\217\305\257\342\206\256\342\207\203"
+  "\342\213\233\357\270\200\342\210\201\321\200\320\260\342\217\234"
+  "\342\246\235\342\246\260\360\235\222\262\342\245\257\342\210\243\302\264"
+  "\317\221\342\204\216\342\200\232\342\253\205\342\211\247\314\270"
+  "\342\237\246\304\264\342\206\252\320\277\302\257\342\210\270\342\201\204"
+  "\342\205\205\342\207\245\342\206\275\342\212\221\342\245\273\342\200\271"
+  "\342\212\265\342\212\210\305\201\342\213\226\342\211\241\320\206"
+  "\342\214\215\342\213\254\342\245\274\342\210\203\303\201\342\201\217"
+  "\342\251\260\314\270\303\253\342\245\277\342\212\263\342\213\255"
+  "\342\211\263\342\217\235\342\226\276\342\250\223\140\342\252\277\302\256"
+  "\342\231\245\342\252\257\342\214\255\342\226\277\342\204\254\305\213"
+  "\342\217\247\342\244\245\342\250\260\342\212\235\342\210\247"
+  "\360\235\225\243\342\252\255\342\211\240\317\225\342\214\206\342\210\264"
+  "\342\231\243\342\252\231\321\224\342\205\227\342\213\217\342\204\222"
+  "\342\213\254\306\265\342\211\250\357\270\200\342\244\217\342\250\256"
+  "\342\210\275\052\342\252\247\342\211\253\342\203\222\342\252\213"
+  "\342\250\201\342\246\226\342\204\261\342\213\230\314\270\342\200\265"
+  "\342\207\225\342\207\214\342\246\273\342\210\214\303\237\342\244\267"
+  "\342\252\206\304\273\342\251\213\342\212\266\342\247\244\342\245\224"
+  "\342\244\250\320\224\303\211\342\250\242\342\211\252\360\235\224\261"
+  "\303\204\305\250\304\251\342\244\271\342\211\273\320\204\342\200\211"
+  "\342\211\253\342\213\225\342\253\213\342\252\210\360\235\224\253"
+  "\342\244\223\342\207\221\342\207\211\342\212\277\342\210\235\342\207\233"
+  "\360\235\225\231\320\273\304\222\316\230\342\251\235\342\200\242\304\221"
+  "\342\253\217\320\274\342\212\223\342\211\226\342\211\217\342\246\252"
+  "\342\200\223\342\204\264\360\235\223\210\305\256\342\206\273\304\267"
+  "\342\246\245\360\235\225\246\342\252\207\342\247\205\342\252\235"
+  "\342\246\225\342\246\222\342\211\201\342\253\226\302\275\360\235\225\250"
+  "\342\252\212\342\231\200\342\212\245\342\253\200\360\235\222\246"
+  "\342\204\260\342\252\257\314\270\342\213\253\342\204\263\342\212\232"
+  "\342\253\201\342\211\250\360\235\224\251\342\250\251\342\211\202\314\270"
+  "\342\211\251\357\270\200\342\247\234\342\244\215\342\211\200\342\252\217"
+  "\342\210\211\321\214\342\211\245\342\203\222\342\253\275\342\203\245"
+  "\342\201\242\342\227\270\342\251\237\342\246\254\342\206\255\342\200\241"
+  "\342\204\264\342\246\267\342\225\233\316\222\342\245\263\342\206\267"
+  "\342\244\222\342\237\272\342\251\205\342\225\246\342\200\272\342\247\200"
+  "\342\210\276\342\206\272\342\246\256\342\253\247\317\266\360\235\225\245"
+  "\342\211\276\320\246\342\207\275\304\245\342\253\233"
+  "\342\211\251\357\270\200\360\235\224\237\342\206\256\342\211\274"
+  "\342\206\247\342\211\226\342\212\272\317\222\342\210\276\314\263"
+  "\342\245\240\342\245\262\342\244\237\342\211\252\316\223"
+  "\342\206\235\314\270\342\244\252\342\252\256\316\276\342\211\247\314\270"
+  "\342\212\263\320\217\342\211\241\342\203\245\342\212\272\303\245"
+  "\342\206\222\320\205\342\245\235\342\237\267\342\245\265\342\245\222"
+  "\342\211\211\342\213\243\360\235\222\270\342\245\252\342\234\240"
+  "\342\253\251\342\204\213\342\235\262\342\211\253\305\264\342\204\232"
+  "\302\243\342\214\236\342\212\236\305\260\342\212\237\342\213\255"
+  "\342\211\216\314\270\342\251\206\303\224\320\211\342\205\232"
+  "\360\235\223\212\342\210\221\075\342\253\224\360\235\224\275"
+  "\360\235\225\234\342\253\205\314\270\360\235\222\271\342\204\235"
+  "\360\235\224\226\305\222\342\210\262\342\251\261\342\251\215\342\252\252"
+  "\342\211\267\342\207\224\317\205\342\244\203\342\237\254\342\212\265"
+  "\321\215\360\235\225\244\342\212\216\342\210\226\342\210\253\342\252\264"
+  "\304\237\342\226\200\342\213\236\342\244\266\342\210\217\342\206\277"
+  "\304\241\342\213\205\317\234\100\321\230\320\253\305\271\342\204\266"
+  "\342\207\204\357\254\202\342\253\207\342\227\202\342\211\225"
+  "\342\211\213\314\270\342\213\210\316\243\342\210\214\342\227\257"
+  "\342\226\252\342\211\275\342\213\231\314\270\342\213\252\342\204\270"
+  "\317\221\303\230\342\211\205\342\213\251\342\211\247\342\212\212\304\261"
+  "\342\246\253\342\211\225\305\274\360\235\224\250\342\217\242"
+  "\360\235\222\252\313\234\342\250\202\320\233\342\250\214\360\235\223\214"
+  "\342\237\270\342\200\241\342\210\243\342\211\213\360\235\224\230\304\247"
+  "\342\210\221\342\211\212\342\204\214\342\214\220\360\235\223\207\304\263"
+  "\342\212\276\305\273\342\200\232\342\213\211\304\212\042\342\210\226"
+  "\342\207\214\342\211\204\342\210\275\342\250\221\342\201\241\342\246\213"
+  "\342\231\256\342\207\224\342\251\271\342\212\236\342\204\205\321\222"
+  "\342\225\224\317\265\360\235\224\216\342\201\240\342\207\223\342\212\231"
+  "\342\214\216\342\212\224\320\276\342\252\257\314\270\342\253\232"
+  "\342\225\232\360\235\223\203\305\215\342\207\201\342\251\276\316\263"
+  "\342\211\241\342\207\203\342\251\260\342\252\200\342\234\266"
+  "\360\235\225\202\342\245\237\342\244\244\342\214\210\342\214\266\302\261"
+  "\342\212\201\313\230\342\245\213\342\235\230\342\213\262\360\235\224\265"
+  "\320\241\321\203\342\212\262\342\250\274\320\247\342\215\274\320\256"
+  "\342\252\214\320\275\303\256\342\204\244\342\246\234\320\222\342\251\211"
+  "\342\212\251\317\225\321\210\342\212\222\303\265\360\235\225\226"
+  "\342\211\253\314\270\303\275\342\206\251\342\213\202\342\206\245"
+  "\342\224\200\342\210\220\342\211\204\342\211\276\342\212\243\342\237\253"
+  "\342\210\256\342\210\203\342\212\204\342\200\216\304\202\305\270"
+  "\342\212\203\342\212\203\342\203\222\342\245\256\342\245\271\342\206\276"
+  "\360\235\225\232\342\211\274\342\213\204\342\200\240\305\204"
+  "\360\235\225\240\342\213\215\317\260\342\253\250\360\235\224\222"
+  "\342\206\265\342\206\276\303\212\316\271\360\235\224\241\342\237\252"
+  "\342\211\210\342\212\245\342\207\205\342\237\267\320\230\342\200\234"
+  "\342\210\274\302\254\342\206\242\342\201\237\342\212\203\342\245\234"
+  "\342\200\213\302\244\342\253\223\342\214\226\342\210\213\173\342\204\260"
+  "\342\247\253\305\272\342\213\216\317\266\342\213\272\342\252\211"
+  "\342\226\275\342\211\253\342\207\220\342\210\201\342\211\216\342\211\202"
+  "\342\216\265\342\211\262\360\235\222\273\360\235\224\276\342\206\254"
+  "\303\206\357\254\204\342\212\211\320\214\342\207\245\342\200\234"
+  "\360\235\222\261\041\317\202\342\211\203\342\246\216\342\207\227"
+  "\342\251\226\342\211\250\357\270\200\342\250\222\342\252\267"
+  "\360\235\224\267\305\214\342\251\263\304\213\342\250\277\342\231\243"
+  "\342\213\231\302\242\342\200\205\342\253\214\357\270\200\342\212\202"
+  "\342\210\245\320\235\342\212\241\342\253\230\305\265\342\207\222"
+  "\342\251\275\342\252\215\342\251\275\314\270\342\210\202\302\267"
+  "\342\225\235\342\226\271\342\246\214\342\213\223\342\204\234\342\214\236"
+  "\304\262\304\276\342\247\217\342\211\223\302\255\342\213\271\342\213\203"
+  "\360\235\222\260\342\211\202\314\270\342\250\267\342\237\271\342\200\213"
+  "\342\251\264\342\225\242\342\207\224\342\246\266\342\200\214\342\213\203"
+  "\342\250\257\342\212\213\357\270\200\342\212\264\342\226\223\342\247\202"
+  "\305\200\316\221\313\207\342\210\223\342\213\206\342\252\241\342\207\200"
+  "\303\203\342\206\266\304\216\360\235\225\212\342\214\205\342\206\222"
+  "\342\223\210\342\251\265\342\251\275\314\270\320\223\320\201"
+  "\342\201\237\342\200\212\342\225\222\320\262\305\275\342\207\216\304\206"
+  "\342\246\246\304\271\342\212\245\342\211\275\342\210\217\342\206\221"
+  "\342\251\267\342\210\252\316\241\342\244\216\342\252\203\303\246"
+  "\360\235\224\270\342\251\276\314\270\342\250\200\342\214\214\342\206\241"
+  "\342\225\223\342\212\244\360\235\224\255\342\204\234\342\224\244"
+  "\342\210\213\342\211\267\342\214\234\342\206\240\342\213\204\342\212\217"
+  "\342\234\227\342\213\250\342\210\257\342\211\227\342\204\261\342\207\221"
+  "\302\246\360\235\222\253\342\245\264\342\225\221\342\251\256\305\263"
+  "\342\245\230\304\211\321\236\342\212\201\342\210\255\342\225\254"
+  "\342\204\212\303\213\342\211\201\342\245\220\342\225\251\342\212\262"
+  "\303\240\342\207\233\342\252\236\342\213\220\342\212\253\305\227"
+  "\342\213\240\342\211\277\342\207\226\342\225\225\342\252\240\342\244\250"
+  "\360\235\225\214\342\212\226\342\237\277\342\200\245\342\244\243"
+  "\342\206\242\305\233\342\213\260\342\211\221\342\213\263\342\211\264"
+  "\342\244\236\342\251\274\342\212\211\303\276\342\237\265\360\235\225\204"
+  "\342\245\232\303\231\303\267\304\277\342\211\270\342\210\274\342\203\222"
+  "\342\200\246\342\206\225\342\211\210\304\260\302\256\342\213\232\317\211"
+  "\342\207\276\342\206\224\342\223\210\342\253\202\302\250\342\231\245"
+  "\342\251\220\342\211\217\314\270\342\211\271\342\234\223\342\231\202"
+  "\342\206\230\360\235\222\256\342\252\257\342\211\214\313\235\342\212\240"
+  "\342\226\241\342\211\245\342\212\210\316\244\342\226\241\360\235\225\223"
+  "\342\213\202\342\252\226\342\231\246\320\225\303\270\305\261\342\213\213"
+  "\342\252\260\314\270\342\214\243\342\212\203\342\211\252\314\270"
+  "\342\251\225\303\210\342\211\246\305\262\342\252\201\313\232"
+  "\360\235\224\217\360\235\225\217\342\252\276\342\212\223\357\270\200"
+  "\342\206\232\135\316\262\342\210\232\342\253\244\342\226\261\342\207\217"
+  "\320\203\360\235\223\213\304\231\360\235\224\243\360\235\224\211"
+  "\342\205\226\342\204\226\342\237\270\342\213\200\342\245\251"
+  "\342\253\213\357\270\200\342\203\233\342\245\254\302\245\342\251\276"
+  "\320\236\074\342\203\222\320\254\342\226\252\342\207\265\342\206\220"
+  "\342\251\207\342\200\226\342\231\257\342\245\266\342\211\254\342\211\270"
+  "\342\206\261\304\275\342\253\254\342\213\236\320\227\342\200\203"
+  "\342\204\223\342\207\210\305\232\046\342\211\245\342\204\217\342\200\242"
+  "\320\213\342\212\217\314\270\360\235\224\263\342\206\274\342\252\213"
+  "\302\273\342\206\260\342\213\253\342\211\257\342\205\207\342\210\214"
+  "\342\207\223\342\253\255\342\245\242\342\207\232\316\273\360\235\224\247"
+  "\342\214\222\342\207\277\342\202\254\342\247\245\342\214\256\305\251"
+  "\342\252\225\045\360\235\222\276\321\202\342\211\265\360\235\225\215"
+  "\317\206\342\250\224\342\244\233\342\206\235\342\204\265\342\212\275"
+  "\342\252\263\342\212\230\342\210\220\342\211\231\342\251\273\342\200\225"
+  "\342\211\260\342\212\245\342\211\224\135\342\206\223\360\235\225\247"
+  "\342\245\243\342\210\222\320\242\342\211\202\304\261\342\253\227"
+  "\342\212\224\357\270\200\342\250\204\342\206\224\303\274\342\244\235"
+  "\360\235\225\225\342\213\227\360\235\225\230\342\210\257\342\231\252"
+  "\317\221\342\206\254\342\250\202\342\210\256\342\211\277\360\235\224\223"
+  "\342\213\201\320\243\342\211\257\305\221\342\210\274\342\211\202"
+  "\342\212\220\360\235\222\254\320\221\342\205\225\342\207\200\303\267"
+  "\342\246\221\342\210\210\302\240\342\211\234\316\274\302\261\321\225"
+  "\316\272\342\253\203\342\245\270\342\204\202\342\251\233\360\235\224\227"
+  "\342\206\233\342\207\265\342\212\227\342\214\217\342\206\240\342\227\254"
+  "\342\204\233\342\206\224\342\245\275\342\253\225\342\211\277\342\204\247"
+  "\320\263\342\237\265\360\235\224\245\342\226\263\342\211\246"
+  "\360\235\224\205\317\205\303\263\342\212\217\342\250\206\342\200\224"
+  "\342\210\246\360\235\224\260\076\342\253\261\302\253\316\232"
+  "\360\235\224\232\316\250\342\210\205\342\246\262\342\211\247\342\213\214"
+  "\342\225\252\342\211\271\360\235\222\251\173\342\211\267\304\233\317\225"
+  "\342\210\273\342\204\222\342\226\204\012\360\235\223\202\342\211\215"
+  "\304\272\360\235\222\236\304\205\342\204\236\073\342\211\217\342\227\212"
+  "\317\204\303\272\342\212\202\342\203\222\305\247\174\342\210\245"
+  "\342\245\255\320\265\342\207\207\342\204\244\342\200\202\342\252\205"
+  "\342\252\223\342\210\210\321\211\342\210\244\342\252\251\342\210\235"
+  "\360\235\225\213\342\206\231\360\235\224\220\342\212\233\342\224\264"
+  "\342\211\203\360\235\224\234\342\211\210\342\210\240\342\203\222"
+  "\342\245\247\074\342\212\206\342\206\221\342\216\264\342\212\221\304\250"
+  "\320\270\342\253\221\342\210\230\342\244\265\342\227\203\320\231"
+  "\342\237\272\342\207\215\342\247\236\342\246\215\342\216\265\342\211\206"
+  "\342\253\257\342\206\247\342\204\217\303\250\342\247\253\342\207\204"
+  "\302\262\342\211\266\342\204\215\321\212\342\250\200\342\251\255"
+  "\342\224\214\317\260\304\207\360\235\223\216\342\210\200\342\207\224"
+  "\342\205\224\302\277\342\212\264\342\207\202\342\212\254\342\204\220"
+  "\305\224\342\211\217\357\254\201\342\210\270\302\267\342\227\213"
+  "\342\207\200\342\226\252\342\211\253\314\270\342\213\252\342\237\211"
+  "\342\246\250\342\225\250\342\211\256\342\251\223\342\252\230\342\225\234"
+  "\342\212\256\342\253\246\342\213\273\342\212\265\342\203\222\303\222"
+  "\303\262\342\204\250\342\211\277\314\270\342\210\240\342\244\231\302\265"
+  "\317\222\342\211\215\342\203\222\342\237\265\342\212\216\342\214\211"
+  "\342\206\243\313\231\342\201\201\342\252\232\342\213\264"
+  "\342\252\260\314\270\342\250\201\305\237\320\252\342\213\237\320\212"
+  "\342\226\222\342\207\206\320\244\342\245\257\342\226\271\342\200\276"
+  "\342\252\204\342\200\230\342\211\256\342\210\250\342\212\242\321\231"
+  "\342\245\250\342\245\245\307\265\342\210\251\357\270\200\342\207\223"
+  "\342\205\234\342\212\206\303\257\342\253\262\342\210\246\342\205\235"
+  "\342\245\231\342\206\236\305\252\342\214\211\342\244\246\342\246\263"
+  "\342\210\205\342\206\226\360\235\222\266\342\206\221\342\237\210"
+  "\342\250\271\342\212\270\342\247\220\342\200\235\342\211\237\342\214\242"
+  "\342\213\271\314\270\360\235\222\265\342\211\240\342\206\235\342\206\237"
+  "\316\275\342\225\240\305\246\342\206\225\342\225\244\342\210\263"
+  "\342\244\217\305\206\342\212\265\342\207\202\360\235\224\236\304\203"
+  "\342\211\247\314\270\342\205\233\342\213\214\342\204\214\342\252\225"
+  "\342\213\231\342\251\200\342\252\207\342\216\260\342\226\277\302\251"
+  "\342\204\250\342\210\205\320\216\342\203\234\342\212\210\342\211\274"
+  "\360\235\225\227\342\252\265\342\203\233\342\212\221\342\251\227"
+  "\342\211\204\342\210\207\342\207\213\342\212\213\357\270\200\342\251\212"
+  "\342\225\253\342\245\260\342\204\220\342\206\277\075\342\203\245"
+  "\342\251\202\342\201\243\360\235\224\274\360\235\222\234\342\206\246"
+  "\342\214\206\342\213\252\342\206\221\046\342\210\200\320\267\321\233"
+  "\342\213\250\321\204\342\210\224\342\213\267\342\253\214\342\252\266"
+  "\342\207\221\342\210\202\342\214\212\321\205\342\237\266\342\213\256"
+  "\342\247\235\342\214\235\342\207\206\342\250\220\342\251\232\342\244\247"
+  "\342\200\260\342\252\271\342\207\232\342\213\204\342\211\254\342\204\242"
+  "\310\267\305\226\342\252\265\342\213\233\302\241\342\245\216\303\241"
+  "\342\214\234\342\237\255\342\210\266\342\246\257\342\210\226\342\211\221"
+  "\342\206\253\342\234\240\360\235\223\215\342\204\251\342\211\261"
+  "\342\237\274\342\252\210\342\200\210\342\226\210\342\200\213\342\251\246"
+  "\317\210\303\217\342\251\230\304\252\321\234\342\213\206\342\213\242"
+  "\342\213\254\304\274\303\255\342\227\271\342\244\251\342\210\224"
+  "\342\245\233\342\237\271\342\211\203\316\234\342\205\207\342\213\240"
+  "\342\224\224\342\211\263\342\201\241\342\212\252\316\236\360\235\224\262"
+  "\342\206\246\303\227\342\252\260\342\213\212\313\233\342\212\243"
+  "\342\212\250\342\211\266\302\257\342\207\206\342\206\266"
+  "\342\253\206\314\270\342\251\272\342\207\213\360\235\222\257"
+  "\360\235\224\242\303\236\342\205\205\342\246\251\137\342\212\220\314\270"
+  "\302\250\342\207\220\302\272\342\245\210\342\204\230\303\220\342\200\220"
+  "\303\252\342\214\225\342\212\202\304\217\342\200\211\342\204\235\047"
+  "\360\235\222\267\342\212\207\342\200\261\342\206\253\305\225\302\252"
+  "\342\212\203\342\203\222\342\226\265\342\211\273\342\210\223\342\252\271"
+  "\342\206\227\342\226\255\303\271\342\213\202\303\251\342\237\266\303\225"
+  "\342\210\232\342\206\276\320\210\320\240\304\253\342\211\257\342\250\274"
+  "\342\252\246\342\200\246\342\244\263\314\270\342\252\250\342\212\201"
+  "\360\235\224\266\302\251\342\212\207\304\223\342\225\241"
+  "\342\212\212\357\270\200\303\260\342\250\204\342\205\223\342\213\255\053"
+  "\342\214\275\174\342\206\273\360\235\224\244\342\213\221\342\250\214"
+  "\302\271\342\246\205\342\250\206\316\247\342\251\255\314\270\342\210\213"
+  "\342\245\217\342\252\242\314\270\342\206\274\342\211\265\342\211\210"
+  "\305\205\342\246\277\303\202\342\200\235\342\251\204\342\206\267"
+  "\360\235\222\237\342\206\261\342\246\232\316\265\342\252\245\342\210\245"
+  "\360\235\223\201\342\213\232\342\216\261\305\212\342\226\241\316\264"
+  "\342\207\222\342\253\213\357\270\200\342\207\204";
+
+#endif
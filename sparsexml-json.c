@@ -0,0 +1,496 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "sparsexml-priv.h"
+#include "sparsexml-json.h"
+
+#define SXMLJsonOnes 0x0101010101010101ull
+#define SXMLJsonHighs 0x8080808080808080ull
+
+// One per open element, the document at level 0
+typedef struct {
+  unsigned char open;          // Its object has been written
+  unsigned char members;       // It has members, the next one needs a comma
+  unsigned char array;         // An array of the last child's name is open
+  unsigned short child;        // Pool offset of the last child's name
+  unsigned short child_len;
+} SXMLJsonLevel;
+
+struct __SXMLJson {
+  SXMLExplorer* explorer;
+  char* buffer;
+  unsigned int size;
+  unsigned int used;
+  unsigned int options;
+  char prefix[SXMLJsonKeyLength];
+  unsigned int prefix_len;
+  char text_key[SXMLJsonKeyLength];
+  unsigned int text_key_len;
+
+  unsigned int depth;
+  SXMLJsonLevel levels[SXMLJsonMaxDepth + 1];
+  char names[SXMLJsonNamePoolLength];
+  unsigned int names_used;
+  char text[SXMLElementLength];  // Text of the innermost element not written yet
+  unsigned int text_len;
+
+  unsigned char (*sink_func)(void *, const char *, unsigned int);
+  void* sink_user;
+};
+
+// =============================================================================
+// OUTPUT
+// =============================================================================
+
+static unsigned char priv_sxml_json_drain(SXMLJson* json) {
+  unsigned int used = json->used;
+
+  if (json->sink_func == NULL) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  json->used = 0;
+  return used > 0 ? json->sink_func(json->sink_user, json->buffer, used) : SXMLExplorerContinue;
+}
+
+static unsigned char priv_sxml_json_write(SXMLJson* json, const char* data, unsigned int len) {
+  while (len > 0) {
+    unsigned int n = json->size - json->used;
+    if (n == 0) {
+      unsigned char ret = priv_sxml_json_drain(json);
+      if (ret != SXMLExplorerContinue) {
+        return ret;
+      }
+      continue;
+    }
+    n = len < n ? len : n;
+    memcpy(json->buffer + json->used, data, n);
+    json->used += n;
+    data += n;
+    len -= n;
+  }
+  return SXMLExplorerContinue;
+}
+
+static unsigned char priv_sxml_json_char(SXMLJson* json, char c) {
+  if (json->used == json->size) {
+    unsigned char ret = priv_sxml_json_drain(json);
+    if (ret != SXMLExplorerContinue) {
+      return ret;
+    }
+  }
+  json->buffer[json->used++] = c;
+  return SXMLExplorerContinue;
+}
+
+// =============================================================================
+// STRINGS
+// =============================================================================
+
+static unsigned char priv_sxml_json_escaped(unsigned char c) {
+  return c < 0x20 || c == '"' || c == '\\';
+}
+
+// Length of the leading run that needs no escape: eight bytes at a time
+// while none is a quote, a backslash or a control character, then bytewise
+static unsigned int priv_sxml_json_plain(const char* text, unsigned int len) {
+  unsigned int i = 0;
+
+  while (i + 8 <= len) {
+    unsigned long long word, quote, slash;
+    memcpy(&word, text + i, 8);
+    quote = word ^ (SXMLJsonOnes * '"');
+    slash = word ^ (SXMLJsonOnes * '\\');
+    if ((((word - SXMLJsonOnes * 0x20) & ~word) |
+         ((quote - SXMLJsonOnes) & ~quote) |
+         ((slash - SXMLJsonOnes) & ~slash)) & SXMLJsonHighs) {
+      break;
+    }
+    i += 8;
+  }
+  while (i < len && !priv_sxml_json_escaped((unsigned char)text[i])) {
+    i++;
+  }
+  return i;
+}
+
+static unsigned char priv_sxml_json_escape(SXMLJson* json, const char* text, unsigned int len) {
+  static const char hex[] = "0123456789abcdef";
+  unsigned int i = 0;
+
+  while (i < len) {
+    unsigned int run = priv_sxml_json_plain(text + i, len - i);
+    unsigned char ret, c;
+    char escape[6] = { '\\', 'u', '0', '0', 0, 0 };
+    unsigned int escape_len = 2;
+
+    ret = priv_sxml_json_write(json, text + i, run);
+    if (ret != SXMLExplorerContinue || (i += run) == len) {
+      return ret;
+    }
+    c = (unsigned char)text[i++];
+    switch (c) {
+      case '"': escape[1] = '"'; break;
+      case '\\': escape[1] = '\\'; break;
+      case '\b': escape[1] = 'b'; break;
+      case '\f': escape[1] = 'f'; break;
+      case '\n': escape[1] = 'n'; break;
+      case '\r': escape[1] = 'r'; break;
+      case '\t': escape[1] = 't'; break;
+      default:
+        escape[4] = hex[c >> 4];
+        escape[5] = hex[c & 0x0F];
+        escape_len = 6;
+        break;
+    }
+    ret = priv_sxml_json_write(json, escape, escape_len);
+    if (ret != SXMLExplorerContinue) {
+      return ret;
+    }
+  }
+  return SXMLExplorerContinue;
+}
+
+static unsigned char priv_sxml_json_string(SXMLJson* json, const char* text, unsigned int len) {
+  unsigned char ret = priv_sxml_json_char(json, '"');
+  if (ret == SXMLExplorerContinue) {
+    ret = priv_sxml_json_escape(json, text, len);
+  }
+  return ret == SXMLExplorerContinue ? priv_sxml_json_char(json, '"') : ret;
+}
+
+static unsigned char priv_sxml_json_space(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static unsigned char priv_sxml_json_digit(const char* text, unsigned int i, unsigned int len) {
+  return i < len && (unsigned char)(text[i] - '0') < 10;
+}
+
+// Numbers in the JSON grammar, true and false
+static unsigned char priv_sxml_json_literal(const char* text, unsigned int len) {
+  unsigned int i = 0;
+
+  if ((len == 4 && memcmp(text, "true", 4) == 0) || (len == 5 && memcmp(text, "false", 5) == 0)) {
+    return 1;
+  }
+  if (i < len && text[i] == '-') {
+    i++;
+  }
+  if (!priv_sxml_json_digit(text, i, len)) {
+    return 0;
+  }
+  if (text[i++] != '0') {
+    while (priv_sxml_json_digit(text, i, len)) {
+      i++;
+    }
+  }
+  if (i < len && text[i] == '.') {
+    if (!priv_sxml_json_digit(text, ++i, len)) {
+      return 0;
+    }
+    while (priv_sxml_json_digit(text, i, len)) {
+      i++;
+    }
+  }
+  if (i < len && (text[i] == 'e' || text[i] == 'E')) {
+    if (++i < len && (text[i] == '+' || text[i] == '-')) {
+      i++;
+    }
+    if (!priv_sxml_json_digit(text, i, len)) {
+      return 0;
+    }
+    while (priv_sxml_json_digit(text, i, len)) {
+      i++;
+    }
+  }
+  return i == len;
+}
+
+static unsigned char priv_sxml_json_value(SXMLJson* json, const char* text, unsigned int len) {
+  if (json->options & SXMLJsonTypedValues) {
+    const char* start = text;
+    unsigned int trimmed = len;
+    while (trimmed > 0 && priv_sxml_json_space(*start)) {
+      start++;
+      trimmed--;
+    }
+    while (trimmed > 0 && priv_sxml_json_space(start[trimmed - 1])) {
+      trimmed--;
+    }
+    if (priv_sxml_json_literal(start, trimmed)) {
+      return priv_sxml_json_write(json, start, trimmed);
+    }
+  }
+  return priv_sxml_json_string(json, text, len);
+}
+
+// =============================================================================
+// MEMBERS
+// =============================================================================
+
+static unsigned char priv_sxml_json_key(SXMLJson* json, SXMLJsonLevel* level, const char* prefix, unsigned int prefix_len,
+                                        const char* name, unsigned int len) {
+  unsigned char ret = SXMLExplorerContinue;
+
+  if (level->members) {
+    ret = priv_sxml_json_char(json, ',');
+  }
+  level->members = 1;
+  if (ret == SXMLExplorerContinue) {
+    ret = priv_sxml_json_char(json, '"');
+  }
+  if (ret == SXMLExplorerContinue) {
+    ret = priv_sxml_json_escape(json, prefix, prefix_len);
+  }
+  if (ret == SXMLExplorerContinue) {
+    ret = priv_sxml_json_escape(json, name, len);
+  }
+  return ret == SXMLExplorerContinue ? priv_sxml_json_write(json, "\":", 2) : ret;
+}
+
+static unsigned char priv_sxml_json_close_array(SXMLJson* json, SXMLJsonLevel* level) {
+  if (!level->array) {
+    return SXMLExplorerContinue;
+  }
+  level->array = 0;
+  level->child_len = 0;
+  return priv_sxml_json_char(json, ']');
+}
+
+static unsigned char priv_sxml_json_blank(const char* text, unsigned int len) {
+  unsigned int i;
+  for (i = 0; i < len; i++) {
+    if (!priv_sxml_json_space(text[i])) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+// Writes the innermost element's pending text as a "#text" member
+static unsigned char priv_sxml_json_flush_text(SXMLJson* json, SXMLJsonLevel* level) {
+  unsigned int len = json->text_len;
+  unsigned char ret;
+
+  json->text_len = 0;
+  if (len == 0 || priv_sxml_json_blank(json->text, len)) {
+    return SXMLExplorerContinue;
+  }
+  ret = priv_sxml_json_close_array(json, level);
+  if (ret == SXMLExplorerContinue) {
+    ret = priv_sxml_json_key(json, level, "", 0, json->text_key, json->text_key_len);
+  }
+  return ret == SXMLExplorerContinue ? priv_sxml_json_value(json, json->text, len) : ret;
+}
+
+static unsigned char priv_sxml_json_open(SXMLJson* json, SXMLJsonLevel* level) {
+  unsigned char ret;
+
+  if (level->open) {
+    return priv_sxml_json_flush_text(json, level);
+  }
+  level->open = 1;
+  ret = priv_sxml_json_char(json, '{');
+  return ret == SXMLExplorerContinue ? priv_sxml_json_flush_text(json, level) : ret;
+}
+
+// Adjacent children of the same name share an array
+static unsigned char priv_sxml_json_array_key(SXMLJson* json, SXMLJsonLevel* level, const char* name, unsigned int len) {
+  unsigned char ret;
+
+  if (level->array && level->child_len == len && memcmp(json->names + level->child, name, len) == 0) {
+    return priv_sxml_json_char(json, ',');
+  }
+  ret = priv_sxml_json_close_array(json, level);
+  if (ret == SXMLExplorerContinue) {
+    ret = priv_sxml_json_key(json, level, "", 0, name, len);
+  }
+  if (ret != SXMLExplorerContinue) {
+    return ret;
+  }
+  // The level's name is the last one in the pool, its children's above it
+  if (level->child + len > SXMLJsonNamePoolLength) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  memcpy(json->names + level->child, name, len);
+  level->child_len = len;
+  level->array = 1;
+  json->names_used = level->child + len;
+  return priv_sxml_json_char(json, '[');
+}
+
+// =============================================================================
+// EXPLORER EVENTS
+// =============================================================================
+
+static unsigned char priv_sxml_json_start(void* user, char* name, unsigned int len, SXMLAttribute* attrs, unsigned int count) {
+  SXMLJson* json = user;
+  SXMLJsonLevel* parent = &json->levels[json->depth];
+  SXMLJsonLevel* level;
+  unsigned char ret;
+  unsigned int i;
+
+  if (json->depth >= SXMLJsonMaxDepth) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  ret = priv_sxml_json_open(json, parent);
+  if (ret == SXMLExplorerContinue) {
+    ret = (json->options & SXMLJsonArrays) && json->depth > 0 ?
+      priv_sxml_json_array_key(json, parent, name, len) :
+      priv_sxml_json_key(json, parent, "", 0, name, len);
+  }
+  if (ret != SXMLExplorerContinue) {
+    return ret;
+  }
+
+  level = &json->levels[++json->depth];
+  memset(level, 0, sizeof(SXMLJsonLevel));
+  level->child = json->names_used;
+  json->text_len = 0;
+  if (json->options & SXMLJsonSkipAttributes) {
+    return SXMLExplorerContinue;
+  }
+  for (i = 0; i < count && ret == SXMLExplorerContinue; i++) {
+    ret = priv_sxml_json_open(json, level);
+    if (ret == SXMLExplorerContinue) {
+      ret = priv_sxml_json_key(json, level, json->prefix, json->prefix_len, attrs[i].key, attrs[i].key_len);
+    }
+    if (ret == SXMLExplorerContinue) {
+      ret = priv_sxml_json_value(json, attrs[i].value, attrs[i].value_len);
+    }
+  }
+  return ret;
+}
+
+static unsigned char priv_sxml_json_end(void* user, SXMLEventType type, unsigned int id, char* name, unsigned int len) {
+  SXMLJson* json = user;
+  SXMLJsonLevel* level = &json->levels[json->depth];
+  unsigned char ret;
+  (void)id;
+  (void)name;
+  (void)len;
+
+  if (type != SXMLEventEndTag || json->depth == 0) {
+    return SXMLExplorerContinue;
+  }
+  if (level->open) {
+    ret = priv_sxml_json_flush_text(json, level);
+    if (ret == SXMLExplorerContinue) {
+      ret = priv_sxml_json_close_array(json, level);
+    }
+    if (ret == SXMLExplorerContinue) {
+      ret = priv_sxml_json_char(json, '}');
+    }
+  } else if (json->text_len > 0 && !priv_sxml_json_blank(json->text, json->text_len)) {
+    ret = priv_sxml_json_value(json, json->text, json->text_len);
+  } else {
+    ret = priv_sxml_json_write(json, "null", 4);
+  }
+  json->text_len = 0;
+  json->names_used = level->child;
+  json->depth--;
+  return ret;
+}
+
+// Text runs (CDATA included) collect until the element's next child or end.
+// A run that fills the explorer's buffer may have been cut there, so it
+// fails as well as pending text that does not fit.
+static unsigned char priv_sxml_json_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+  SXMLJson* json = user;
+
+  if (type != SXMLEventContent || json->depth == 0) {
+    return SXMLExplorerContinue;
+  }
+  if (len >= SXMLElementLength - 1 || len > SXMLElementLength - 1 - json->text_len) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  memcpy(json->text + json->text_len, text, len);
+  json->text_len += len;
+  return SXMLExplorerContinue;
+}
+
+// =============================================================================
+// CONVERTER
+// =============================================================================
+
+SXMLJson* sxml_make_json(SXMLExplorer* explorer, char* buffer, unsigned int size) {
+  SXMLJson* json;
+
+  if (buffer == NULL || size == 0) {
+    return NULL;
+  }
+  json = calloc(1, sizeof(SXMLJson));
+  if (json == NULL) {
+    return NULL;
+  }
+  json->explorer = explorer;
+  json->buffer = buffer;
+  json->size = size;
+  sxml_json_set_keys(json, "@", "#text");
+  sxml_register_start_element_func(explorer, priv_sxml_json_start, json);
+  sxml_register_name_func(explorer, priv_sxml_json_end, json);
+  sxml_register_event_func(explorer, priv_sxml_json_event, json);
+  sxml_enable_entity_processing(explorer, 1);
+  sxml_enable_whitespace_skip(explorer, 1);
+  sxml_enable_text_coalescing(explorer, 1);
+  return json;
+}
+
+void sxml_destroy_json(SXMLJson* json) {
+  SXMLExplorer* explorer = json->explorer;
+  if (explorer->name_user == json) {
+    sxml_register_name_func(explorer, NULL, NULL);
+  }
+  if (explorer->start_element_user == json) {
+    sxml_register_start_element_func(explorer, NULL, NULL);
+  }
+  if (explorer->event_user == json) {
+    sxml_register_event_func(explorer, NULL, NULL);
+  }
+  free(json);
+}
+
+void sxml_json_set_options(SXMLJson* json, unsigned int options) {
+  json->options = options;
+}
+
+unsigned char sxml_json_set_keys(SXMLJson* json, const char* attribute_prefix, const char* text_key) {
+  unsigned int prefix_len = strlen(attribute_prefix), text_key_len = strlen(text_key);
+
+  if (prefix_len >= SXMLJsonKeyLength || text_key_len >= SXMLJsonKeyLength) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  memcpy(json->prefix, attribute_prefix, prefix_len + 1);
+  json->prefix_len = prefix_len;
+  memcpy(json->text_key, text_key, text_key_len + 1);
+  json->text_key_len = text_key_len;
+  return SXMLExplorerContinue;
+}
+
+void sxml_json_register_sink_func(SXMLJson* json, void* func, void* user) {
+  json->sink_func = func;
+  json->sink_user = user;
+}
+
+unsigned char sxml_json_finish(SXMLJson* json) {
+  unsigned char ret = SXMLExplorerContinue;
+
+  if (json->depth > 0) {
+    return SXMLExplorerErrorMalformedXML;
+  }
+  if (!json->levels[0].open) {
+    json->levels[0].open = 1;
+    ret = priv_sxml_json_char(json, '{');
+  }
+  if (ret == SXMLExplorerContinue) {
+    ret = priv_sxml_json_char(json, '}');
+  }
+  if (ret == SXMLExplorerContinue && json->sink_func != NULL) {
+    ret = priv_sxml_json_drain(json);
+  }
+  return ret;
+}
+
+unsigned int sxml_json_length(SXMLJson* json) {
+  return json->used;
+}
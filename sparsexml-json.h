@@ -0,0 +1,62 @@
+#ifndef __SXMLJson__
+#define __SXMLJson__
+
+#include "sparsexml.h"
+
+/*
+ * Streaming XML to JSON: the explorer's events are written out as JSON as
+ * they arrive, into a caller buffer that is handed to a sink whenever it
+ * fills (or that must hold the whole document when there is no sink).
+ *
+ *   SXMLJson* j = sxml_make_json(ex, out, sizeof(out));
+ *   sxml_json_register_sink_func(j, write_out, stdout);
+ *   sxml_run_explorer(ex, xml);
+ *   sxml_json_finish(j);
+ *
+ * The document becomes an object holding the root element. An element
+ * becomes an object of its attributes ("@name" keys), children (keys named
+ * as written, prefixes included) and text ("#text") when it has attributes
+ * or children, its text as a string when it has only text, and null when
+ * empty. Whitespace-only text is dropped. Repeated children stay repeated
+ * keys unless SXMLJsonArrays is set. Nothing is buffered beyond one
+ * element's pending text and a few bytes per open element, so memory is
+ * the explorer plus SXMLJsonMaxDepth levels. Pending text of
+ * SXMLElementLength - 1 bytes or more (text and CDATA runs of one element
+ * between its children) fails with SXMLExplorerErrorBufferOverflow rather
+ * than being cut.
+ *
+ * The converter owns the explorer's name, start element and event funcs and
+ * turns on entity processing, whitespace skip and text coalescing.
+ */
+
+#define SXMLJsonMaxDepth 256
+#define SXMLJsonNamePoolLength 1024  // Names of the last child per open element
+#define SXMLJsonKeyLength 16
+
+#define SXMLJsonArrays 0x01       // Children always in arrays, adjacent namesakes share one
+#define SXMLJsonTypedValues 0x02  // JSON numbers, true and false written unquoted
+#define SXMLJsonSkipAttributes 0x04
+
+typedef struct __SXMLJson SXMLJson;
+
+SXMLJson* sxml_make_json(SXMLExplorer*, char* buffer, unsigned int size);
+void sxml_destroy_json(SXMLJson*);
+
+void sxml_json_set_options(SXMLJson*, unsigned int options);
+// Attribute key prefix and text key, "@" and "#text" by default; returns
+// SXMLExplorerErrorBufferOverflow for keys of SXMLJsonKeyLength or more
+unsigned char sxml_json_set_keys(SXMLJson*, const char* attribute_prefix, const char* text_key);
+
+// Sink func: unsigned char (*)(void* user, const char* data, unsigned int
+// len), with the buffer's bytes when it is full and on finish; anything
+// but SXMLExplorerContinue stops the explorer. Without a sink a full buffer
+// fails with SXMLExplorerErrorBufferOverflow.
+void sxml_json_register_sink_func(SXMLJson*, void*, void*);
+
+// Closes the document and hands the rest to the sink; returns
+// SXMLExplorerErrorMalformedXML while elements are still open
+unsigned char sxml_json_finish(SXMLJson*);
+// Bytes in the buffer not yet handed to a sink
+unsigned int sxml_json_length(SXMLJson*);
+
+#endif
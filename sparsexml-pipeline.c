@@ -0,0 +1,340 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "sparsexml-priv.h"
+#include "sparsexml-pipeline.h"
+
+#define SXMLPipelineCacheLine 64
+#define SXMLPipelineChunkSlots 4
+#define SXMLPipelineSpinLimit 256
+
+typedef struct {
+  SXMLEventType type;
+  unsigned int len;
+  char text[SXMLElementLength];
+} SXMLPipelineEvent;
+
+typedef struct {
+  unsigned int len;
+  char data[SXMLPipelineChunkLength + 1];
+} SXMLPipelineChunk;
+
+// Head and tail live on separate cache lines so producer and consumer never
+// write to the same line; each side only reads the other's index.
+typedef struct {
+  _Alignas(SXMLPipelineCacheLine) atomic_uint head;  // Next slot to consume
+  _Alignas(SXMLPipelineCacheLine) atomic_uint tail;  // Next slot to produce
+  _Alignas(SXMLPipelineCacheLine) unsigned int mask;
+} SXMLPipelineRing;
+
+struct __SXMLPipeline {
+  SXMLExplorer* explorer;
+  unsigned char backpressure;
+  char* xml;
+
+  SXMLPipelineRing events;
+  SXMLPipelineEvent* event_slots;
+  SXMLPipelineRing chunks;
+  SXMLPipelineChunk* chunk_slots;
+
+  unsigned int (*reader_func)(void *, char *, unsigned int);
+  void* reader_user;
+  unsigned char (*consumer_func)(void *, SXMLEventType, char *, unsigned int);
+  void* consumer_user;
+
+  atomic_uchar reader_done;
+  atomic_uchar parser_done;
+  atomic_uchar stopped;
+  atomic_ulong dropped;
+  unsigned char result;
+
+  pthread_t reader_thread;
+  pthread_t parser_thread;
+  pthread_t consumer_thread;
+  unsigned char running;
+};
+
+// =============================================================================
+// SPSC RING
+// =============================================================================
+
+static void priv_sxml_pipeline_ring_init(SXMLPipelineRing* ring, unsigned int capacity) {
+  atomic_init(&ring->head, 0);
+  atomic_init(&ring->tail, 0);
+  ring->mask = capacity - 1;
+}
+
+// Returns the slot index to fill, or -1 when the ring is full
+static long priv_sxml_pipeline_ring_reserve(SXMLPipelineRing* ring) {
+  unsigned int tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+  unsigned int head = atomic_load_explicit(&ring->head, memory_order_acquire);
+  if (tail - head > ring->mask) {
+    return -1;
+  }
+  return tail & ring->mask;
+}
+
+static void priv_sxml_pipeline_ring_publish(SXMLPipelineRing* ring) {
+  unsigned int tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+  atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+}
+
+// Returns the slot index to read, or -1 when the ring is empty
+static long priv_sxml_pipeline_ring_peek(SXMLPipelineRing* ring) {
+  unsigned int head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+  unsigned int tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+  if (head == tail) {
+    return -1;
+  }
+  return head & ring->mask;
+}
+
+static void priv_sxml_pipeline_ring_release(SXMLPipelineRing* ring) {
+  unsigned int head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+  atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+static void priv_sxml_pipeline_backoff(unsigned int* spins) {
+  if (++(*spins) > SXMLPipelineSpinLimit) {
+    sched_yield();
+  }
+}
+
+// =============================================================================
+// STAGES
+// =============================================================================
+
+static unsigned char priv_sxml_pipeline_publish(void* user, SXMLEventType type, char* text, unsigned int len) {
+  SXMLPipeline* pipeline = user;
+  unsigned int spins = 0;
+  long slot;
+
+  while ((slot = priv_sxml_pipeline_ring_reserve(&pipeline->events)) < 0) {
+    if (atomic_load_explicit(&pipeline->stopped, memory_order_acquire)) {
+      return SXMLExplorerStop;
+    }
+    if (pipeline->backpressure == SXMLPipelineDrop) {
+      atomic_fetch_add_explicit(&pipeline->dropped, 1, memory_order_relaxed);
+      return SXMLExplorerContinue;
+    }
+    priv_sxml_pipeline_backoff(&spins);
+  }
+  if (atomic_load_explicit(&pipeline->stopped, memory_order_acquire)) {
+    return SXMLExplorerStop;
+  }
+
+  pipeline->event_slots[slot].type = type;
+  pipeline->event_slots[slot].len = len;
+  memcpy(pipeline->event_slots[slot].text, text, len + 1);
+  priv_sxml_pipeline_ring_publish(&pipeline->events);
+  return SXMLExplorerContinue;
+}
+
+static void* priv_sxml_pipeline_reader(void* arg) {
+  SXMLPipeline* pipeline = arg;
+  unsigned int spins = 0;
+
+  while (!atomic_load_explicit(&pipeline->stopped, memory_order_acquire)) {
+    long slot = priv_sxml_pipeline_ring_reserve(&pipeline->chunks);
+    SXMLPipelineChunk* chunk;
+    if (slot < 0) {
+      priv_sxml_pipeline_backoff(&spins);
+      continue;
+    }
+    spins = 0;
+    chunk = &pipeline->chunk_slots[slot];
+    chunk->len = pipeline->reader_func(pipeline->reader_user, chunk->data, SXMLPipelineChunkLength);
+    if (chunk->len == 0) {
+      break;
+    }
+    if (chunk->len > SXMLPipelineChunkLength) {
+      chunk->len = SXMLPipelineChunkLength;
+    }
+    chunk->data[chunk->len] = '\0';
+    priv_sxml_pipeline_ring_publish(&pipeline->chunks);
+  }
+  atomic_store_explicit(&pipeline->reader_done, 1, memory_order_release);
+  return NULL;
+}
+
+static void* priv_sxml_pipeline_parser(void* arg) {
+  SXMLPipeline* pipeline = arg;
+  unsigned char result = SXMLExplorerComplete;
+  unsigned int spins = 0;
+
+  if (pipeline->xml != NULL) {
+    result = sxml_run_explorer(pipeline->explorer, pipeline->xml);
+  } else {
+    while (result == SXMLExplorerComplete) {
+      long slot = priv_sxml_pipeline_ring_peek(&pipeline->chunks);
+      if (slot < 0) {
+        if (atomic_load_explicit(&pipeline->reader_done, memory_order_acquire) &&
+            priv_sxml_pipeline_ring_peek(&pipeline->chunks) < 0) {
+          break;
+        }
+        priv_sxml_pipeline_backoff(&spins);
+        continue;
+      }
+      spins = 0;
+      result = sxml_run_explorer(pipeline->explorer, pipeline->chunk_slots[slot].data);
+      priv_sxml_pipeline_ring_release(&pipeline->chunks);
+    }
+    if (result != SXMLExplorerComplete) {
+      // Unblock a reader that is waiting for a free chunk slot
+      atomic_store_explicit(&pipeline->stopped, 1, memory_order_release);
+    }
+  }
+
+  pipeline->result = result;
+  atomic_store_explicit(&pipeline->parser_done, 1, memory_order_release);
+  return NULL;
+}
+
+static void* priv_sxml_pipeline_consumer(void* arg) {
+  SXMLPipeline* pipeline = arg;
+  unsigned int spins = 0;
+
+  for (;;) {
+    long slot = priv_sxml_pipeline_ring_peek(&pipeline->events);
+    SXMLPipelineEvent* event;
+    if (slot < 0) {
+      if (atomic_load_explicit(&pipeline->parser_done, memory_order_acquire) &&
+          priv_sxml_pipeline_ring_peek(&pipeline->events) < 0) {
+        break;
+      }
+      priv_sxml_pipeline_backoff(&spins);
+      continue;
+    }
+    spins = 0;
+    event = &pipeline->event_slots[slot];
+    if (!atomic_load_explicit(&pipeline->stopped, memory_order_relaxed) &&
+        pipeline->consumer_func(pipeline->consumer_user, event->type, event->text, event->len) != SXMLExplorerContinue) {
+      atomic_store_explicit(&pipeline->stopped, 1, memory_order_release);
+    }
+    priv_sxml_pipeline_ring_release(&pipeline->events);
+  }
+  return NULL;
+}
+
+// =============================================================================
+// PIPELINE LIFECYCLE
+// =============================================================================
+
+SXMLPipeline* sxml_make_pipeline(SXMLExplorer* explorer, unsigned int capacity, unsigned char backpressure) {
+  SXMLPipeline* pipeline;
+  unsigned int size = 2;
+
+  while (size < capacity && size < 0x80000000u) {
+    size <<= 1;
+  }
+
+  // The ring members are cache-line aligned, which calloc does not promise
+  if (posix_memalign((void**)&pipeline, SXMLPipelineCacheLine,
+                     (sizeof(SXMLPipeline) + SXMLPipelineCacheLine - 1) & ~(SXMLPipelineCacheLine - 1)) != 0) {
+    return NULL;
+  }
+  memset(pipeline, 0, sizeof(SXMLPipeline));
+  pipeline->event_slots = malloc(size * sizeof(SXMLPipelineEvent));
+  pipeline->chunk_slots = malloc(SXMLPipelineChunkSlots * sizeof(SXMLPipelineChunk));
+  if (pipeline->event_slots == NULL || pipeline->chunk_slots == NULL) {
+    sxml_destroy_pipeline(pipeline);
+    return NULL;
+  }
+
+  pipeline->explorer = explorer;
+  pipeline->backpressure = backpressure;
+  priv_sxml_pipeline_ring_init(&pipeline->events, size);
+  priv_sxml_pipeline_ring_init(&pipeline->chunks, SXMLPipelineChunkSlots);
+  sxml_register_event_func(explorer, priv_sxml_pipeline_publish, pipeline);
+
+  return pipeline;
+}
+
+void sxml_destroy_pipeline(SXMLPipeline* pipeline) {
+  if (pipeline->running) {
+    sxml_pipeline_wait(pipeline);
+  }
+  if (pipeline->explorer != NULL && pipeline->explorer->event_user == pipeline) {
+    sxml_register_event_func(pipeline->explorer, NULL, NULL);
+  }
+  free(pipeline->event_slots);
+  free(pipeline->chunk_slots);
+  free(pipeline);
+}
+
+void sxml_pipeline_register_reader(SXMLPipeline* pipeline, void* reader, void* user) {
+  pipeline->reader_func = reader;
+  pipeline->reader_user = user;
+}
+
+void sxml_pipeline_register_consumer(SXMLPipeline* pipeline, void* consumer, void* user) {
+  pipeline->consumer_func = consumer;
+  pipeline->consumer_user = user;
+}
+
+// A stage could not be started: the ones already running see the pipeline
+// stopped and their input ended, and are joined
+static void priv_sxml_pipeline_abort(SXMLPipeline* pipeline, unsigned char parser_started) {
+  atomic_store(&pipeline->stopped, 1);
+  atomic_store(&pipeline->reader_done, 1);
+  if (parser_started) {
+    pthread_join(pipeline->parser_thread, NULL);
+  } else {
+    atomic_store(&pipeline->parser_done, 1);
+  }
+  pthread_join(pipeline->consumer_thread, NULL);
+}
+
+unsigned char sxml_pipeline_start(SXMLPipeline* pipeline, char* xml) {
+  if (pipeline->running || pipeline->consumer_func == NULL || (xml == NULL && pipeline->reader_func == NULL)) {
+    return SXMLExplorerErrorMalformedXML;
+  }
+
+  pipeline->xml = xml;
+  pipeline->result = SXMLExplorerComplete;
+  atomic_store(&pipeline->reader_done, xml != NULL);
+  atomic_store(&pipeline->parser_done, 0);
+  atomic_store(&pipeline->stopped, 0);
+  atomic_store(&pipeline->dropped, 0);
+  priv_sxml_pipeline_ring_init(&pipeline->events, pipeline->events.mask + 1);
+  priv_sxml_pipeline_ring_init(&pipeline->chunks, SXMLPipelineChunkSlots);
+
+  if (pthread_create(&pipeline->consumer_thread, NULL, priv_sxml_pipeline_consumer, pipeline) != 0) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  if (pthread_create(&pipeline->parser_thread, NULL, priv_sxml_pipeline_parser, pipeline) != 0) {
+    priv_sxml_pipeline_abort(pipeline, 0);
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  if (xml == NULL && pthread_create(&pipeline->reader_thread, NULL, priv_sxml_pipeline_reader, pipeline) != 0) {
+    priv_sxml_pipeline_abort(pipeline, 1);
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  pipeline->running = 1;
+
+  return SXMLExplorerContinue;
+}
+
+unsigned char sxml_pipeline_wait(SXMLPipeline* pipeline) {
+  if (!pipeline->running) {
+    return pipeline->result;
+  }
+  if (pipeline->xml == NULL) {
+    pthread_join(pipeline->reader_thread, NULL);
+  }
+  pthread_join(pipeline->parser_thread, NULL);
+  pthread_join(pipeline->consumer_thread, NULL);
+  pipeline->running = 0;
+
+  if (pipeline->result == SXMLExplorerComplete && atomic_load(&pipeline->stopped)) {
+    return SXMLExplorerInterrupted;
+  }
+  return pipeline->result;
+}
+
+unsigned long sxml_pipeline_dropped(SXMLPipeline* pipeline) {
+  return atomic_load(&pipeline->dropped);
+}
@@ -0,0 +1,42 @@
+#ifndef __SXMLPipeline__
+#define __SXMLPipeline__
+
+#include "sparsexml.h"
+
+/*
+ * Optional threaded pipeline: reader -> parser -> consumer.
+ *
+ * The explorer runs on its own thread and publishes every event (type plus
+ * a copy of the text) into a bounded lock-free single-producer /
+ * single-consumer ring that a consumer thread drains. The reader stage
+ * feeds input chunks to the parser through a second SPSC ring.
+ *
+ * Requires POSIX threads; the core parser does not depend on this module.
+ */
+
+#define SXMLPipelineBlock 0x00  // Full ring: parser waits for the consumer
+#define SXMLPipelineDrop 0x01   // Full ring: event is dropped and counted
+
+#define SXMLPipelineChunkLength 4096
+
+typedef struct __SXMLPipeline SXMLPipeline;
+
+// capacity is rounded up to a power of two
+SXMLPipeline* sxml_make_pipeline(SXMLExplorer*, unsigned int capacity, unsigned char backpressure);
+void sxml_destroy_pipeline(SXMLPipeline*);
+
+// Reader: unsigned int (*)(void* user, char* buf, unsigned int size), returns 0 at end of input
+void sxml_pipeline_register_reader(SXMLPipeline*, void*, void*);
+// Consumer: unsigned char (*)(void* user, SXMLEventType, char* text, unsigned int len)
+void sxml_pipeline_register_consumer(SXMLPipeline*, void*, void*);
+
+// Parses xml, or pulls input from the reader when xml is NULL. Returns
+// SXMLExplorerErrorBufferOverflow when a stage thread cannot be created;
+// stages already started are stopped and joined.
+unsigned char sxml_pipeline_start(SXMLPipeline*, char* xml);
+// Joins all stages and returns the explorer result
+unsigned char sxml_pipeline_wait(SXMLPipeline*);
+
+unsigned long sxml_pipeline_dropped(SXMLPipeline*);
+
+#endif
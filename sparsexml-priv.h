@@ -3,6 +3,150 @@
 
 #include "sparsexml.h"
 
+#define SXMLSnapshotVersion 13
+#define SXMLSnapshotHeaderLength 16
+
+// Declared entities: open-addressed table (power of two) and name/value pool
+#ifndef SXMLEntityTableSlots
+#define SXMLEntityTableSlots 64
+#endif
+#ifndef SXMLEntityPoolLength
+#define SXMLEntityPoolLength 2048
+#endif
+#define SXMLEntityMaxDepth 8       // Nested references inside declared values
+#ifndef SXMLEntityMaxExpansions
+#define SXMLEntityMaxExpansions 4096 // Declared references one top-level reference may expand
+#endif
+
+// Interned strings (names, namespace prefixes and URIs); ids index symbols[].
+// The default sizes keep the whole table within a few KB of L1.
+#ifndef SXMLSymbolCapacity
+#define SXMLSymbolCapacity 128  // Power of two
+#endif
+#define SXMLSymbolSlots (SXMLSymbolCapacity * 2)  // Hash index, power of two
+#ifndef SXMLSymbolPoolLength
+#define SXMLSymbolPoolLength 2048
+#endif
+#define SXMLSymbolUnknown 0xFFFF
+
+// Namespace scope stack
+#ifndef SXMLNamespaceBindings
+#define SXMLNamespaceBindings 32
+#endif
+#ifndef SXMLNamespaceMaxDepth
+#define SXMLNamespaceMaxDepth 64
+#endif
+#define SXMLNamespaceNameLength 128
+
+// Open elements tracked for the name func, element handlers and the path;
+// sxml_set_max_depth() lowers the depth limit at run time
+#ifndef SXMLElementMaxDepth
+#define SXMLElementMaxDepth 256
+#endif
+#ifndef SXMLElementPathLength
+#define SXMLElementPathLength SXMLElementLength
+#endif
+
+// Attributes of one start tag, collected for the start element func
+#ifndef SXMLAttributeMax
+#define SXMLAttributeMax 64
+#endif
+#ifndef SXMLAttributeArenaLength
+#define SXMLAttributeArenaLength (SXMLElementLength * 2)
+#endif
+#ifndef SXMLElementHandlers
+#define SXMLElementHandlers 16
+#endif
+
+typedef struct {
+  unsigned int hash;
+  unsigned short offset;       // Offset into the pool
+  unsigned short len;
+} SXMLSymbol;
+
+// Allocated by the first name interned; id 0 ("") needs no table
+typedef struct {
+  unsigned short slots[SXMLSymbolSlots]; // Symbol id + 1, 0 marks an empty slot
+  SXMLSymbol entries[SXMLSymbolCapacity];
+  char pool[SXMLSymbolPoolLength];
+} SXMLSymbolTable;
+
+typedef struct {
+  unsigned short prefix;       // Symbol id
+  unsigned short uri;          // Symbol id
+} SXMLNamespaceBinding;
+
+// Allocated by the first tag seen with namespace processing on
+typedef struct {
+  SXMLNamespaceBinding bindings[SXMLNamespaceBindings];
+  unsigned short marks[SXMLNamespaceMaxDepth]; // ns_count when each open element started
+  char element[SXMLNamespaceNameLength]; // Start tag waiting for its attributes
+} SXMLNamespaceStack;
+
+typedef struct {
+  unsigned int hash;
+  unsigned short name;         // Offset into the pool
+  unsigned short value;        // Offset into the pool
+  unsigned short value_len;
+  unsigned char name_len;      // 0 marks an empty slot
+} SXMLEntityBinding;
+
+// Allocated by the first binding; explorers without declared entities keep
+// only a NULL pointer
+typedef struct {
+  SXMLEntityBinding slots[SXMLEntityTableSlots];
+  char pool[SXMLEntityPoolLength];
+} SXMLEntityTable;
+
+typedef struct {
+  unsigned char (*func)(void *, SXMLEventType, char *, unsigned int);
+  void* user;
+  unsigned short id;           // Symbol id of the element name
+} SXMLElementHandler;
+
+// Allocated by the first start tag the element layer tracks
+typedef struct {
+  unsigned short ids[SXMLElementMaxDepth]; // Symbol id per open element
+  unsigned short marks[SXMLElementMaxDepth]; // element_path_len before each element
+  char path[SXMLElementPathLength]; // Open element names joined by '/'
+} SXMLElementStack;
+
+// Allocated by the first sxml_on_element
+typedef struct {
+  SXMLElementHandler entries[SXMLElementHandlers];
+  unsigned char of[SXMLSymbolCapacity]; // Handler index + 1 per symbol id
+} SXMLHandlerTable;
+
+typedef struct {
+  unsigned short key;          // Offset into the arena
+  unsigned short key_len;
+  unsigned short value;        // Offset into the arena
+  unsigned short value_len;
+} SXMLAttributeSpan;
+
+// Allocated by the first start tag collected for the start element func
+typedef struct {
+  char arena[SXMLAttributeArenaLength]; // Tag name, then keys and values, NUL-terminated
+  SXMLAttributeSpan spans[SXMLAttributeMax];
+  SXMLAttribute view[SXMLAttributeMax]; // Spans as pointers, built per call
+} SXMLAttributeBatch;
+
+// Decoded bytes handed to the base64 func per call, a stack buffer
+#ifndef SXMLBase64BlockLength
+#define SXMLBase64BlockLength 768
+#endif
+
+// Skip scanner modes
+#define SXMLSkipContent 0
+#define SXMLSkipOpen 1           // After '<'
+#define SXMLSkipTag 2
+#define SXMLSkipQuote 3
+#define SXMLSkipBang 4           // After "<!"
+#define SXMLSkipCommentOpen 5    // After "<!-"
+#define SXMLSkipComment 6
+#define SXMLSkipCData 7
+#define SXMLSkipInstruction 8
+
 struct __SXMLExplorer {
   SXMLExplorerState state;
 
@@ -15,20 +159,103 @@ struct __SXMLExplorer {
   unsigned char enable_namespace_processing; // Flag to enable/disable namespace processing
   unsigned char enable_extended_entities; // Flag to enable/disable extended HTML entities
   unsigned char enable_numeric_entities; // Flag to enable/disable numeric character references
+  unsigned char lazy_entities; // Deliver text raw instead of expanding references
+  unsigned char text_has_entities; // Current text holds undecoded references
+  unsigned char lazy_attributes; // Buffer attribute sections raw for the cursor API
+  unsigned char tag_scan;      // Skip content, comments and CDATA without buffering
+  unsigned char whitespace_skip; // Drop whitespace-only content runs
+  unsigned char text_coalescing; // Text and adjacent CDATA make one content run
+  unsigned int attr_region;    // Buffer offset of the raw attribute section, 0 when none
+  char attr_quote;             // Open quote inside a raw attribute section, or '\0'
+  unsigned char start_tag_open; // A start tag is being read
+  unsigned char skip_pending;  // One of its callbacks returned SXMLExplorerSkip
+  unsigned int skip_depth;     // Elements open inside a skipped subtree, 0 when not skipping
+  unsigned char skip_mode;     // SXMLSkip* markup the skip scanner is inside
+  unsigned char skip_count;    // Consecutive '-' or ']' towards a comment or CDATA end
+  char skip_last;              // Last byte of a skipped tag, or its open quote
+  unsigned char base64_pending; // A start tag callback returned SXMLExplorerBase64
+  unsigned char base64;        // The current element's text is being decoded
+  unsigned char base64_count;  // Sextets held in base64_bits
+  unsigned char base64_pad;    // '=' seen, only whitespace and '=' may follow
+  unsigned int base64_bits;
+  unsigned long consumed;      // Bytes consumed by the last run
+  unsigned long offset;        // Bytes consumed since the explorer was made
+  unsigned int event_budget;   // Events left before suspending, 0 when unlimited
+
+  SXMLEntityTable* entities;   // Registered and DOCTYPE-declared entities, or NULL
+  unsigned int entity_pool_used;
+  unsigned int entity_count;
+  unsigned int entity_expansion_limit; // Max bytes one reference may expand to
+  unsigned int entity_expansions;      // Declared references expanded by the current reference
+  unsigned char doctype_subset;  // Inside the internal subset '[...]'
+  unsigned char doctype_comment; // Inside a comment in the internal subset
+  char doctype_quote;            // Open quote of a DOCTYPE literal, or '\0'
+
+  SXMLSymbolTable* symbols;    // Interned names, or NULL while only "" is known
+  unsigned int symbol_count;   // Ids in use, including id 0
+  unsigned int symbol_pool_used;
+
+  SXMLNamespaceStack* ns;      // Scope stack, or NULL before namespace processing needs it
+  unsigned int ns_count;       // Bindings in scope
+  unsigned int ns_depth;
+  unsigned int ns_element_len;
+  unsigned char ns_pending;
+  unsigned char ns_binding_pending; // The current attribute is xmlns or xmlns:p
+  unsigned short ns_binding_prefix;
+  unsigned char name_interning; // Intern unseen names instead of reporting SXMLNameUnknown
+  SXMLElementStack* elements;  // Open elements, or NULL before the first one
+  unsigned int element_depth;
+  unsigned int element_max_depth;
+  unsigned char element_open;  // A start tag was named and has not ended yet
+  unsigned char element_replay; // A shard's context elements are being opened
+  unsigned char element_path_enabled;
+  unsigned int element_path_len;
+  SXMLAttributeBatch* attrs;   // Attribute batch, or NULL before the first one
+  unsigned int attr_arena_used;
+  unsigned int attr_name_len;
+  unsigned int attr_count;
+  SXMLHandlerTable* handlers;  // Element handlers, or NULL before the first one
+  unsigned int handler_count;
+  unsigned int handler_first[8]; // First bytes of handler names, one bit each
+  unsigned int handler_lengths;  // Bit n for handler names of length n (31: longer)
 
   unsigned char (*tag_func)(char *);
   unsigned char (*content_func)(char *);
   unsigned char (*attribute_value_func)(char *);
   unsigned char (*attribute_key_func)(char *);
   unsigned char (*comment_func)(char *);
+  unsigned char (*event_func)(void *, SXMLEventType, char *, unsigned int);
+  void* event_user;
+  unsigned char (*namespace_func)(void *, unsigned int, char *, unsigned int, unsigned char);
+  void* namespace_user;
+  unsigned char (*name_func)(void *, SXMLEventType, unsigned int, char *, unsigned int);
+  void* name_user;
+  unsigned char (*start_element_func)(void *, char *, unsigned int, SXMLAttribute *, unsigned int);
+  void* start_element_user;
+  unsigned char (*base64_func)(void *, const unsigned char *, unsigned int);
+  void* base64_user;
 };
 
+unsigned char priv_sxml_callback_result(SXMLExplorer* explorer, unsigned char ret);
+unsigned char priv_sxml_dispatch_event(SXMLExplorer* explorer, SXMLEventType type, char* text);
 unsigned char priv_sxml_change_explorer_state(SXMLExplorer* explorer, SXMLExplorerState state);
 unsigned char priv_sxml_process_entity(SXMLExplorer* explorer, char* entity_buffer);
-unsigned char priv_sxml_process_numeric_entity(SXMLExplorer* explorer, char* entity_buffer);
-unsigned char priv_sxml_process_extended_entity(SXMLExplorer* explorer, char* entity_buffer);
-void priv_sxml_process_namespace(char* tag_name, char** namespace_uri, char** local_name);
+unsigned char priv_sxml_expand_reference(SXMLExplorer* explorer, const char* name, unsigned int len, unsigned int depth, unsigned int base);
+unsigned char priv_sxml_bind_entity(SXMLExplorer* explorer, const char* name, unsigned int name_len, const char* value, unsigned int value_len);
+unsigned char priv_sxml_process_markup_declaration(SXMLExplorer* explorer);
+unsigned int priv_sxml_decode_numeric_reference(const char* ref, unsigned int len);
+unsigned int priv_sxml_encode_utf8(unsigned int codepoint, char* out);
+unsigned int priv_sxml_find_symbol(SXMLExplorer* explorer, const char* str, unsigned int len);
+unsigned int priv_sxml_intern(SXMLExplorer* explorer, const char* str, unsigned int len);
+SXMLNamespaceStack* priv_sxml_namespace_stack(SXMLExplorer* explorer);
+unsigned char priv_sxml_namespace_transition(SXMLExplorer* explorer, SXMLExplorerState state);
+SXMLElementStack* priv_sxml_element_stack(SXMLExplorer* explorer);
+unsigned char priv_sxml_element_transition(SXMLExplorer* explorer, SXMLExplorerState state);
+unsigned char priv_sxml_element_enter(SXMLExplorer* explorer, const char* name, unsigned int len);
+SXMLAttributeBatch* priv_sxml_attr_batch(SXMLExplorer* explorer);
+unsigned char priv_sxml_next_attribute(const char* region, unsigned int len, unsigned int* cursor, SXMLAttribute* out);
 unsigned char priv_append_char(SXMLExplorer* explorer, char c);
 unsigned char priv_append_string(SXMLExplorer* explorer, const char* str);
+unsigned char priv_append_bytes(SXMLExplorer* explorer, const char* str, unsigned int len);
 
 #endif
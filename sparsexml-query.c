@@ -0,0 +1,473 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "sparsexml-priv.h"
+#include "sparsexml-query.h"
+
+#define SXMLQueryWords (SXMLQueryStates / 32)
+#define SXMLQueryEdges (SXMLQueryStates * 2)
+#define SXMLQueryAnyName 0xFFFE
+
+#define SXMLQueryChild 0
+#define SXMLQueryDescendant 1
+
+#define SXMLQueryElement 0
+#define SXMLQueryText 1
+#define SXMLQueryAttribute 2
+
+// One automaton state per distinct step; queries with a common prefix end
+// up on the same path from the root (state 0, the document)
+typedef struct {
+  unsigned short name;        // Symbol id or SXMLQueryAnyName
+  unsigned short parent;
+  unsigned char axis;
+  unsigned short pred_key;    // Pool offsets, 0 without a predicate
+  unsigned short pred_value;  // 0 when the predicate only tests presence
+  unsigned short next;        // Next state on the same edge, 0 for none
+  unsigned short queries;     // First query ending here + 1, 0 for none
+} SXMLQueryState;
+
+typedef struct {
+  unsigned short state;
+  unsigned char kind;
+  unsigned short attr;        // Pool offset of the attribute name
+  unsigned short next;        // Next query on the same state + 1
+} SXMLQuery;
+
+struct __SXMLQuerySet {
+  SXMLExplorer* explorer;
+
+  SXMLQueryState states[SXMLQueryStates];
+  unsigned int state_count;
+  SXMLQuery queries[SXMLQueryMax];
+  unsigned int query_count;
+  char pool[SXMLQueryPoolLength];
+  unsigned int pool_used;
+
+  // Edges hashed by (parent, axis, name); the slot holds the first state
+  unsigned int edge_keys[SXMLQueryEdges];
+  unsigned short edge_states[SXMLQueryEdges];
+
+  // Per-state properties as bitsets, so a frame is filtered a word at a time
+  unsigned int child_parents[SXMLQueryWords];
+  unsigned int desc_parents[SXMLQueryWords];
+  unsigned int any_parents[SXMLQueryWords];
+  unsigned int start_states[SXMLQueryWords];  // Element and attribute queries
+  unsigned int text_states[SXMLQueryWords];
+
+  // Frame d is the element at depth d (0 the document): the states it
+  // matched, and those of it or its ancestors with descendant steps
+  unsigned int match[SXMLElementMaxDepth + 1][SXMLQueryWords];
+  unsigned int reach[SXMLElementMaxDepth + 1][SXMLQueryWords];
+  unsigned int pending;       // Symbol id of the start tag being read
+
+  unsigned char (*match_func)(void *, unsigned int, char *, unsigned int);
+  void* match_user;
+  unsigned char (*end_func)(void *, unsigned int);
+  void* end_user;
+};
+
+// =============================================================================
+// QUERY COMPILATION
+// =============================================================================
+
+static unsigned int priv_sxml_query_edge_key(unsigned int parent, unsigned char axis, unsigned int name) {
+  return (((parent << 1) | axis) << 16 | name) + 1;
+}
+
+static unsigned int priv_sxml_query_edge_slot(SXMLQuerySet* set, unsigned int key) {
+  unsigned int slot = (key * 2654435761u) & (SXMLQueryEdges - 1);
+  while (set->edge_keys[slot] != 0 && set->edge_keys[slot] != key) {
+    slot = (slot + 1) & (SXMLQueryEdges - 1);
+  }
+  return slot;
+}
+
+static unsigned short priv_sxml_query_pool_add(SXMLQuerySet* set, const char* text, unsigned int len) {
+  unsigned short offset = set->pool_used;
+  if (set->pool_used + len + 1 > SXMLQueryPoolLength) {
+    return 0;
+  }
+  memcpy(set->pool + set->pool_used, text, len);
+  set->pool[set->pool_used + len] = '\0';
+  set->pool_used += len + 1;
+  return offset;
+}
+
+static unsigned char priv_sxml_query_same(SXMLQuerySet* set, unsigned short a, unsigned short b) {
+  return a == b || (a != 0 && b != 0 && strcmp(set->pool + a, set->pool + b) == 0);
+}
+
+// Returns the state for the step below parent, shared when one with the
+// same predicate exists, or 0 when the automaton is full
+static unsigned int priv_sxml_query_state(SXMLQuerySet* set, unsigned int parent, unsigned char axis,
+                                          unsigned int name, unsigned short key, unsigned short value) {
+  unsigned int edge = priv_sxml_query_edge_key(parent, axis, name);
+  unsigned int slot = priv_sxml_query_edge_slot(set, edge);
+  unsigned int last = 0, id;
+  SXMLQueryState* state;
+
+  if (set->edge_keys[slot] != 0) {
+    for (id = set->edge_states[slot]; id != 0; id = set->states[id].next) {
+      state = &set->states[id];
+      if (priv_sxml_query_same(set, state->pred_key, key) && priv_sxml_query_same(set, state->pred_value, value)) {
+        return id;
+      }
+      last = id;
+    }
+  }
+  if (set->state_count >= SXMLQueryStates) {
+    return 0;
+  }
+
+  id = set->state_count++;
+  state = &set->states[id];
+  memset(state, 0, sizeof(*state));
+  state->name = name;
+  state->parent = parent;
+  state->axis = axis;
+  state->pred_key = key;
+  state->pred_value = value;
+  if (last != 0) {
+    set->states[last].next = id;
+  } else {
+    set->edge_keys[slot] = edge;
+    set->edge_states[slot] = id;
+  }
+
+  if (axis == SXMLQueryDescendant) {
+    set->desc_parents[parent >> 5] |= 1u << (parent & 31);
+  } else {
+    set->child_parents[parent >> 5] |= 1u << (parent & 31);
+  }
+  if (name == SXMLQueryAnyName) {
+    set->any_parents[parent >> 5] |= 1u << (parent & 31);
+  }
+  // The document is an ancestor of everything
+  set->reach[0][0] = set->desc_parents[0] & 1u;
+  return id;
+}
+
+static unsigned int priv_sxml_query_name_len(const char* p) {
+  return strcspn(p, "/[]@=()'\"");
+}
+
+unsigned int sxml_add_query(SXMLQuerySet* set, const char* xpath) {
+  const char* p = xpath;
+  unsigned int state = 0;
+  unsigned char kind = SXMLQueryElement;
+  unsigned short attr = 0;
+  SXMLQuery* query;
+
+  if (set->query_count >= SXMLQueryMax || *p != '/') {
+    return SXMLQueryInvalid;
+  }
+
+  while (*p == '/') {
+    unsigned char axis = SXMLQueryChild;
+    unsigned short key = 0, value = 0;
+    unsigned int name, len;
+
+    if (*++p == '/') {
+      axis = SXMLQueryDescendant;
+      p++;
+    }
+
+    if (*p == '@' || strncmp(p, "text()", 6) == 0) {
+      // "//@id" reads as "//*/@id"; the document itself has neither
+      if (axis == SXMLQueryDescendant) {
+        state = priv_sxml_query_state(set, state, axis, SXMLQueryAnyName, 0, 0);
+      }
+      if (state == 0) {
+        return SXMLQueryInvalid;
+      }
+      if (*p == '@') {
+        len = priv_sxml_query_name_len(++p);
+        if (len == 0 || (attr = priv_sxml_query_pool_add(set, p, len)) == 0) {
+          return SXMLQueryInvalid;
+        }
+        kind = SXMLQueryAttribute;
+        p += len;
+      } else {
+        kind = SXMLQueryText;
+        p += 6;
+      }
+      break;
+    }
+
+    len = priv_sxml_query_name_len(p);
+    if (len == 0) {
+      return SXMLQueryInvalid;
+    }
+    if (len == 1 && *p == '*') {
+      name = SXMLQueryAnyName;
+    } else {
+      char step[SXMLElementLength];
+      if (len >= sizeof(step)) {
+        return SXMLQueryInvalid;
+      }
+      memcpy(step, p, len);
+      step[len] = '\0';
+      name = sxml_register_name(set->explorer, step);
+      if (name == SXMLNameUnknown) {
+        return SXMLQueryInvalid;
+      }
+    }
+    p += len;
+
+    if (*p == '[') {
+      if (*++p != '@' || (len = priv_sxml_query_name_len(++p)) == 0 ||
+          (key = priv_sxml_query_pool_add(set, p, len)) == 0) {
+        return SXMLQueryInvalid;
+      }
+      p += len;
+      if (*p == '=') {
+        char quote = *++p;
+        const char* end = quote == '\'' || quote == '"' ? strchr(p + 1, quote) : NULL;
+        if (end == NULL || (value = priv_sxml_query_pool_add(set, p + 1, end - p - 1)) == 0) {
+          return SXMLQueryInvalid;
+        }
+        p = end + 1;
+      }
+      if (*p++ != ']') {
+        return SXMLQueryInvalid;
+      }
+    }
+
+    state = priv_sxml_query_state(set, state, axis, name, key, value);
+    if (state == 0) {
+      return SXMLQueryInvalid;
+    }
+  }
+  if (*p != '\0' || state == 0) {
+    return SXMLQueryInvalid;
+  }
+
+  query = &set->queries[set->query_count];
+  query->state = state;
+  query->kind = kind;
+  query->attr = attr;
+  query->next = 0;
+  if (set->states[state].queries == 0) {
+    set->states[state].queries = set->query_count + 1;
+  } else {
+    unsigned int q = set->states[state].queries - 1;
+    while (set->queries[q].next != 0) {
+      q = set->queries[q].next - 1;
+    }
+    set->queries[q].next = set->query_count + 1;
+  }
+  if (kind == SXMLQueryText) {
+    set->text_states[state >> 5] |= 1u << (state & 31);
+  } else {
+    set->start_states[state >> 5] |= 1u << (state & 31);
+  }
+  return set->query_count++;
+}
+
+// =============================================================================
+// QUERY EVALUATION
+// =============================================================================
+
+static const SXMLAttribute* priv_sxml_query_attribute(const char* name, SXMLAttribute* attrs, unsigned int count) {
+  unsigned int i;
+  for (i = 0; i < count; i++) {
+    if (strcmp(attrs[i].key, name) == 0) {
+      return &attrs[i];
+    }
+  }
+  return NULL;
+}
+
+// Adds the states on edge (parent, axis, name) whose predicate holds
+static void priv_sxml_query_follow(SXMLQuerySet* set, unsigned int* match, unsigned int parent, unsigned char axis,
+                                   unsigned int name, SXMLAttribute* attrs, unsigned int count) {
+  unsigned int key = priv_sxml_query_edge_key(parent, axis, name);
+  unsigned int slot = priv_sxml_query_edge_slot(set, key);
+  unsigned int id;
+
+  if (set->edge_keys[slot] == 0) {
+    return;
+  }
+  for (id = set->edge_states[slot]; id != 0; id = set->states[id].next) {
+    const SXMLQueryState* state = &set->states[id];
+    if (state->pred_key != 0) {
+      const SXMLAttribute* attr = priv_sxml_query_attribute(set->pool + state->pred_key, attrs, count);
+      if (attr == NULL || (state->pred_value != 0 && strcmp(attr->value, set->pool + state->pred_value) != 0)) {
+        continue;
+      }
+    }
+    match[id >> 5] |= 1u << (id & 31);
+  }
+}
+
+static void priv_sxml_query_step(SXMLQuerySet* set, unsigned int* match, const unsigned int* from,
+                                 const unsigned int* parents, unsigned char axis, SXMLAttribute* attrs, unsigned int count) {
+  unsigned int w;
+
+  for (w = 0; w < SXMLQueryWords; w++) {
+    unsigned int bits = from[w] & parents[w];
+    while (bits != 0) {
+      unsigned int parent = w * 32 + __builtin_ctz(bits);
+      bits &= bits - 1;
+      if (set->pending != SXMLNameUnknown) {
+        priv_sxml_query_follow(set, match, parent, axis, set->pending, attrs, count);
+      }
+      if (set->any_parents[w] & (1u << (parent & 31))) {
+        priv_sxml_query_follow(set, match, parent, axis, SXMLQueryAnyName, attrs, count);
+      }
+    }
+  }
+}
+
+// The element stack is already popped when its end tag is reported
+static unsigned char priv_sxml_query_end(SXMLQuerySet* set) {
+  const unsigned int* match = set->match[sxml_element_depth(set->explorer) + 1];
+  unsigned int w;
+
+  for (w = 0; w < SXMLQueryWords; w++) {
+    unsigned int bits = match[w] & set->start_states[w];
+    while (bits != 0) {
+      unsigned int q = set->states[w * 32 + __builtin_ctz(bits)].queries;
+      bits &= bits - 1;
+      for (; q != 0; q = set->queries[q - 1].next) {
+        if (set->queries[q - 1].kind == SXMLQueryElement) {
+          unsigned char ret = set->end_func(set->end_user, q - 1);
+          if (ret != SXMLExplorerContinue) {
+            return ret;
+          }
+        }
+      }
+    }
+  }
+  return SXMLExplorerContinue;
+}
+
+static unsigned char priv_sxml_query_name(void* user, SXMLEventType type, unsigned int id, char* name, unsigned int len) {
+  SXMLQuerySet* set = user;
+  (void)name;
+  (void)len;
+  if (type == SXMLEventTag) {
+    set->pending = id;
+  } else if (type == SXMLEventEndTag && set->end_func != NULL) {
+    return priv_sxml_query_end(set);
+  }
+  return SXMLExplorerContinue;
+}
+
+static unsigned char priv_sxml_query_start(void* user, char* name, unsigned int len, SXMLAttribute* attrs, unsigned int count) {
+  SXMLQuerySet* set = user;
+  unsigned int depth = sxml_element_depth(set->explorer);
+  unsigned int* match = set->match[depth];
+  unsigned int starts = 0;
+  unsigned int w;
+
+  memset(match, 0, sizeof(set->match[0]));
+  priv_sxml_query_step(set, match, set->match[depth - 1], set->child_parents, SXMLQueryChild, attrs, count);
+  priv_sxml_query_step(set, match, set->reach[depth - 1], set->desc_parents, SXMLQueryDescendant, attrs, count);
+  for (w = 0; w < SXMLQueryWords; w++) {
+    set->reach[depth][w] = set->reach[depth - 1][w] | (match[w] & set->desc_parents[w]);
+    starts |= match[w] & set->start_states[w];
+  }
+  // A shard's context elements were reported where their start tags are
+  if (starts == 0 || set->match_func == NULL || set->explorer->element_replay) {
+    return SXMLExplorerContinue;
+  }
+
+  for (w = 0; w < SXMLQueryWords; w++) {
+    unsigned int bits = match[w] & set->start_states[w];
+    while (bits != 0) {
+      unsigned int q = set->states[w * 32 + __builtin_ctz(bits)].queries;
+      bits &= bits - 1;
+      for (; q != 0; q = set->queries[q - 1].next) {
+        const SXMLQuery* query = &set->queries[q - 1];
+        unsigned char ret = SXMLExplorerContinue;
+        if (query->kind == SXMLQueryElement) {
+          ret = set->match_func(set->match_user, q - 1, name, len);
+        } else if (query->kind == SXMLQueryAttribute) {
+          const SXMLAttribute* attr = priv_sxml_query_attribute(set->pool + query->attr, attrs, count);
+          if (attr != NULL) {
+            ret = set->match_func(set->match_user, q - 1, (char*)attr->value, attr->value_len);
+          }
+        }
+        if (ret != SXMLExplorerContinue) {
+          return ret;
+        }
+      }
+    }
+  }
+  return SXMLExplorerContinue;
+}
+
+static unsigned char priv_sxml_query_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+  SXMLQuerySet* set = user;
+  const unsigned int* match;
+  unsigned int w;
+
+  if (type != SXMLEventContent || set->match_func == NULL) {
+    return SXMLExplorerContinue;
+  }
+  match = set->match[sxml_element_depth(set->explorer)];
+  for (w = 0; w < SXMLQueryWords; w++) {
+    unsigned int bits = match[w] & set->text_states[w];
+    while (bits != 0) {
+      unsigned int q = set->states[w * 32 + __builtin_ctz(bits)].queries;
+      bits &= bits - 1;
+      for (; q != 0; q = set->queries[q - 1].next) {
+        if (set->queries[q - 1].kind == SXMLQueryText) {
+          unsigned char ret = set->match_func(set->match_user, q - 1, text, len);
+          if (ret != SXMLExplorerContinue) {
+            return ret;
+          }
+        }
+      }
+    }
+  }
+  return SXMLExplorerContinue;
+}
+
+// =============================================================================
+// QUERY SET LIFECYCLE
+// =============================================================================
+
+SXMLQuerySet* sxml_make_query_set(SXMLExplorer* explorer) {
+  SXMLQuerySet* set = calloc(1, sizeof(SXMLQuerySet));
+  if (set == NULL) {
+    return NULL;
+  }
+
+  set->explorer = explorer;
+  set->state_count = 1;
+  set->pool_used = 1;
+  set->match[0][0] = 1u;
+  set->pending = SXMLNameUnknown;
+  sxml_register_name_func(explorer, priv_sxml_query_name, set);
+  sxml_register_start_element_func(explorer, priv_sxml_query_start, set);
+  sxml_register_event_func(explorer, priv_sxml_query_event, set);
+
+  return set;
+}
+
+void sxml_destroy_query_set(SXMLQuerySet* set) {
+  SXMLExplorer* explorer = set->explorer;
+  if (explorer->name_user == set) {
+    sxml_register_name_func(explorer, NULL, NULL);
+  }
+  if (explorer->start_element_user == set) {
+    sxml_register_start_element_func(explorer, NULL, NULL);
+  }
+  if (explorer->event_user == set) {
+    sxml_register_event_func(explorer, NULL, NULL);
+  }
+  free(set);
+}
+
+void sxml_query_register_match_func(SXMLQuerySet* set, void* func, void* user) {
+  set->match_func = func;
+  set->match_user = user;
+}
+
+void sxml_query_register_end_func(SXMLQuerySet* set, void* func, void* user) {
+  set->end_func = func;
+  set->end_user = user;
+}
@@ -0,0 +1,45 @@
+#ifndef __SXMLQuery__
+#define __SXMLQuery__
+
+#include "sparsexml.h"
+
+/*
+ * Streaming queries: a set of absolute XPath-subset expressions compiled
+ * into one shared automaton and evaluated during a single explorer pass.
+ *
+ *   /a/b/c              child steps from the document
+ *   //item/title        descendant steps, '*' matches any name
+ *   /a/b[@k='v']        one attribute predicate per step ([@k] tests presence)
+ *   /a/b/@attr          the attribute's value
+ *   //item/text()       the element's own text, once per text node
+ *
+ * Queries sharing a prefix share automaton states, and every element only
+ * follows the transitions of the states active in its parent, so the cost
+ * per element tracks the active states rather than the number of queries.
+ * Plain element queries report the element name.
+ *
+ * The set owns the explorer's name, start element and event funcs.
+ */
+
+#define SXMLQueryMax 64
+#define SXMLQueryStates 256
+#define SXMLQueryPoolLength 2048
+#define SXMLQueryInvalid 0xFFFF
+
+typedef struct __SXMLQuerySet SXMLQuerySet;
+
+SXMLQuerySet* sxml_make_query_set(SXMLExplorer*);
+void sxml_destroy_query_set(SXMLQuerySet*);
+
+// Returns the query id (dense from 0) or SXMLQueryInvalid when the
+// expression is not supported or the set is full
+unsigned int sxml_add_query(SXMLQuerySet*, const char* xpath);
+
+// Match func: unsigned char (*)(void* user, unsigned int query, char* value,
+// unsigned int len). The value points into parser memory, valid for the call.
+void sxml_query_register_match_func(SXMLQuerySet*, void*, void*);
+// End func: unsigned char (*)(void* user, unsigned int query), when an element
+// matched by a plain element query ends (empty elements included)
+void sxml_query_register_end_func(SXMLQuerySet*, void*, void*);
+
+#endif
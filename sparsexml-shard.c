@@ -0,0 +1,318 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sparsexml-priv.h"
+#include "sparsexml-shard.h"
+
+// =============================================================================
+// STRUCTURAL SCAN
+// =============================================================================
+
+// Mirrors the explorer's tokenization (same states, same delimiters, same
+// lookahead) without buffering or callbacks, keeping only the open-element
+// names needed for shard context.
+typedef struct {
+  char context[SXMLShardContextLength];
+  unsigned int context_len;
+  unsigned int depth;
+  unsigned int overflow;     // Elements open beyond what context can hold
+
+  char name[SXMLElementLength];
+  unsigned int name_len;
+  unsigned char name_done;   // Name ended by ' ', attributes follow
+  char last;                 // Last non-space byte of the current tag
+} SXMLShardScan;
+
+static void priv_sxml_shard_push(SXMLShardScan* scan) {
+  const char* name = scan->name;
+  unsigned int len = scan->name_len;
+
+  // The very first tag carries the '<' the explorer keeps from INITIAL
+  if (len > 0 && name[0] == '<') {
+    name++;
+    len--;
+  }
+  scan->depth++;
+  if (scan->overflow > 0 || scan->context_len + len + 2 > sizeof(scan->context)) {
+    scan->overflow++;
+    return;
+  }
+  if (scan->context_len > 0) {
+    scan->context[scan->context_len++] = ' ';
+  }
+  memcpy(scan->context + scan->context_len, name, len);
+  scan->context_len += len;
+  scan->context[scan->context_len] = '\0';
+}
+
+static void priv_sxml_shard_pop(SXMLShardScan* scan) {
+  if (scan->depth == 0) {
+    return;
+  }
+  scan->depth--;
+  if (scan->overflow > 0) {
+    scan->overflow--;
+    return;
+  }
+  while (scan->context_len > 0 && scan->context[scan->context_len - 1] != ' ') {
+    scan->context_len--;
+  }
+  if (scan->context_len > 0) {
+    scan->context_len--;
+  }
+  scan->context[scan->context_len] = '\0';
+}
+
+static void priv_sxml_shard_end_tag(SXMLShardScan* scan) {
+  if (scan->name_len > 0 && scan->name[0] == '/') {
+    priv_sxml_shard_pop(scan);
+  } else if (scan->name_len > 0 && scan->last != '/') {
+    priv_sxml_shard_push(scan);
+  }
+  scan->name_len = 0;
+  scan->name_done = 0;
+  scan->last = '\0';
+}
+
+unsigned int sxml_plan_shards(const char* xml, unsigned long len, unsigned long target,
+                              SXMLShard* shards, unsigned int max_shards) {
+  SXMLShardScan scan;
+  SXMLExplorerState state = INITIAL;
+  unsigned long next_cut = target;
+  unsigned long i;
+  unsigned int count = 0;
+  char prev = '\0';          // Previous buffered byte, for '?>' and '<?'
+  unsigned char subset = 0;  // DOCTYPE internal subset, as in the explorer
+  unsigned char comment = 0;
+  char quote = '\0';
+
+  if (max_shards == 0) {
+    return 0;
+  }
+  memset(&scan, 0, sizeof(scan));
+  shards[0].begin = 0;
+  shards[0].depth = 0;
+  shards[0].context[0] = '\0';
+
+  for (i = 0; i < len; i++) {
+    char c = xml[i];
+    switch (state) {
+      case INITIAL:
+        if (i + 8 < len && c == '<' && xml[i + 1] == '!' && strncmp(xml + i + 2, "DOCTYPE", 7) == 0) {
+          state = IN_DOCTYPE;
+          i += 8;
+          continue;
+        }
+        state = IN_TAG;
+        scan.name[scan.name_len++] = c;
+        prev = c;
+        continue;
+      case IN_DECLARATION:
+        if (c == '>' && prev == '?') {
+          state = IN_CONTENT;
+          prev = '\0';
+          continue;
+        }
+        prev = c;
+        continue;
+      case IN_TAG:
+        if (c == '>') {
+          priv_sxml_shard_end_tag(&scan);
+          state = IN_CONTENT;
+          break;
+        }
+        if (c == ' ') {
+          scan.name_done = 1;
+          state = IN_ATTRIBUTE_KEY;
+          continue;
+        }
+        if (c == '?' && prev == '<') {
+          scan.name_len = 0;
+          state = IN_DECLARATION;
+          prev = '\0';
+          continue;
+        }
+        if (!scan.name_done && scan.name_len < sizeof(scan.name) - 1) {
+          scan.name[scan.name_len++] = c;
+        }
+        scan.last = c;
+        prev = c;
+        continue;
+      case IN_ATTRIBUTE_KEY:
+        if (c == '>') {
+          priv_sxml_shard_end_tag(&scan);
+          state = IN_CONTENT;
+          break;
+        }
+        if (c == '"') {
+          state = IN_ATTRIBUTE_VALUE;
+        } else if (c != ' ') {
+          scan.last = c;
+        }
+        continue;
+      case IN_ATTRIBUTE_VALUE:
+        if (c == '"') {
+          scan.last = c;
+          state = IN_TAG;
+          prev = '\0';
+        }
+        continue;
+      case IN_CONTENT:
+        if (c == '<') {
+          if (i + 3 < len && xml[i + 1] == '!' && xml[i + 2] == '-' && xml[i + 3] == '-') {
+            state = IN_COMMENT;
+            i += 3;
+          } else if (i + 8 < len && xml[i + 1] == '!' && strncmp(xml + i + 2, "[CDATA[", 7) == 0) {
+            state = IN_CDATA;
+            i += 8;
+          } else if (i + 8 < len && xml[i + 1] == '!' && strncmp(xml + i + 2, "DOCTYPE", 7) == 0) {
+            state = IN_DOCTYPE;
+            i += 8;
+          } else {
+            state = IN_TAG;
+            prev = '\0';
+          }
+        }
+        continue;
+      case IN_COMMENT:
+        if (c == '-' && i + 2 < len && xml[i + 1] == '-' && xml[i + 2] == '>') {
+          state = IN_CONTENT;
+          i += 2;
+        }
+        continue;
+      case IN_CDATA:
+        if (c == ']' && i + 2 < len && xml[i + 1] == ']' && xml[i + 2] == '>') {
+          state = IN_CONTENT;
+          i += 2;
+        }
+        continue;
+      case IN_DOCTYPE:
+        if (quote != '\0') {
+          if (c == quote) {
+            quote = '\0';
+          }
+        } else if (comment) {
+          if (c == '>' && xml[i - 1] == '-' && xml[i - 2] == '-') {
+            comment = 0;
+          }
+        } else if (c == '"' || c == '\'') {
+          quote = c;
+        } else if (c == '-' && subset && i >= 3 && strncmp(xml + i - 3, "<!-", 3) == 0) {
+          comment = 1;
+        } else if (c == '[' || c == ']') {
+          subset = c == '[';
+        } else if (c == '>' && !subset) {
+          state = IN_CONTENT;
+        }
+        continue;
+      case IN_ENTITY:
+        continue;
+    }
+
+    // A tag just closed: the explorer is IN_CONTENT with an empty buffer
+    if (i + 1 >= next_cut && i + 1 < len && scan.overflow == 0 && count + 1 < max_shards) {
+      shards[count].end = i + 1;
+      count++;
+      shards[count].begin = i + 1;
+      shards[count].depth = scan.depth;
+      memcpy(shards[count].context, scan.context, scan.context_len + 1);
+      next_cut = i + 1 + target;
+    }
+  }
+
+  shards[count].end = len;
+  return count + 1;
+}
+
+// =============================================================================
+// SHARD EXECUTION
+// =============================================================================
+
+// The elements open at the cut are opened again, outermost first, so that
+// depth, path and the element layers above them match the whole document
+static unsigned char priv_sxml_shard_enter_context(SXMLExplorer* explorer, const SXMLShard* shard) {
+  const char* name = shard->context;
+
+  explorer->element_depth = 0;
+  explorer->element_path_len = 0;
+  if (explorer->elements != NULL) {
+    explorer->elements->path[0] = '\0';
+  }
+  explorer->element_open = 0;
+  while (*name != '\0') {
+    unsigned int len = strcspn(name, " ");
+    unsigned char ret = priv_sxml_element_enter(explorer, name, len);
+    if (ret == SXMLExplorerStop) {
+      return SXMLExplorerInterrupted;
+    }
+    if (ret != SXMLExplorerContinue && ret != SXMLExplorerSuspend) {
+      return ret;
+    }
+    name += len;
+    if (*name == ' ') {
+      name++;
+    }
+  }
+  return SXMLExplorerContinue;
+}
+
+unsigned char sxml_run_explorer_shard(SXMLExplorer* explorer, char* xml, const SXMLShard* shard) {
+  unsigned char result;
+  unsigned long len = shard->end - shard->begin;
+
+  if (shard->begin > 0) {
+    explorer->state = IN_CONTENT;
+    explorer->bp = 0;
+    explorer->buffer[0] = '\0';
+    result = priv_sxml_shard_enter_context(explorer, shard);
+    if (result != SXMLExplorerContinue) {
+      return result;
+    }
+  }
+  explorer->offset = shard->begin;
+  if (len == 0) {
+    return SXMLExplorerComplete;
+  }
+
+  result = sxml_run_explorer_budget(explorer, xml + shard->begin, len, 0);
+  if (result == SXMLExplorerSuspended && explorer->consumed == len) {
+    result = SXMLExplorerComplete;
+  }
+  return result;
+}
+
+// =============================================================================
+// PLAN SERIALIZATION
+// =============================================================================
+
+unsigned int sxml_format_shard(const SXMLShard* shard, char* out, unsigned int size) {
+  int n;
+  if (shard->context[0] != '\0') {
+    n = snprintf(out, size, "%lu %lu %u %s\n", shard->begin, shard->end, shard->depth, shard->context);
+  } else {
+    n = snprintf(out, size, "%lu %lu %u\n", shard->begin, shard->end, shard->depth);
+  }
+  return n < 0 ? 0 : (unsigned int)n;
+}
+
+unsigned char sxml_parse_shard(SXMLShard* shard, const char* line) {
+  int used = 0;
+  unsigned int len;
+
+  if (sscanf(line, "%lu %lu %u%n", &shard->begin, &shard->end, &shard->depth, &used) != 3 ||
+      shard->end < shard->begin) {
+    return SXMLExplorerErrorMalformedXML;
+  }
+  line += used;
+  if (*line == ' ') {
+    line++;
+  }
+  len = strcspn(line, "\r\n");
+  if (len >= sizeof(shard->context)) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  memcpy(shard->context, line, len);
+  shard->context[len] = '\0';
+  return SXMLExplorerContinue;
+}
@@ -0,0 +1,45 @@
+#ifndef __SXMLShard__
+#define __SXMLShard__
+
+#include "sparsexml.h"
+
+/*
+ * Shard planning: split one document into byte ranges that independent
+ * explorers (threads, processes or hosts) can parse without coordination.
+ *
+ * Every cut sits just past a '>' where the explorer is provably IN_CONTENT
+ * with an empty buffer. Each shard carries the elements open at its start,
+ * outermost first and separated by single spaces. Running a shard opens
+ * them first: the name, start element and element handler funcs see a start
+ * for each (without attributes) and element depth and path are as in the
+ * whole document, so queries, bindings and aggregations work per shard.
+ * Tag, event and namespace funcs see nothing for them, and namespace
+ * bindings in scope at the cut are not carried.
+ *
+ * Plans assume entity references are terminated by ';' before the next tag;
+ * documents where they are not fail the same way whole or sharded.
+ */
+
+#define SXMLShardContextLength SXMLElementLength
+
+typedef struct {
+  unsigned long begin;
+  unsigned long end;
+  unsigned int depth;
+  char context[SXMLShardContextLength];
+} SXMLShard;
+
+// Plans shards of roughly target bytes over xml[0, len). Returns the number
+// of shards written (at most max_shards; the last one always ends at len).
+unsigned int sxml_plan_shards(const char* xml, unsigned long len, unsigned long target,
+                              SXMLShard* shards, unsigned int max_shards);
+
+// Parses xml[shard->begin, shard->end) with a fresh or reused explorer.
+// Offsets reported by the explorer are absolute within the document.
+unsigned char sxml_run_explorer_shard(SXMLExplorer*, char* xml, const SXMLShard*);
+
+// One shard per line: "<begin> <end> <depth>[ <element>...]"
+unsigned int sxml_format_shard(const SXMLShard*, char* out, unsigned int size);
+unsigned char sxml_parse_shard(SXMLShard*, const char* line);
+
+#endif
@@ -2,8 +2,13 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <float.h>
+#include <locale.h>
+#include <math.h>
 
 #include "sparsexml-priv.h"
+#include "sparsexml-entities.h"
+#include "sparsexml-pow5.h"
 
 // =============================================================================
 // BASIC UTILITY FUNCTIONS
@@ -21,7 +26,11 @@ unsigned char priv_append_char(SXMLExplorer* explorer, char c) {
 
 // Helper to append a string to the buffer
 unsigned char priv_append_string(SXMLExplorer* explorer, const char* str) {
-  unsigned int len = strlen(str);
+  return priv_append_bytes(explorer, str, strlen(str));
+}
+
+// Helper to append len bytes to the buffer
+unsigned char priv_append_bytes(SXMLExplorer* explorer, const char* str, unsigned int len) {
   if (explorer->bp + len < SXMLElementLength) {
     memcpy(explorer->buffer + explorer->bp, str, len);
     explorer->bp += len;
@@ -42,7 +51,20 @@ SXMLExplorer* sxml_make_explorer(void) {
   explorer->state = INITIAL;
   explorer->bp = 0;
   explorer->buffer[0] = '\0';
+  explorer->tag_func = NULL;
+  explorer->content_func = NULL;
+  explorer->attribute_value_func = NULL;
+  explorer->attribute_key_func = NULL;
   explorer->comment_func = NULL;
+  explorer->event_func = NULL;
+  explorer->event_user = NULL;
+  explorer->namespace_func = NULL;
+  explorer->namespace_user = NULL;
+  explorer->name_func = NULL;
+  explorer->name_user = NULL;
+  explorer->consumed = 0;
+  explorer->offset = 0;
+  explorer->event_budget = 0;
   explorer->prev_state = INITIAL;
   explorer->entity_bp = 0;
   explorer->entity_buffer[0] = '\0';
@@ -50,11 +72,74 @@ SXMLExplorer* sxml_make_explorer(void) {
   explorer->enable_namespace_processing = 0;
   explorer->enable_extended_entities = 0;
   explorer->enable_numeric_entities = 0;
+  explorer->lazy_entities = 0;
+  explorer->text_has_entities = 0;
+  explorer->lazy_attributes = 0;
+  explorer->tag_scan = 0;
+  explorer->whitespace_skip = 0;
+  explorer->text_coalescing = 0;
+  explorer->attr_region = 0;
+  explorer->attr_quote = '\0';
+  explorer->start_tag_open = 0;
+  explorer->skip_pending = 0;
+  explorer->skip_depth = 0;
+  explorer->skip_mode = SXMLSkipContent;
+  explorer->skip_count = 0;
+  explorer->skip_last = '\0';
+  explorer->base64_pending = 0;
+  explorer->base64 = 0;
+  explorer->base64_count = 0;
+  explorer->base64_pad = 0;
+  explorer->base64_bits = 0;
+  explorer->entities = NULL;
+  explorer->entity_pool_used = 0;
+  explorer->entity_count = 0;
+  explorer->entity_expansion_limit = SXMLElementLength;
+  explorer->entity_expansions = 0;
+  explorer->doctype_subset = 0;
+  explorer->doctype_comment = 0;
+  explorer->doctype_quote = '\0';
+  explorer->symbols = NULL;
+  explorer->symbol_count = 1;  // SXMLNamespaceNone, the empty name
+  explorer->symbol_pool_used = 0;
+  explorer->ns = NULL;
+  explorer->ns_count = 0;
+  explorer->ns_depth = 0;
+  explorer->ns_pending = 0;
+  explorer->ns_element_len = 0;
+  explorer->ns_binding_pending = 0;
+  explorer->ns_binding_prefix = 0;
+  explorer->name_interning = 0;
+  explorer->element_depth = 0;
+  explorer->element_max_depth = SXMLElementMaxDepth;
+  explorer->element_open = 0;
+  explorer->element_replay = 0;
+  explorer->element_path_enabled = 0;
+  explorer->elements = NULL;
+  explorer->element_path_len = 0;
+  explorer->attrs = NULL;
+  explorer->attr_arena_used = 0;
+  explorer->attr_name_len = 0;
+  explorer->attr_count = 0;
+  explorer->start_element_func = NULL;
+  explorer->start_element_user = NULL;
+  explorer->base64_func = NULL;
+  explorer->base64_user = NULL;
+  explorer->handlers = NULL;
+  explorer->handler_count = 0;
+  memset(explorer->handler_first, 0, sizeof(explorer->handler_first));
+  explorer->handler_lengths = 0;
 
   return explorer;
 }
 
 void sxml_destroy_explorer(SXMLExplorer *explorer) {
+  free(explorer->entities);
+  free(explorer->ns);
+  free(explorer->symbols);
+  free(explorer->handlers);
+  free(explorer->elements);
+  free(explorer->attrs);
   free(explorer);
 }
 
@@ -69,6 +154,30 @@ void sxml_register_comment_func(SXMLExplorer* explorer, void* comment) {
   explorer->comment_func = comment;
 }
 
+void sxml_register_namespace_func(SXMLExplorer* explorer, void* func, void* user) {
+  explorer->namespace_func = func;
+  explorer->namespace_user = user;
+}
+
+void sxml_register_name_func(SXMLExplorer* explorer, void* func, void* user) {
+  explorer->name_func = func;
+  explorer->name_user = user;
+}
+
+void sxml_register_start_element_func(SXMLExplorer* explorer, void* func, void* user) {
+  explorer->start_element_func = func;
+  explorer->start_element_user = user;
+}
+
+void sxml_enable_name_interning(SXMLExplorer* explorer, unsigned char enable) {
+  explorer->name_interning = enable;
+}
+
+void sxml_register_event_func(SXMLExplorer* explorer, void* event, void* user) {
+  explorer->event_func = event;
+  explorer->event_user = user;
+}
+
 void sxml_enable_entity_processing(SXMLExplorer* explorer, unsigned char enable) {
   explorer->enable_entity_processing = enable;
 }
@@ -85,141 +194,1984 @@ void sxml_enable_numeric_entities(SXMLExplorer* explorer, unsigned char enable)
   explorer->enable_numeric_entities = enable;
 }
 
+void sxml_enable_tag_scan(SXMLExplorer* explorer, unsigned char enable) {
+  explorer->tag_scan = enable;
+}
+
+void sxml_enable_whitespace_skip(SXMLExplorer* explorer, unsigned char enable) {
+  explorer->whitespace_skip = enable;
+}
+
+void sxml_enable_text_coalescing(SXMLExplorer* explorer, unsigned char enable) {
+  explorer->text_coalescing = enable;
+}
+
+void sxml_enable_lazy_entities(SXMLExplorer* explorer, unsigned char enable) {
+  explorer->lazy_entities = enable;
+}
+
+unsigned char sxml_text_needs_decoding(SXMLExplorer* explorer) {
+  return explorer->text_has_entities;
+}
+
+unsigned char sxml_register_entity(SXMLExplorer* explorer, const char* name, const char* value) {
+  return priv_sxml_bind_entity(explorer, name, strlen(name), value, strlen(value));
+}
+
+void sxml_set_entity_expansion_limit(SXMLExplorer* explorer, unsigned int limit) {
+  explorer->entity_expansion_limit = limit;
+}
+
+unsigned long sxml_explorer_consumed(SXMLExplorer* explorer) {
+  return explorer->consumed;
+}
+
+unsigned long sxml_explorer_offset(SXMLExplorer* explorer) {
+  return explorer->offset;
+}
+
+// Tables allocated on first use are copied only when they exist
+static void* priv_sxml_copy_table(const void* table, size_t size) {
+  void* copy;
+  if (table == NULL || (copy = malloc(size)) == NULL) {
+    return NULL;
+  }
+  return memcpy(copy, table, size);
+}
+
+SXMLExplorer* sxml_clone_explorer(SXMLExplorer* explorer) {
+  SXMLExplorer* clone = malloc(sizeof(SXMLExplorer));
+  if (clone == NULL) {
+    return NULL;
+  }
+  memcpy(clone, explorer, sizeof(SXMLExplorer));
+  clone->entities = priv_sxml_copy_table(explorer->entities, sizeof(SXMLEntityTable));
+  clone->ns = priv_sxml_copy_table(explorer->ns, sizeof(SXMLNamespaceStack));
+  clone->symbols = priv_sxml_copy_table(explorer->symbols, sizeof(SXMLSymbolTable));
+  clone->handlers = priv_sxml_copy_table(explorer->handlers, sizeof(SXMLHandlerTable));
+  clone->elements = priv_sxml_copy_table(explorer->elements, sizeof(SXMLElementStack));
+  clone->attrs = priv_sxml_copy_table(explorer->attrs, sizeof(SXMLAttributeBatch));
+  if ((explorer->entities != NULL && clone->entities == NULL) || (explorer->ns != NULL && clone->ns == NULL) ||
+      (explorer->symbols != NULL && clone->symbols == NULL) || (explorer->handlers != NULL && clone->handlers == NULL) ||
+      (explorer->elements != NULL && clone->elements == NULL) || (explorer->attrs != NULL && clone->attrs == NULL)) {
+    sxml_destroy_explorer(clone);
+    return NULL;
+  }
+  return clone;
+}
+
 // =============================================================================
-// XML PARSING: NAMESPACE PROCESSING
+// EXPLORER SNAPSHOT / RESTORE
 // =============================================================================
 
-void priv_sxml_process_namespace(char* tag_name, char** namespace_uri, char** local_name) {
-  char* colon_pos = strchr(tag_name, ':');
-  if (colon_pos != NULL) {
-    *colon_pos = '\0';  // Split the string
-    *namespace_uri = tag_name;
-    *local_name = colon_pos + 1;
-  } else {
-    *namespace_uri = NULL;
-    *local_name = tag_name;
+// Blob layout, little endian:
+//   "SXS" version:1 flags:1 state:1 prev_state:1 offset:8 doctype:1
+//   bp:2 buffer[bp] entity_bp:1 entity_buffer[entity_bp]
+//   entity_count:2 { name_len:1 value_len:2 name value }... expansion_limit:4
+//   symbol_count:2 { len:2 symbol }...          (from id 1; id 0 is "")
+//   ns_count:1 { prefix:2 uri:2 }... ns_depth:1 { mark:1 }...
+//   ns_flags:1 ns_binding_prefix:2 ns_element_len:1 ns_element
+//   max_depth:2 element_depth:2 { id:2 mark:2 }... path_len:2 path
+//   attr_name_len:2 attr_count:1 { key:2 key_len:2 value:2 value_len:2 }...
+//   attr_arena_used:2 attr_arena attr_region:2 attr_quote:1
+//   skip_depth:4 skip_mode:1 skip_count:1 skip_last:1
+//   base64_flags:1 base64_count:1 base64_bits:4   (flags include the text options)
+// Callbacks are process-local and are not part of the snapshot.
+
+static void priv_sxml_put_uint(unsigned char* out, unsigned long value, unsigned int bytes) {
+  unsigned int i;
+  for (i = 0; i < bytes; i++) {
+    out[i] = (unsigned char)(value & 0xFF);
+    value = i + 1 < sizeof(unsigned long) ? value >> 8 : 0;
+  }
+}
+
+static unsigned long priv_sxml_get_uint(const unsigned char* in, unsigned int bytes) {
+  unsigned long value = 0;
+  unsigned int i;
+  for (i = 0; i < bytes && i < sizeof(unsigned long); i++) {
+    value |= (unsigned long)in[i] << (8 * i);
+  }
+  return value;
+}
+
+unsigned int sxml_snapshot_explorer(SXMLExplorer* explorer, unsigned char* out, unsigned int size) {
+  unsigned int need = SXMLSnapshotHeaderLength + 2 + explorer->bp + 1 + explorer->entity_bp + 2 + 4;
+  unsigned char* p = out;
+  unsigned int i;
+
+  for (i = 0; explorer->entities != NULL && i < SXMLEntityTableSlots; i++) {
+    if (explorer->entities->slots[i].name_len != 0) {
+      need += 3 + explorer->entities->slots[i].name_len + explorer->entities->slots[i].value_len;
+    }
+  }
+  need += 2;
+  for (i = 1; i < explorer->symbol_count; i++) {
+    need += 2 + explorer->symbols->entries[i].len;
+  }
+  need += 1 + 4 * explorer->ns_count + 1 + explorer->ns_depth + 4 + explorer->ns_element_len;
+  need += 4 + 4 * explorer->element_depth + 2 + explorer->element_path_len;
+  need += 3 + 8 * explorer->attr_count + 2 + explorer->attr_arena_used + 3 + 7 + 6;
+  if (out == NULL || size < need) {
+    return need;
+  }
+
+  memcpy(p, "SXS", 3);
+  p[3] = SXMLSnapshotVersion;
+  p[4] = (explorer->enable_entity_processing ? 0x01 : 0) |
+         (explorer->enable_namespace_processing ? 0x02 : 0) |
+         (explorer->enable_extended_entities ? 0x04 : 0) |
+         (explorer->enable_numeric_entities ? 0x08 : 0) |
+         (explorer->lazy_entities ? 0x10 : 0) |
+         (explorer->text_has_entities ? 0x20 : 0) |
+         (explorer->name_interning ? 0x40 : 0) |
+         (explorer->lazy_attributes ? 0x80 : 0);
+  p[5] = (unsigned char)explorer->state;
+  p[6] = (unsigned char)explorer->prev_state;
+  priv_sxml_put_uint(p + 7, explorer->offset, 8);
+  p[15] = (explorer->doctype_subset ? 0x01 : 0) |
+          (explorer->doctype_comment ? 0x02 : 0) |
+          (explorer->doctype_quote == '"' ? 0x04 : 0) |
+          (explorer->doctype_quote == '\'' ? 0x08 : 0);
+  p += SXMLSnapshotHeaderLength;
+
+  priv_sxml_put_uint(p, explorer->bp, 2);
+  memcpy(p + 2, explorer->buffer, explorer->bp);
+  p += 2 + explorer->bp;
+
+  p[0] = (unsigned char)explorer->entity_bp;
+  memcpy(p + 1, explorer->entity_buffer, explorer->entity_bp);
+  p += 1 + explorer->entity_bp;
+
+  priv_sxml_put_uint(p, explorer->entity_count, 2);
+  p += 2;
+  for (i = 0; explorer->entities != NULL && i < SXMLEntityTableSlots; i++) {
+    const SXMLEntityBinding* binding = &explorer->entities->slots[i];
+    if (binding->name_len == 0) {
+      continue;
+    }
+    p[0] = binding->name_len;
+    priv_sxml_put_uint(p + 1, binding->value_len, 2);
+    memcpy(p + 3, explorer->entities->pool + binding->name, binding->name_len);
+    memcpy(p + 3 + binding->name_len, explorer->entities->pool + binding->value, binding->value_len);
+    p += 3 + binding->name_len + binding->value_len;
+  }
+  priv_sxml_put_uint(p, explorer->entity_expansion_limit, 4);
+  p += 4;
+
+  // Interning in id order reproduces the same ids on restore
+  priv_sxml_put_uint(p, explorer->symbol_count - 1, 2);
+  p += 2;
+  for (i = 1; i < explorer->symbol_count; i++) {
+    const SXMLSymbol* symbol = &explorer->symbols->entries[i];
+    priv_sxml_put_uint(p, symbol->len, 2);
+    memcpy(p + 2, explorer->symbols->pool + symbol->offset, symbol->len);
+    p += 2 + symbol->len;
+  }
+
+  *p++ = (unsigned char)explorer->ns_count;
+  for (i = 0; i < explorer->ns_count; i++) {
+    priv_sxml_put_uint(p, explorer->ns->bindings[i].prefix, 2);
+    priv_sxml_put_uint(p + 2, explorer->ns->bindings[i].uri, 2);
+    p += 4;
+  }
+  *p++ = (unsigned char)explorer->ns_depth;
+  for (i = 0; i < explorer->ns_depth; i++) {
+    *p++ = (unsigned char)explorer->ns->marks[i];
+  }
+  p[0] = (explorer->ns_pending ? 0x01 : 0) | (explorer->ns_binding_pending ? 0x02 : 0) |
+         (explorer->element_open ? 0x04 : 0) | (explorer->element_path_enabled ? 0x08 : 0) |
+         (explorer->tag_scan ? 0x10 : 0) | (explorer->skip_pending ? 0x20 : 0) |
+         (explorer->start_tag_open ? 0x40 : 0) | (explorer->base64_pending ? 0x80 : 0);
+  priv_sxml_put_uint(p + 1, explorer->ns_binding_prefix, 2);
+  p[3] = (unsigned char)explorer->ns_element_len;
+  if (explorer->ns_element_len > 0) {
+    memcpy(p + 4, explorer->ns->element, explorer->ns_element_len);
+  }
+  p += 4 + explorer->ns_element_len;
+
+  priv_sxml_put_uint(p, explorer->element_max_depth, 2);
+  priv_sxml_put_uint(p + 2, explorer->element_depth, 2);
+  p += 4;
+  for (i = 0; i < explorer->element_depth; i++) {
+    priv_sxml_put_uint(p, explorer->elements->ids[i], 2);
+    priv_sxml_put_uint(p + 2, explorer->elements->marks[i], 2);
+    p += 4;
+  }
+  priv_sxml_put_uint(p, explorer->element_path_len, 2);
+  if (explorer->element_path_len > 0) {
+    memcpy(p + 2, explorer->elements->path, explorer->element_path_len);
+  }
+  p += 2 + explorer->element_path_len;
+
+  priv_sxml_put_uint(p, explorer->attr_name_len, 2);
+  p[2] = (unsigned char)explorer->attr_count;
+  p += 3;
+  for (i = 0; i < explorer->attr_count; i++) {
+    const SXMLAttributeSpan* span = &explorer->attrs->spans[i];
+    priv_sxml_put_uint(p, span->key, 2);
+    priv_sxml_put_uint(p + 2, span->key_len, 2);
+    priv_sxml_put_uint(p + 4, span->value, 2);
+    priv_sxml_put_uint(p + 6, span->value_len, 2);
+    p += 8;
+  }
+  priv_sxml_put_uint(p, explorer->attr_arena_used, 2);
+  if (explorer->attr_arena_used > 0) {
+    memcpy(p + 2, explorer->attrs->arena, explorer->attr_arena_used);
+  }
+  p += 2 + explorer->attr_arena_used;
+
+  priv_sxml_put_uint(p, explorer->attr_region, 2);
+  p[2] = (unsigned char)explorer->attr_quote;
+  p += 3;
+
+  priv_sxml_put_uint(p, explorer->skip_depth, 4);
+  p[4] = explorer->skip_mode;
+  p[5] = explorer->skip_count;
+  p[6] = (unsigned char)explorer->skip_last;
+  p += 7;
+
+  p[0] = (explorer->base64 ? 0x01 : 0) | (explorer->base64_pad ? 0x02 : 0) |
+         (explorer->whitespace_skip ? 0x04 : 0) | (explorer->text_coalescing ? 0x08 : 0);
+  p[1] = explorer->base64_count;
+  priv_sxml_put_uint(p + 2, explorer->base64_bits, 4);
+
+  return need;
+}
+
+// Decodes everything after the fixed header into scratch; returns 0 when the
+// blob is truncated or inconsistent
+static unsigned char priv_sxml_restore_tables(SXMLExplorer* scratch, const unsigned char* p, const unsigned char* end) {
+  unsigned int count, i;
+
+  if (p + 2 > end) {
+    return 0;
+  }
+  count = priv_sxml_get_uint(p, 2);
+  p += 2;
+  for (i = 0; i < count; i++) {
+    unsigned int name_len, value_len;
+    if (p + 3 > end) {
+      return 0;
+    }
+    name_len = p[0];
+    value_len = priv_sxml_get_uint(p + 1, 2);
+    if (p + 3 + name_len + value_len > end ||
+        priv_sxml_bind_entity(scratch, (const char*)p + 3, name_len, (const char*)p + 3 + name_len, value_len) != SXMLExplorerContinue) {
+      return 0;
+    }
+    p += 3 + name_len + value_len;
+  }
+  if (p + 4 > end) {
+    return 0;
+  }
+  scratch->entity_expansion_limit = priv_sxml_get_uint(p, 4);
+  p += 4;
+
+  if (p + 2 > end) {
+    return 0;
+  }
+  count = priv_sxml_get_uint(p, 2);
+  p += 2;
+  for (i = 0; i < count; i++) {
+    unsigned int len;
+    if (p + 2 > end || p + 2 + (len = priv_sxml_get_uint(p, 2)) > end ||
+        priv_sxml_intern(scratch, (const char*)p + 2, len) != i + 1) {
+      return 0;
+    }
+    p += 2 + len;
+  }
+
+  if (p + 1 > end || p[0] > SXMLNamespaceBindings || p + 1 + 4 * p[0] + 1 > end) {
+    return 0;
+  }
+  // The scope stack is only allocated when the blob holds scopes
+  if (p[0] > 0 && priv_sxml_namespace_stack(scratch) == NULL) {
+    return 0;
+  }
+  scratch->ns_count = *p++;
+  for (i = 0; i < scratch->ns_count; i++) {
+    scratch->ns->bindings[i].prefix = priv_sxml_get_uint(p, 2);
+    scratch->ns->bindings[i].uri = priv_sxml_get_uint(p + 2, 2);
+    if (scratch->ns->bindings[i].prefix >= scratch->symbol_count || scratch->ns->bindings[i].uri >= scratch->symbol_count) {
+      return 0;
+    }
+    p += 4;
+  }
+  if (p[0] > SXMLNamespaceMaxDepth || p + 1 + p[0] + 4 > end) {
+    return 0;
+  }
+  if (p[0] > 0 && priv_sxml_namespace_stack(scratch) == NULL) {
+    return 0;
+  }
+  scratch->ns_depth = *p++;
+  for (i = 0; i < scratch->ns_depth; i++) {
+    scratch->ns->marks[i] = *p++;
+    if (scratch->ns->marks[i] > scratch->ns_count) {
+      return 0;
+    }
+  }
+  scratch->ns_pending = (p[0] & 0x01) != 0;
+  scratch->ns_binding_pending = (p[0] & 0x02) != 0;
+  scratch->element_open = (p[0] & 0x04) != 0;
+  scratch->element_path_enabled = (p[0] & 0x08) != 0;
+  scratch->tag_scan = (p[0] & 0x10) != 0;
+  scratch->skip_pending = (p[0] & 0x20) != 0;
+  scratch->start_tag_open = (p[0] & 0x40) != 0;
+  scratch->base64_pending = (p[0] & 0x80) != 0;
+  scratch->ns_binding_prefix = priv_sxml_get_uint(p + 1, 2);
+  scratch->ns_element_len = p[3];
+  if (scratch->ns_element_len >= SXMLNamespaceNameLength || p + 4 + scratch->ns_element_len + 2 > end) {
+    return 0;
+  }
+  if (scratch->ns_element_len > 0) {
+    if (priv_sxml_namespace_stack(scratch) == NULL) {
+      return 0;
+    }
+    memcpy(scratch->ns->element, p + 4, scratch->ns_element_len);
+    scratch->ns->element[scratch->ns_element_len] = '\0';
+  }
+  p += 4 + scratch->ns_element_len;
+
+  if (p + 4 > end) {
+    return 0;
+  }
+  scratch->element_max_depth = priv_sxml_get_uint(p, 2);
+  scratch->element_depth = priv_sxml_get_uint(p + 2, 2);
+  p += 4;
+  if (scratch->element_max_depth > SXMLElementMaxDepth || scratch->element_depth > scratch->element_max_depth ||
+      p + 4 * scratch->element_depth + 2 > end) {
+    return 0;
+  }
+  if (scratch->element_depth > 0 && priv_sxml_element_stack(scratch) == NULL) {
+    return 0;
+  }
+  for (i = 0; i < scratch->element_depth; i++) {
+    scratch->elements->ids[i] = priv_sxml_get_uint(p, 2);
+    scratch->elements->marks[i] = priv_sxml_get_uint(p + 2, 2);
+    if ((scratch->elements->ids[i] >= scratch->symbol_count && scratch->elements->ids[i] != SXMLSymbolUnknown) ||
+        scratch->elements->marks[i] >= SXMLElementPathLength) {
+      return 0;
+    }
+    p += 4;
+  }
+  scratch->element_path_len = priv_sxml_get_uint(p, 2);
+  if (scratch->element_path_len >= SXMLElementPathLength || p + 2 + scratch->element_path_len > end) {
+    return 0;
+  }
+  if (scratch->element_path_len > 0) {
+    if (priv_sxml_element_stack(scratch) == NULL) {
+      return 0;
+    }
+    memcpy(scratch->elements->path, p + 2, scratch->element_path_len);
+    scratch->elements->path[scratch->element_path_len] = '\0';
+  }
+  p += 2 + scratch->element_path_len;
+
+  if (p + 3 > end || p[2] > SXMLAttributeMax || p + 3 + 8 * p[2] + 2 > end) {
+    return 0;
+  }
+  scratch->attr_name_len = priv_sxml_get_uint(p, 2);
+  scratch->attr_count = p[2];
+  p += 3;
+  if (scratch->attr_count > 0 && priv_sxml_attr_batch(scratch) == NULL) {
+    return 0;
+  }
+  for (i = 0; i < scratch->attr_count; i++) {
+    scratch->attrs->spans[i].key = priv_sxml_get_uint(p, 2);
+    scratch->attrs->spans[i].key_len = priv_sxml_get_uint(p + 2, 2);
+    scratch->attrs->spans[i].value = priv_sxml_get_uint(p + 4, 2);
+    scratch->attrs->spans[i].value_len = priv_sxml_get_uint(p + 6, 2);
+    p += 8;
+  }
+  scratch->attr_arena_used = priv_sxml_get_uint(p, 2);
+  if (scratch->attr_arena_used > SXMLAttributeArenaLength || p + 2 + scratch->attr_arena_used > end ||
+      scratch->attr_name_len > scratch->attr_arena_used) {
+    return 0;
+  }
+  for (i = 0; i < scratch->attr_count; i++) {
+    const SXMLAttributeSpan* span = &scratch->attrs->spans[i];
+    if (span->key + span->key_len >= scratch->attr_arena_used || span->value + span->value_len >= scratch->attr_arena_used) {
+      return 0;
+    }
+  }
+  if (scratch->attr_arena_used > 0) {
+    if (priv_sxml_attr_batch(scratch) == NULL) {
+      return 0;
+    }
+    memcpy(scratch->attrs->arena, p + 2, scratch->attr_arena_used);
+  }
+  p += 2 + scratch->attr_arena_used;
+
+  if (p + 3 > end) {
+    return 0;
+  }
+  scratch->attr_region = priv_sxml_get_uint(p, 2);
+  scratch->attr_quote = (char)p[2];
+  if (scratch->attr_region >= SXMLElementLength || (scratch->attr_quote != '\0' && scratch->attr_quote != '"' && scratch->attr_quote != '\'')) {
+    return 0;
+  }
+  p += 3;
+
+  if (p + 7 > end || p[4] > SXMLSkipInstruction) {
+    return 0;
+  }
+  scratch->skip_depth = priv_sxml_get_uint(p, 4);
+  scratch->skip_mode = p[4];
+  scratch->skip_count = p[5];
+  scratch->skip_last = (char)p[6];
+  p += 7;
+
+  if (p + 6 > end || p[1] > 3) {
+    return 0;
+  }
+  scratch->base64 = (p[0] & 0x01) != 0;
+  scratch->base64_pad = (p[0] & 0x02) != 0;
+  scratch->whitespace_skip = (p[0] & 0x04) != 0;
+  scratch->text_coalescing = (p[0] & 0x08) != 0;
+  scratch->base64_count = p[1];
+  scratch->base64_bits = priv_sxml_get_uint(p + 2, 4) & 0x3FFFF;
+  return 1;
+}
+
+unsigned char sxml_restore_explorer(SXMLExplorer* explorer, const unsigned char* blob, unsigned int len) {
+  const unsigned char* p = blob;
+  const unsigned char* end = blob + len;
+  unsigned int bp, entity_bp, i;
+  SXMLExplorer* scratch;
+  SXMLEntityTable* entities;
+  SXMLNamespaceStack* ns;
+  SXMLSymbolTable* symbols;
+  SXMLElementStack* elements;
+  SXMLAttributeBatch* attrs;
+
+  if (len < SXMLSnapshotHeaderLength + 3 || memcmp(p, "SXS", 3) != 0 || p[3] != SXMLSnapshotVersion ||
+      p[5] > IN_DOCTYPE || p[6] > IN_DOCTYPE) {
+    return SXMLExplorerErrorMalformedXML;
+  }
+  p += SXMLSnapshotHeaderLength;
+  bp = priv_sxml_get_uint(p, 2);
+  if (bp >= SXMLElementLength || p + 2 + bp + 1 > end) {
+    return SXMLExplorerErrorMalformedXML;
+  }
+  entity_bp = p[2 + bp];
+  if (entity_bp >= sizeof(explorer->entity_buffer) || p + 2 + bp + 1 + entity_bp > end) {
+    return SXMLExplorerErrorMalformedXML;
+  }
+
+  // Rebuild the tables aside so a bad blob leaves the explorer untouched
+  scratch = sxml_make_explorer();
+  if (scratch == NULL) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  if (!priv_sxml_restore_tables(scratch, p + 2 + bp + 1 + entity_bp, end)) {
+    sxml_destroy_explorer(scratch);
+    return SXMLExplorerErrorMalformedXML;
+  }
+  // Handlers stay registered; their names get ids in the restored table
+  if (explorer->handlers != NULL) {
+    memset(explorer->handlers->of, 0, sizeof(explorer->handlers->of));
+  }
+  for (i = 0; i < explorer->handler_count; i++) {
+    SXMLElementHandler* handler = &explorer->handlers->entries[i];
+    const SXMLSymbol* symbol;
+    if (handler->id == SXMLSymbolUnknown) {
+      continue;
+    }
+    symbol = &explorer->symbols->entries[handler->id];
+    handler->id = priv_sxml_intern(scratch, explorer->symbols->pool + symbol->offset, symbol->len);
+    if (handler->id != SXMLSymbolUnknown) {
+      explorer->handlers->of[handler->id] = i + 1;
+    }
   }
+  // Tables move over from scratch; the replaced ones are freed with it
+  entities = explorer->entities;
+  explorer->entities = scratch->entities;
+  scratch->entities = entities;
+  explorer->entity_pool_used = scratch->entity_pool_used;
+  explorer->entity_count = scratch->entity_count;
+  explorer->entity_expansion_limit = scratch->entity_expansion_limit;
+  symbols = explorer->symbols;
+  explorer->symbols = scratch->symbols;
+  scratch->symbols = symbols;
+  explorer->symbol_count = scratch->symbol_count;
+  explorer->symbol_pool_used = scratch->symbol_pool_used;
+  ns = explorer->ns;
+  explorer->ns = scratch->ns;
+  scratch->ns = ns;
+  explorer->ns_count = scratch->ns_count;
+  explorer->ns_depth = scratch->ns_depth;
+  explorer->ns_element_len = scratch->ns_element_len;
+  explorer->ns_pending = scratch->ns_pending;
+  explorer->ns_binding_pending = scratch->ns_binding_pending;
+  explorer->ns_binding_prefix = scratch->ns_binding_prefix;
+  elements = explorer->elements;
+  explorer->elements = scratch->elements;
+  scratch->elements = elements;
+  explorer->element_depth = scratch->element_depth;
+  explorer->element_max_depth = scratch->element_max_depth;
+  explorer->element_open = scratch->element_open;
+  explorer->element_path_enabled = scratch->element_path_enabled;
+  explorer->tag_scan = scratch->tag_scan;
+  explorer->element_path_len = scratch->element_path_len;
+  attrs = explorer->attrs;
+  explorer->attrs = scratch->attrs;
+  scratch->attrs = attrs;
+  explorer->attr_arena_used = scratch->attr_arena_used;
+  explorer->attr_name_len = scratch->attr_name_len;
+  explorer->attr_count = scratch->attr_count;
+  explorer->attr_region = scratch->attr_region;
+  explorer->attr_quote = scratch->attr_quote;
+  explorer->skip_pending = scratch->skip_pending;
+  explorer->start_tag_open = scratch->start_tag_open;
+  explorer->skip_depth = scratch->skip_depth;
+  explorer->skip_mode = scratch->skip_mode;
+  explorer->skip_count = scratch->skip_count;
+  explorer->skip_last = scratch->skip_last;
+  explorer->base64_pending = scratch->base64_pending;
+  explorer->base64 = scratch->base64;
+  explorer->base64_pad = scratch->base64_pad;
+  explorer->whitespace_skip = scratch->whitespace_skip;
+  explorer->text_coalescing = scratch->text_coalescing;
+  explorer->base64_count = scratch->base64_count;
+  explorer->base64_bits = scratch->base64_bits;
+  sxml_destroy_explorer(scratch);
+
+  explorer->enable_entity_processing = (blob[4] & 0x01) != 0;
+  explorer->enable_namespace_processing = (blob[4] & 0x02) != 0;
+  explorer->enable_extended_entities = (blob[4] & 0x04) != 0;
+  explorer->enable_numeric_entities = (blob[4] & 0x08) != 0;
+  explorer->lazy_entities = (blob[4] & 0x10) != 0;
+  explorer->text_has_entities = (blob[4] & 0x20) != 0;
+  explorer->name_interning = (blob[4] & 0x40) != 0;
+  explorer->lazy_attributes = (blob[4] & 0x80) != 0;
+  explorer->state = (SXMLExplorerState)blob[5];
+  explorer->prev_state = (SXMLExplorerState)blob[6];
+  explorer->offset = priv_sxml_get_uint(blob + 7, 8);
+  explorer->doctype_subset = (blob[15] & 0x01) != 0;
+  explorer->doctype_comment = (blob[15] & 0x02) != 0;
+  explorer->doctype_quote = (blob[15] & 0x04) ? '"' : (blob[15] & 0x08) ? '\'' : '\0';
+
+  explorer->bp = bp;
+  memcpy(explorer->buffer, p + 2, bp);
+  explorer->buffer[bp] = '\0';
+  p += 2 + bp;
+
+  explorer->entity_bp = entity_bp;
+  memcpy(explorer->entity_buffer, p + 1, entity_bp);
+  explorer->entity_buffer[entity_bp] = '\0';
+
+  return SXMLExplorerContinue;
 }
 
 // =============================================================================
 // XML PARSING: ENTITY PROCESSING
 // =============================================================================
 
-unsigned char priv_sxml_process_entity(SXMLExplorer* explorer, char* entity_buffer) {
-  char replacement = '\0';
-  
-  // First try standard XML entities
-  if (strcmp(entity_buffer, "lt") == 0) {
-    replacement = '<';
-  } else if (strcmp(entity_buffer, "gt") == 0) {
-    replacement = '>';
-  } else if (strcmp(entity_buffer, "amp") == 0) {
-    replacement = '&';
-  } else if (strcmp(entity_buffer, "quot") == 0) {
-    replacement = '"';
-  } else if (strcmp(entity_buffer, "apos") == 0) {
-    replacement = '\'';
-  } else {
-    // Try numeric entities if enabled
-    if (explorer->enable_numeric_entities && (entity_buffer[0] == '#')) {
-      return priv_sxml_process_numeric_entity(explorer, entity_buffer);
+// FNV-1a plus a murmur-style finalizer; must match tools/gen-entities.py
+static unsigned int priv_sxml_entity_hash(const char* name, unsigned int len) {
+  unsigned int h = 0x811C9DC5u;
+  unsigned int i;
+  for (i = 0; i < len; i++) {
+    h = (h ^ (unsigned char)name[i]) * 0x01000193u;
+  }
+  return h;
+}
+
+static unsigned int priv_sxml_entity_mix(unsigned int h) {
+  h ^= h >> 16;
+  h *= 0x7FEB352Du;
+  h ^= h >> 15;
+  h *= 0x846CA68Bu;
+  h ^= h >> 16;
+  return h;
+}
+
+const SXMLEntity* priv_sxml_lookup_entity(const char* name, unsigned int len) {
+  unsigned int h;
+  const SXMLEntity* entity;
+
+  if (len == 0 || len > SXMLEntityMaxNameLength) {
+    return NULL;
+  }
+  h = priv_sxml_entity_hash(name, len);
+  entity = &sxml_entity_table[priv_sxml_entity_mix(h ^ sxml_entity_displacements[h % SXMLEntityBuckets]) % SXMLEntityCount];
+  if (entity->name_len != len || memcmp(sxml_entity_names + entity->name, name, len) != 0) {
+    return NULL;
+  }
+  return entity;
+}
+
+// Writes the UTF-8 form of codepoint to out (4 bytes max) and returns its length
+unsigned int priv_sxml_encode_utf8(unsigned int codepoint, char* out) {
+  if (codepoint < 0x80) {
+    out[0] = (char)codepoint;
+    return 1;
+  }
+  if (codepoint < 0x800) {
+    out[0] = (char)(0xC0 | (codepoint >> 6));
+    out[1] = (char)(0x80 | (codepoint & 0x3F));
+    return 2;
+  }
+  if (codepoint < 0x10000) {
+    out[0] = (char)(0xE0 | (codepoint >> 12));
+    out[1] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+    out[2] = (char)(0x80 | (codepoint & 0x3F));
+    return 3;
+  }
+  out[0] = (char)(0xF0 | (codepoint >> 18));
+  out[1] = (char)(0x80 | ((codepoint >> 12) & 0x3F));
+  out[2] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+  out[3] = (char)(0x80 | (codepoint & 0x3F));
+  return 4;
+}
+
+// Decodes the digits of "#123" / "#x1F" (without '&' and ';'). Returns 0 for
+// malformed references and for codepoints XML cannot carry.
+unsigned int priv_sxml_decode_numeric_reference(const char* ref, unsigned int len) {
+  unsigned int codepoint = 0;
+  unsigned int hex = len > 1 && (ref[1] | 0x20) == 'x';
+  unsigned int i = hex ? 2 : 1;
+
+  // At most 6 hex or 7 decimal digits keep the value below 2^32
+  if (len <= i || len - i > (hex ? 6u : 7u)) {
+    return 0;
+  }
+  for (; i < len; i++) {
+    unsigned int c = (unsigned char)ref[i];
+    unsigned int digit = c - '0';
+    unsigned int letter = (c | 0x20) - 'a';
+    if (digit < 10) {
+      codepoint = codepoint * (hex ? 16 : 10) + digit;
+    } else if (hex && letter < 6) {
+      codepoint = codepoint * 16 + letter + 10;
+    } else {
+      return 0;
+    }
+  }
+  if (codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+    return 0;
+  }
+  return codepoint;
+}
+
+// Stateless on-demand decoder for text delivered raw in lazy mode. Anything
+// that is not a valid reference is copied through unchanged.
+// numeric and extended select the references expanded, as the explorer flags
+// of the same names do; the rest are copied through like invalid ones
+static unsigned int priv_sxml_decode_entities(char* dst, const char* src, unsigned int len, unsigned char numeric, unsigned char extended) {
+  const char* end = src + len;
+  char* out = dst;
+
+  while (src < end) {
+    const char* amp = memchr(src, '&', end - src);
+    const char* semi;
+    unsigned int window;
+
+    if (amp == NULL) {
+      memcpy(out, src, end - src);
+      out += end - src;
+      break;
+    }
+    memcpy(out, src, amp - src);
+    out += amp - src;
+    src = amp + 1;
+
+    // No reference is longer than the longest entity name
+    window = end - src < SXMLEntityMaxNameLength + 1 ? end - src : SXMLEntityMaxNameLength + 1;
+    semi = memchr(src, ';', window);
+    if (semi != NULL && semi > src) {
+      if (*src == '#') {
+        unsigned int codepoint = numeric ? priv_sxml_decode_numeric_reference(src, semi - src) : 0;
+        if (codepoint != 0) {
+          out += priv_sxml_encode_utf8(codepoint, out);
+          src = semi + 1;
+          continue;
+        }
+      } else {
+        const SXMLEntity* entity = priv_sxml_lookup_entity(src, semi - src);
+        if (entity != NULL && (entity->xml || extended)) {
+          memcpy(out, sxml_entity_values + entity->value, entity->value_len);
+          out += entity->value_len;
+          src = semi + 1;
+          continue;
+        }
+      }
+    }
+    *out++ = '&';
+  }
+
+  *out = '\0';
+  return out - dst;
+}
+
+unsigned int sxml_decode_entities(char* dst, const char* src, unsigned int len) {
+  return priv_sxml_decode_entities(dst, src, len, 1, 1);
+}
+
+unsigned int sxml_explorer_decode_entities(SXMLExplorer* explorer, char* dst, const char* src, unsigned int len) {
+  return priv_sxml_decode_entities(dst, src, len, explorer->enable_numeric_entities, explorer->enable_extended_entities);
+}
+
+// =============================================================================
+// XML PARSING: DECLARED ENTITIES
+// =============================================================================
+
+static unsigned char priv_sxml_is_space(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// Returns the slot holding name, or the empty slot where it would go
+static unsigned int priv_sxml_find_binding(SXMLExplorer* explorer, const char* name, unsigned int len, unsigned int hash) {
+  unsigned int slot = hash & (SXMLEntityTableSlots - 1);
+  const SXMLEntityBinding* binding;
+
+  while ((binding = &explorer->entities->slots[slot])->name_len != 0) {
+    if (binding->hash == hash && binding->name_len == len &&
+        memcmp(explorer->entities->pool + binding->name, name, len) == 0) {
+      break;
+    }
+    slot = (slot + 1) & (SXMLEntityTableSlots - 1);
+  }
+  return slot;
+}
+
+unsigned char priv_sxml_bind_entity(SXMLExplorer* explorer, const char* name, unsigned int name_len, const char* value, unsigned int value_len) {
+  SXMLEntityBinding* binding;
+  unsigned int hash;
+
+  // Names must fit the reference buffer to ever be resolvable
+  if (name_len == 0 || name_len >= sizeof(explorer->entity_buffer) || name[0] == '#') {
+    return SXMLExplorerErrorMalformedXML;
+  }
+  if (explorer->entities == NULL && (explorer->entities = calloc(1, sizeof(SXMLEntityTable))) == NULL) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  hash = priv_sxml_entity_hash(name, name_len);
+  binding = &explorer->entities->slots[priv_sxml_find_binding(explorer, name, name_len, hash)];
+  if (binding->name_len != 0) {
+    return SXMLExplorerContinue;  // First binding wins, as in XML
+  }
+  // Keep the load factor at 3/4 so probe chains stay short and terminate
+  if ((explorer->entity_count + 1) * 4 > SXMLEntityTableSlots * 3 ||
+      explorer->entity_pool_used + name_len + value_len > SXMLEntityPoolLength) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+
+  binding->hash = hash;
+  binding->name = explorer->entity_pool_used;
+  binding->name_len = name_len;
+  memcpy(explorer->entities->pool + explorer->entity_pool_used, name, name_len);
+  explorer->entity_pool_used += name_len;
+  binding->value = explorer->entity_pool_used;
+  binding->value_len = value_len;
+  memcpy(explorer->entities->pool + explorer->entity_pool_used, value, value_len);
+  explorer->entity_pool_used += value_len;
+  explorer->entity_count++;
+
+  return SXMLExplorerContinue;
+}
+
+// Parses one internal-subset declaration held in the buffer (without '>').
+// Only general internal entities are kept; other declarations are skipped.
+unsigned char priv_sxml_process_markup_declaration(SXMLExplorer* explorer) {
+  char* p = explorer->buffer;
+  char* name;
+  char* value;
+  char* end;
+  unsigned int name_len;
+
+  while (priv_sxml_is_space(*p)) p++;
+  if (strncmp(p, "<!ENTITY", 8) != 0) {
+    return SXMLExplorerContinue;
+  }
+  p += 8;
+  if (!priv_sxml_is_space(*p)) {
+    return SXMLExplorerErrorMalformedXML;
+  }
+  while (priv_sxml_is_space(*p)) p++;
+  if (*p == '%') {
+    return SXMLExplorerContinue;  // Parameter entities only matter inside the DTD
+  }
+
+  name = p;
+  while (*p != '\0' && !priv_sxml_is_space(*p) && *p != '"' && *p != '\'') p++;
+  name_len = p - name;
+  while (priv_sxml_is_space(*p)) p++;
+
+  if (*p != '"' && *p != '\'') {
+    // External entities (SYSTEM / PUBLIC) are never fetched
+    if (strncmp(p, "SYSTEM", 6) == 0 || strncmp(p, "PUBLIC", 6) == 0) {
+      return SXMLExplorerContinue;
+    }
+    return SXMLExplorerErrorMalformedXML;
+  }
+  value = p + 1;
+  end = strchr(value, *p);
+  if (end == NULL) {
+    return SXMLExplorerErrorMalformedXML;
+  }
+  return priv_sxml_bind_entity(explorer, name, name_len, value, end - value);
+}
+
+// Appends a declared value, expanding the references it contains
+static unsigned char priv_sxml_expand_binding(SXMLExplorer* explorer, const SXMLEntityBinding* binding, unsigned int depth, unsigned int base) {
+  const char* p = explorer->entities->pool + binding->value;
+  const char* end = p + binding->value_len;
+  unsigned char result;
+
+  // Empty values expand to nothing, so the byte limit alone cannot stop a
+  // wide tree of them; count the references instead
+  if (depth >= SXMLEntityMaxDepth || ++explorer->entity_expansions > SXMLEntityMaxExpansions) {
+    return SXMLExplorerErrorInvalidEntity;
+  }
+  while (p < end) {
+    const char* amp = memchr(p, '&', end - p);
+    const char* semi;
+    result = priv_append_bytes(explorer, p, (amp != NULL ? amp : end) - p);
+    if (result != SXMLExplorerContinue) {
+      return result;
+    }
+    if (explorer->bp - base > explorer->entity_expansion_limit) {
+      return SXMLExplorerErrorInvalidEntity;
+    }
+    if (amp == NULL) {
+      break;
+    }
+    semi = memchr(amp + 1, ';', end - amp - 1);
+    if (semi == NULL) {
+      return SXMLExplorerErrorInvalidEntity;
+    }
+    result = priv_sxml_expand_reference(explorer, amp + 1, semi - amp - 1, depth + 1, base);
+    if (result != SXMLExplorerContinue) {
+      return result;
+    }
+    p = semi + 1;
+  }
+  return SXMLExplorerContinue;
+}
+
+// Resolves one reference (name without '&' and ';') into the buffer. base is
+// the buffer position where the outermost reference started.
+unsigned char priv_sxml_expand_reference(SXMLExplorer* explorer, const char* name, unsigned int len, unsigned int depth, unsigned int base) {
+  const SXMLEntity* entity;
+
+  if (depth == 0) {
+    explorer->entity_expansions = 0;
+  }
+  if (len > 0 && name[0] == '#') {
+    char utf8[4];
+    unsigned int codepoint;
+    if (!explorer->enable_numeric_entities) {
+      return SXMLExplorerErrorInvalidEntity;
+    }
+    codepoint = priv_sxml_decode_numeric_reference(name, len);
+    if (codepoint == 0) {
+      return SXMLExplorerErrorInvalidEntity;
+    }
+    return priv_append_bytes(explorer, utf8, priv_sxml_encode_utf8(codepoint, utf8));
+  }
+
+  if (explorer->entity_count > 0) {
+    const SXMLEntityBinding* binding;
+    binding = &explorer->entities->slots[priv_sxml_find_binding(explorer, name, len, priv_sxml_entity_hash(name, len))];
+    if (binding->name_len != 0) {
+      return priv_sxml_expand_binding(explorer, binding, depth, base);
     }
-    // Try extended entities if enabled
-    if (explorer->enable_extended_entities) {
-      return priv_sxml_process_extended_entity(explorer, entity_buffer);
+  }
+
+  // Predefined XML entities always resolve; the rest of HTML5 is opt-in
+  entity = priv_sxml_lookup_entity(name, len);
+  if (entity == NULL || (!entity->xml && !explorer->enable_extended_entities)) {
+    return SXMLExplorerErrorInvalidEntity;
+  }
+  return priv_append_bytes(explorer, sxml_entity_values + entity->value, entity->value_len);
+}
+
+unsigned char priv_sxml_process_entity(SXMLExplorer* explorer, char* entity_buffer) {
+  return priv_sxml_expand_reference(explorer, entity_buffer, explorer->entity_bp, 0, explorer->bp);
+}
+
+// =============================================================================
+// SYMBOL TABLE
+// =============================================================================
+
+// Ids are dense and stable for the explorer's lifetime; the hash index only
+// maps strings to them. Strings are stored NUL-terminated in the pool.
+unsigned int priv_sxml_find_symbol(SXMLExplorer* explorer, const char* str, unsigned int len) {
+  unsigned int hash = priv_sxml_entity_hash(str, len);
+  unsigned int slot = hash & (SXMLSymbolSlots - 1);
+  unsigned int id;
+
+  if (explorer->symbols == NULL) {
+    return len == 0 ? SXMLNamespaceNone : SXMLSymbolUnknown;
+  }
+  while ((id = explorer->symbols->slots[slot]) != 0) {
+    const SXMLSymbol* symbol = &explorer->symbols->entries[id - 1];
+    if (symbol->hash == hash && symbol->len == len && memcmp(explorer->symbols->pool + symbol->offset, str, len) == 0) {
+      return id - 1;
+    }
+    slot = (slot + 1) & (SXMLSymbolSlots - 1);
+  }
+  return SXMLSymbolUnknown;
+}
+
+unsigned int priv_sxml_intern(SXMLExplorer* explorer, const char* str, unsigned int len) {
+  unsigned int id = priv_sxml_find_symbol(explorer, str, len);
+  unsigned int hash, slot;
+  SXMLSymbol* symbol;
+
+  if (id != SXMLSymbolUnknown) {
+    return id;
+  }
+  if (explorer->symbols == NULL) {
+    // The table starts out holding id 0, the empty name
+    if ((explorer->symbols = calloc(1, sizeof(SXMLSymbolTable))) == NULL) {
+      return SXMLSymbolUnknown;
+    }
+    hash = priv_sxml_entity_hash("", 0);
+    explorer->symbols->slots[hash & (SXMLSymbolSlots - 1)] = SXMLNamespaceNone + 1;
+    explorer->symbols->entries[SXMLNamespaceNone].hash = hash;
+    explorer->symbol_pool_used = 1;
+  }
+  if (explorer->symbol_count >= SXMLSymbolCapacity ||
+      explorer->symbol_pool_used + len + 1 > SXMLSymbolPoolLength) {
+    return SXMLSymbolUnknown;
+  }
+
+  hash = priv_sxml_entity_hash(str, len);
+  slot = hash & (SXMLSymbolSlots - 1);
+  while (explorer->symbols->slots[slot] != 0) {
+    slot = (slot + 1) & (SXMLSymbolSlots - 1);
+  }
+  id = explorer->symbol_count++;
+  explorer->symbols->slots[slot] = id + 1;
+  symbol = &explorer->symbols->entries[id];
+  symbol->hash = hash;
+  symbol->offset = explorer->symbol_pool_used;
+  symbol->len = len;
+  memcpy(explorer->symbols->pool + explorer->symbol_pool_used, str, len);
+  explorer->symbols->pool[explorer->symbol_pool_used + len] = '\0';
+  explorer->symbol_pool_used += len + 1;
+
+  return id;
+}
+
+// Name of an id below symbol_count; id 0 is "" before the table exists
+static const char* priv_sxml_symbol_name(SXMLExplorer* explorer, unsigned int id) {
+  if (explorer->symbols == NULL) {
+    return "";
+  }
+  return explorer->symbols->pool + explorer->symbols->entries[id].offset;
+}
+
+// =============================================================================
+// XML PARSING: NAMESPACE SCOPES
+// =============================================================================
+
+// Every element pushes a mark into the binding stack; its xmlns attributes
+// push bindings above the mark and its end tag drops back to it.
+static unsigned int priv_sxml_lookup_binding(SXMLExplorer* explorer, const char* prefix, unsigned int len) {
+  unsigned int id = priv_sxml_find_symbol(explorer, prefix, len);
+  unsigned int i = explorer->ns_count;
+
+  if (id != SXMLSymbolUnknown) {
+    while (i-- > 0) {
+      if (explorer->ns->bindings[i].prefix == id) {
+        return explorer->ns->bindings[i].uri;
+      }
+    }
+  }
+  // No default namespace means no namespace; other prefixes must be bound
+  return len == 0 ? SXMLNamespaceNone : SXMLNamespaceUnbound;
+}
+
+static unsigned char priv_sxml_namespace_event(SXMLExplorer* explorer, const char* name, unsigned int len, unsigned char end) {
+  const char* colon = memchr(name, ':', len);
+  unsigned int uri;
+
+  if (explorer->namespace_func == NULL) {
+    return SXMLExplorerContinue;
+  }
+  if (colon == NULL) {
+    uri = priv_sxml_lookup_binding(explorer, "", 0);
+  } else {
+    uri = priv_sxml_lookup_binding(explorer, name, colon - name);
+    len -= colon + 1 - name;
+    name = colon + 1;
+  }
+  return priv_sxml_callback_result(explorer, explorer->namespace_func(explorer->namespace_user, uri, (char*)name, len, end));
+}
+
+static void priv_sxml_namespace_pop(SXMLExplorer* explorer) {
+  if (explorer->ns_depth > 0) {
+    explorer->ns_count = explorer->ns->marks[--explorer->ns_depth];
+  }
+}
+
+static void priv_sxml_namespace_prefix(SXMLExplorer* explorer, const char* key, unsigned int len) {
+  explorer->ns_binding_pending = 0;
+  if (len == 5 && strncmp(key, "xmlns", 5) == 0) {
+    explorer->ns_binding_prefix = priv_sxml_intern(explorer, "", 0);
+    explorer->ns_binding_pending = 1;
+  } else if (len > 6 && strncmp(key, "xmlns:", 6) == 0) {
+    explorer->ns_binding_prefix = priv_sxml_intern(explorer, key + 6, len - 6);
+    explorer->ns_binding_pending = 1;
+  }
+}
+
+static unsigned char priv_sxml_namespace_bind(SXMLExplorer* explorer, const char* uri, unsigned int len) {
+  SXMLNamespaceBinding* binding;
+
+  explorer->ns_binding_pending = 0;
+  if (explorer->ns_count >= SXMLNamespaceBindings || explorer->ns_binding_prefix == SXMLSymbolUnknown) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  binding = &explorer->ns->bindings[explorer->ns_count];
+  binding->prefix = explorer->ns_binding_prefix;
+  binding->uri = priv_sxml_intern(explorer, uri, len);
+  if (binding->uri == SXMLSymbolUnknown) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  explorer->ns_count++;
+  return SXMLExplorerContinue;
+}
+
+// Start and end tag names from the IN_TAG buffer
+static unsigned char priv_sxml_namespace_tag(SXMLExplorer* explorer) {
+  const char* name = explorer->buffer;
+  unsigned int len = explorer->attr_region > 0 ? explorer->attr_region : explorer->bp;
+  unsigned char ret;
+
+  // The first tag keeps its '<'; attribute layout can leave whitespace here
+  while (len > 0 && (*name == '<' || priv_sxml_is_space(*name))) {
+    name++;
+    len--;
+  }
+  while (len > 0 && priv_sxml_is_space(name[len - 1])) {
+    len--;
+  }
+  if (len == 0 || (len == 1 && name[0] == '/')) {
+    return SXMLExplorerContinue;  // A lone '/' closes <a x="1"/>, see below
+  }
+
+  if (name[0] == '/') {
+    ret = priv_sxml_namespace_event(explorer, name + 1, len - 1, 1);
+    priv_sxml_namespace_pop(explorer);
+    return ret;
+  }
+  if (explorer->ns_pending) {
+    return SXMLExplorerContinue;
+  }
+
+  if (name[len - 1] == '/') {
+    len--;
+  }
+  if (len >= SXMLNamespaceNameLength || explorer->ns_depth >= SXMLNamespaceMaxDepth) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  memcpy(explorer->ns->element, name, len);
+  explorer->ns->element[len] = '\0';
+  explorer->ns_element_len = len;
+  explorer->ns_pending = 1;
+  explorer->ns->marks[explorer->ns_depth++] = explorer->ns_count;
+
+  // Lazy attributes: pick the xmlns bindings out of the raw section
+  if (explorer->attr_region > 0) {
+    unsigned int region_len, cursor = 0;
+    const char* region = sxml_attr_region(explorer, &region_len);
+    SXMLAttribute attr;
+    while (region != NULL && priv_sxml_next_attribute(region, region_len, &cursor, &attr)) {
+      priv_sxml_namespace_prefix(explorer, attr.key, attr.key_len);
+      if (explorer->ns_binding_pending && priv_sxml_namespace_bind(explorer, attr.value, attr.value_len) != SXMLExplorerContinue) {
+        return SXMLExplorerErrorBufferOverflow;
+      }
+    }
+  }
+  return SXMLExplorerContinue;
+}
+
+SXMLNamespaceStack* priv_sxml_namespace_stack(SXMLExplorer* explorer) {
+  if (explorer->ns == NULL) {
+    explorer->ns = calloc(1, sizeof(SXMLNamespaceStack));
+  }
+  return explorer->ns;
+}
+
+unsigned char priv_sxml_namespace_transition(SXMLExplorer* explorer, SXMLExplorerState state) {
+  unsigned char ret = SXMLExplorerContinue;
+
+  if (priv_sxml_namespace_stack(explorer) == NULL) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  if (explorer->state == IN_TAG && (state == IN_CONTENT || state == IN_TAG || state == IN_ATTRIBUTE_KEY)) {
+    ret = priv_sxml_namespace_tag(explorer);
+  } else if (explorer->state == IN_ATTRIBUTE_KEY && state == IN_ATTRIBUTE_VALUE) {
+    const char* key = explorer->buffer;
+    while (priv_sxml_is_space(*key)) key++;
+    priv_sxml_namespace_prefix(explorer, key, strlen(key));
+  } else if (explorer->state == IN_ATTRIBUTE_VALUE && state == IN_TAG && explorer->ns_binding_pending) {
+    ret = priv_sxml_namespace_bind(explorer, explorer->buffer, explorer->bp);
+  }
+  if (ret != SXMLExplorerContinue) {
+    return ret;
+  }
+
+  // The start tag is complete: its own xmlns attributes are now in scope
+  if (explorer->ns_pending && state == IN_CONTENT &&
+      (explorer->state == IN_TAG || explorer->state == IN_ATTRIBUTE_KEY)) {
+    unsigned char self_closing = explorer->bp > 0 && explorer->buffer[explorer->bp - 1] == '/';
+    explorer->ns_pending = 0;
+    ret = priv_sxml_namespace_event(explorer, explorer->ns->element, explorer->ns_element_len, 0);
+    if (self_closing) {
+      if (ret == SXMLExplorerContinue || ret == SXMLExplorerSuspend) {
+        unsigned char end = priv_sxml_namespace_event(explorer, explorer->ns->element, explorer->ns_element_len, 1);
+        if (end != SXMLExplorerContinue) {
+          ret = end;
+        }
+      }
+      priv_sxml_namespace_pop(explorer);
+    }
+  }
+  return ret;
+}
+
+unsigned int sxml_resolve_prefix(SXMLExplorer* explorer, const char* prefix, unsigned int len) {
+  return priv_sxml_lookup_binding(explorer, prefix, len);
+}
+
+const char* sxml_namespace_uri(SXMLExplorer* explorer, unsigned int uri) {
+  if (uri >= explorer->symbol_count) {
+    return NULL;
+  }
+  return priv_sxml_symbol_name(explorer, uri);
+}
+
+// =============================================================================
+// XML PARSING: TEXT RUNS
+// =============================================================================
+
+// 0x80 in every byte of x that is zero, nothing elsewhere
+static unsigned long long priv_sxml_zero_bytes(unsigned long long x) {
+  const unsigned long long low = 0x7F7F7F7F7F7F7F7FULL;
+  return ~(((x & low) + low) | x | low);
+}
+
+// Whitespace-only test, eight bytes per step: each byte has to match one of
+// the four whitespace characters
+static unsigned char priv_sxml_blank_run(const char* text, unsigned int len) {
+  unsigned int i;
+
+  for (i = 0; i + 8 <= len; i += 8) {
+    unsigned long long word;
+    memcpy(&word, text + i, 8);
+    if ((priv_sxml_zero_bytes(word ^ 0x2020202020202020ULL) | priv_sxml_zero_bytes(word ^ 0x0A0A0A0A0A0A0A0AULL) |
+         priv_sxml_zero_bytes(word ^ 0x0909090909090909ULL) | priv_sxml_zero_bytes(word ^ 0x0D0D0D0D0D0D0D0DULL)) !=
+        0x8080808080808080ULL) {
+      return 0;
+    }
+  }
+  for (; i < len; i++) {
+    if (!priv_sxml_is_space(text[i])) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+// Text ends at a tag and a CDATA section where content resumes. With
+// coalescing, a run also ends at a comment, and at a CDATA section it may
+// not join (lazy entities), so no text is lost.
+static unsigned char priv_sxml_text_ends(SXMLExplorer* explorer, SXMLExplorerState state) {
+  if (explorer->state == IN_CDATA) {
+    return state == IN_CONTENT;
+  }
+  return explorer->state == IN_CONTENT &&
+         (state == IN_TAG || (explorer->text_coalescing && (state == IN_COMMENT || state == IN_CDATA)));
+}
+
+// With coalescing the run goes on across CDATA boundaries. Not with lazy
+// entities: sxml_text_needs_decoding() covers the whole run, and CDATA
+// bytes must never be decoded.
+static unsigned char priv_sxml_text_continues(SXMLExplorer* explorer, SXMLExplorerState state) {
+  return explorer->text_coalescing && !(explorer->enable_entity_processing && explorer->lazy_entities) &&
+         ((explorer->state == IN_CONTENT && state == IN_CDATA) || (explorer->state == IN_CDATA && state == IN_CONTENT));
+}
+
+// =============================================================================
+// XML PARSING: NAME SYMBOLS AND ELEMENT DISPATCH
+// =============================================================================
+
+static unsigned int priv_sxml_name_id(SXMLExplorer* explorer, const char* name, unsigned int len) {
+  if (explorer->name_interning) {
+    return priv_sxml_intern(explorer, name, len);
+  }
+  return priv_sxml_find_symbol(explorer, name, len);
+}
+
+static unsigned char priv_sxml_dispatch_name(SXMLExplorer* explorer, SXMLEventType type, unsigned int id, const char* name, unsigned int len) {
+  return priv_sxml_callback_result(explorer, explorer->name_func(explorer->name_user, type, id, (char*)name, len));
+}
+
+// Open elements are tracked while a name func, element handlers or the path
+// need them: a symbol id per level and, for the path, the names joined in a
+// fixed arena. The stack is allocated with the first element it tracks.
+// Nesting past the max depth or the arena fails the parse.
+SXMLElementStack* priv_sxml_element_stack(SXMLExplorer* explorer) {
+  if (explorer->elements == NULL) {
+    explorer->elements = calloc(1, sizeof(SXMLElementStack));
+  }
+  return explorer->elements;
+}
+
+static unsigned int priv_sxml_element_top(SXMLExplorer* explorer) {
+  if (explorer->element_depth == 0) {
+    return SXMLSymbolUnknown;
+  }
+  return explorer->elements->ids[explorer->element_depth - 1];
+}
+
+// Without a name func or the path only handler names matter: the first byte and the
+// length must match one of them before the name is hashed at all
+static unsigned int priv_sxml_element_id(SXMLExplorer* explorer, const char* name, unsigned int len) {
+  unsigned char first = (unsigned char)name[0];
+
+  if (explorer->name_func != NULL || explorer->element_path_enabled) {
+    return priv_sxml_name_id(explorer, name, len);
+  }
+  if (!(explorer->handler_lengths & (1u << (len < 31 ? len : 31))) ||
+      !(explorer->handler_first[first >> 5] & (1u << (first & 31)))) {
+    return SXMLSymbolUnknown;
+  }
+  return priv_sxml_find_symbol(explorer, name, len);
+}
+
+static unsigned char priv_sxml_dispatch_element(SXMLExplorer* explorer, unsigned int id, SXMLEventType type, const char* text, unsigned int len) {
+  const SXMLElementHandler* handler;
+
+  if (explorer->handlers == NULL || id >= SXMLSymbolCapacity || explorer->handlers->of[id] == 0) {
+    return SXMLExplorerContinue;
+  }
+  handler = &explorer->handlers->entries[explorer->handlers->of[id] - 1];
+  if (handler->func == NULL) {
+    return SXMLExplorerContinue;
+  }
+  return priv_sxml_callback_result(explorer, handler->func(handler->user, type, (char*)text, len));
+}
+
+// Batched attributes: the arena holds the tag name followed by each key and
+// value; spans are offsets so clones and snapshots stay valid mid-tag. The
+// batch is allocated with the first start tag collected.
+SXMLAttributeBatch* priv_sxml_attr_batch(SXMLExplorer* explorer) {
+  if (explorer->attrs == NULL) {
+    explorer->attrs = calloc(1, sizeof(SXMLAttributeBatch));
+  }
+  return explorer->attrs;
+}
+
+static unsigned char priv_sxml_attr_store(SXMLExplorer* explorer, const char* text, unsigned int len, unsigned short* offset) {
+  if (explorer->attr_arena_used + len + 1 > SXMLAttributeArenaLength || priv_sxml_attr_batch(explorer) == NULL) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  *offset = explorer->attr_arena_used;
+  memcpy(explorer->attrs->arena + explorer->attr_arena_used, text, len);
+  explorer->attrs->arena[explorer->attr_arena_used + len] = '\0';
+  explorer->attr_arena_used += len + 1;
+  return SXMLExplorerContinue;
+}
+
+static unsigned char priv_sxml_attr_key(SXMLExplorer* explorer, const char* key, unsigned int len) {
+  SXMLAttributeSpan* span;
+  unsigned short offset;
+
+  if (explorer->attr_count >= SXMLAttributeMax || priv_sxml_attr_store(explorer, key, len, &offset) != SXMLExplorerContinue) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  span = &explorer->attrs->spans[explorer->attr_count];
+  span->key = offset;
+  span->key_len = len;
+  span->value = span->key + len;  // The key's NUL until a value arrives
+  span->value_len = 0;
+  explorer->attr_count++;
+  return SXMLExplorerContinue;
+}
+
+static unsigned char priv_sxml_attr_value(SXMLExplorer* explorer, const char* value, unsigned int len) {
+  SXMLAttributeSpan* span;
+
+  if (explorer->attr_count == 0 || len == 0) {
+    return SXMLExplorerContinue;
+  }
+  span = &explorer->attrs->spans[explorer->attr_count - 1];
+  if (priv_sxml_attr_store(explorer, value, len, &span->value) != SXMLExplorerContinue) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  span->value_len = len;
+  return SXMLExplorerContinue;
+}
+
+static unsigned char priv_sxml_dispatch_start_element(SXMLExplorer* explorer) {
+  SXMLAttributeBatch* attrs = priv_sxml_attr_batch(explorer);
+  unsigned int name_len = explorer->attr_name_len;
+  unsigned int i;
+
+  if (attrs == NULL) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  for (i = 0; i < explorer->attr_count; i++) {
+    const SXMLAttributeSpan* span = &attrs->spans[i];
+    attrs->view[i].key = attrs->arena + span->key;
+    attrs->view[i].key_len = span->key_len;
+    attrs->view[i].value = attrs->arena + span->value;
+    attrs->view[i].value_len = span->value_len;
+  }
+  i = explorer->attr_count;
+  // The arena is released as a whole so a snapshot after the tag sees none of it
+  explorer->attr_count = 0;
+  explorer->attr_arena_used = 0;
+  explorer->attr_name_len = 0;
+  return priv_sxml_callback_result(explorer, explorer->start_element_func(explorer->start_element_user, attrs->arena,
+                                                                          name_len, attrs->view, i));
+}
+
+static unsigned char priv_sxml_element_start(SXMLExplorer* explorer, const char* name, unsigned int len) {
+  unsigned int id = priv_sxml_element_id(explorer, name, len);
+  unsigned int mark = explorer->element_path_len;
+  unsigned char ret = SXMLExplorerContinue;
+
+  if (explorer->element_depth >= explorer->element_max_depth || priv_sxml_element_stack(explorer) == NULL) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  if (explorer->element_path_enabled) {
+    if (mark + 1 + len >= SXMLElementPathLength) {
+      return SXMLExplorerErrorBufferOverflow;
+    }
+    if (mark > 0) {
+      explorer->elements->path[explorer->element_path_len++] = '/';
+    }
+    memcpy(explorer->elements->path + explorer->element_path_len, name, len);
+    explorer->element_path_len += len;
+    explorer->elements->path[explorer->element_path_len] = '\0';
+  }
+  explorer->elements->marks[explorer->element_depth] = mark;
+  explorer->elements->ids[explorer->element_depth++] = id;
+  explorer->element_open = 1;
+  if (explorer->start_element_func != NULL) {
+    unsigned short offset;
+    explorer->attr_count = 0;
+    explorer->attr_arena_used = 0;
+    explorer->attr_name_len = len;
+    if (priv_sxml_attr_store(explorer, name, len, &offset) != SXMLExplorerContinue) {
+      return SXMLExplorerErrorBufferOverflow;
+    }
+  }
+
+  if (explorer->name_func != NULL) {
+    ret = priv_sxml_dispatch_name(explorer, SXMLEventTag, id, name, len);
+  }
+  if (ret == SXMLExplorerContinue || ret == SXMLExplorerSuspend) {
+    unsigned char handler_ret = priv_sxml_dispatch_element(explorer, id, SXMLEventTag, name, len);
+    if (handler_ret != SXMLExplorerContinue) {
+      ret = handler_ret;
+    }
+  }
+  return ret;
+}
+
+// Ends the innermost element; empty elements pass no name and get the one
+// from the symbol table
+static unsigned char priv_sxml_element_end(SXMLExplorer* explorer, const char* name, unsigned int len) {
+  unsigned int id = priv_sxml_element_top(explorer);
+  unsigned char ret = SXMLExplorerContinue;
+
+  if (name == NULL) {
+    name = id < explorer->symbol_count ? priv_sxml_symbol_name(explorer, id) : "";
+    len = strlen(name);
+  }
+  if (explorer->element_depth > 0) {
+    explorer->element_path_len = explorer->elements->marks[--explorer->element_depth];
+    explorer->elements->path[explorer->element_path_len] = '\0';
+  }
+
+  if (explorer->name_func != NULL) {
+    ret = priv_sxml_dispatch_name(explorer, SXMLEventEndTag, id, name, len);
+  }
+  if (ret == SXMLExplorerContinue || ret == SXMLExplorerSuspend) {
+    unsigned char handler_ret = priv_sxml_dispatch_element(explorer, id, SXMLEventEndTag, name, len);
+    if (handler_ret != SXMLExplorerContinue) {
+      ret = handler_ret;
+    }
+  }
+  return ret;
+}
+
+// Same normalization as the namespace scopes: '<' of the first tag, stray
+// whitespace, '/' for end tags and a trailing '/' for empty elements
+unsigned char priv_sxml_element_transition(SXMLExplorer* explorer, SXMLExplorerState state) {
+  unsigned char ret = SXMLExplorerContinue;
+  const char* name = explorer->buffer;
+  unsigned int len = explorer->attr_region > 0 ? explorer->attr_region : explorer->bp;
+
+  if (explorer->state == IN_TAG && (state == IN_CONTENT || state == IN_TAG || state == IN_ATTRIBUTE_KEY)) {
+    while (len > 0 && (*name == '<' || priv_sxml_is_space(*name))) {
+      name++;
+      len--;
+    }
+    while (len > 0 && priv_sxml_is_space(name[len - 1])) {
+      len--;
+    }
+    if (len > 1 && name[0] == '/') {
+      ret = priv_sxml_element_end(explorer, name + 1, len - 1);
+    } else if (len > 0 && name[0] != '/' && !explorer->element_open) {
+      if (name[len - 1] == '/') {
+        len--;
+      }
+      ret = priv_sxml_element_start(explorer, name, len);
+    }
+  } else if (explorer->state == IN_ATTRIBUTE_KEY && state == IN_ATTRIBUTE_VALUE) {
+    while (len > 0 && priv_sxml_is_space(*name)) {
+      name++;
+      len--;
+    }
+    if (len > 0 && explorer->name_func != NULL) {
+      ret = priv_sxml_dispatch_name(explorer, SXMLEventAttributeKey, priv_sxml_name_id(explorer, name, len), name, len);
+    }
+    if (len > 0 && explorer->element_open && (ret == SXMLExplorerContinue || ret == SXMLExplorerSuspend)) {
+      unsigned char handler_ret = priv_sxml_dispatch_element(explorer, priv_sxml_element_top(explorer), SXMLEventAttributeKey, name, len);
+      if (handler_ret != SXMLExplorerContinue) {
+        ret = handler_ret;
+      }
+    }
+    if (len > 0 && explorer->element_open && explorer->start_element_func != NULL &&
+        (ret == SXMLExplorerContinue || ret == SXMLExplorerSuspend) &&
+        priv_sxml_attr_key(explorer, name, len) != SXMLExplorerContinue) {
+      ret = SXMLExplorerErrorBufferOverflow;
+    }
+  } else if (explorer->state == IN_ATTRIBUTE_VALUE && state == IN_TAG && explorer->element_open) {
+    if (len > 0) {
+      ret = priv_sxml_dispatch_element(explorer, priv_sxml_element_top(explorer), SXMLEventAttributeValue, name, len);
+    }
+    if (explorer->start_element_func != NULL && (ret == SXMLExplorerContinue || ret == SXMLExplorerSuspend) &&
+        priv_sxml_attr_value(explorer, name, len) != SXMLExplorerContinue) {
+      ret = SXMLExplorerErrorBufferOverflow;
+    }
+  } else if (len > 0 && priv_sxml_text_ends(explorer, state)) {
+    ret = priv_sxml_dispatch_element(explorer, priv_sxml_element_top(explorer), SXMLEventContent, name, len);
+  }
+  if (ret != SXMLExplorerContinue && ret != SXMLExplorerSuspend) {
+    return ret;
+  }
+
+  // The start tag is complete; empty elements end with it
+  if (explorer->element_open && state == IN_CONTENT &&
+      (explorer->state == IN_TAG || explorer->state == IN_ATTRIBUTE_KEY)) {
+    explorer->element_open = 0;
+    if (explorer->start_element_func != NULL) {
+      unsigned int region_len, cursor = 0;
+      const char* region = sxml_attr_region(explorer, &region_len);
+      unsigned char start;
+      SXMLAttribute attr;
+      // Lazy attributes: the batch is cut from the raw section, values raw
+      while (region != NULL && priv_sxml_next_attribute(region, region_len, &cursor, &attr)) {
+        if (priv_sxml_attr_key(explorer, attr.key, attr.key_len) != SXMLExplorerContinue ||
+            priv_sxml_attr_value(explorer, attr.value, attr.value_len) != SXMLExplorerContinue) {
+          return SXMLExplorerErrorBufferOverflow;
+        }
+      }
+      start = priv_sxml_dispatch_start_element(explorer);
+      if (start != SXMLExplorerContinue) {
+        ret = start;
+      }
+      if (ret != SXMLExplorerContinue && ret != SXMLExplorerSuspend) {
+        return ret;
+      }
+    }
+    if (explorer->bp > 0 && explorer->buffer[explorer->bp - 1] == '/') {
+      unsigned char end = priv_sxml_element_end(explorer, NULL, 0);
+      if (end != SXMLExplorerContinue) {
+        ret = end;
+      }
+    }
+  }
+  return ret;
+}
+
+// Opens an element that has no start tag in the input, for the context a
+// shard starts in: the element layers see it start as in the whole document,
+// with the same symbol lookup and no attributes
+unsigned char priv_sxml_element_enter(SXMLExplorer* explorer, const char* name, unsigned int len) {
+  unsigned char ret;
+
+  if (explorer->name_func == NULL && explorer->handler_count == 0 && !explorer->element_path_enabled &&
+      explorer->start_element_func == NULL) {
+    return SXMLExplorerContinue;
+  }
+  explorer->element_replay = 1;
+  ret = priv_sxml_element_start(explorer, name, len);
+  explorer->element_open = 0;
+  if (explorer->start_element_func != NULL && (ret == SXMLExplorerContinue || ret == SXMLExplorerSuspend)) {
+    unsigned char start = priv_sxml_dispatch_start_element(explorer);
+    if (start != SXMLExplorerContinue) {
+      ret = start;
+    }
+  }
+  explorer->element_replay = 0;
+  return ret;
+}
+
+// Names compile into the symbol table; the hot path is a length and
+// first-byte filter, one hash probe and an index into handlers[]
+unsigned char sxml_on_element(SXMLExplorer* explorer, const char* name, void* func, void* user) {
+  unsigned int len = strlen(name);
+  unsigned int id = priv_sxml_intern(explorer, name, len);
+  unsigned char first = (unsigned char)name[0];
+  SXMLElementHandler* handler;
+
+  if (id == SXMLSymbolUnknown || len == 0) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  if (explorer->handlers == NULL && (explorer->handlers = calloc(1, sizeof(SXMLHandlerTable))) == NULL) {
+    return SXMLExplorerErrorBufferOverflow;
+  }
+  if (explorer->handlers->of[id] == 0) {
+    if (explorer->handler_count >= SXMLElementHandlers) {
+      return SXMLExplorerErrorBufferOverflow;
+    }
+    explorer->handlers->of[id] = ++explorer->handler_count;
+    explorer->handler_lengths |= 1u << (len < 31 ? len : 31);
+    explorer->handler_first[first >> 5] |= 1u << (first & 31);
+  }
+  handler = &explorer->handlers->entries[explorer->handlers->of[id] - 1];
+  handler->func = func;
+  handler->user = user;
+  handler->id = id;
+  return SXMLExplorerContinue;
+}
+
+unsigned int sxml_register_name(SXMLExplorer* explorer, const char* name) {
+  return priv_sxml_intern(explorer, name, strlen(name));
+}
+
+const char* sxml_name(SXMLExplorer* explorer, unsigned int id) {
+  if (id >= explorer->symbol_count) {
+    return NULL;
+  }
+  return priv_sxml_symbol_name(explorer, id);
+}
+
+void sxml_enable_element_path(SXMLExplorer* explorer, unsigned char enable) {
+  explorer->element_path_enabled = enable;
+}
+
+void sxml_set_max_depth(SXMLExplorer* explorer, unsigned int depth) {
+  explorer->element_max_depth = depth == 0 || depth > SXMLElementMaxDepth ? SXMLElementMaxDepth : depth;
+}
+
+unsigned int sxml_element_depth(SXMLExplorer* explorer) {
+  return explorer->element_depth;
+}
+
+unsigned int sxml_element_at(SXMLExplorer* explorer, unsigned int level) {
+  if (level >= explorer->element_depth) {
+    return SXMLNameUnknown;
+  }
+  return explorer->elements->ids[level];
+}
+
+const char* sxml_element_path(SXMLExplorer* explorer, unsigned int* len) {
+  if (len != NULL) {
+    *len = explorer->element_path_len;
+  }
+  return explorer->elements != NULL ? explorer->elements->path : "";
+}
+
+// =============================================================================
+// XML PARSING: LAZY ATTRIBUTES
+// =============================================================================
+
+// One attribute from region[*cursor, len): key, optional whitespace, '=',
+// then a single- or double-quoted value. Stops at '/', the end or anything
+// malformed.
+unsigned char priv_sxml_next_attribute(const char* region, unsigned int len, unsigned int* cursor, SXMLAttribute* out) {
+  unsigned int i = *cursor;
+  unsigned int key;
+  char quote;
+
+  while (i < len && priv_sxml_is_space(region[i])) i++;
+  key = i;
+  while (i < len && region[i] != '=' && region[i] != '/' && !priv_sxml_is_space(region[i])) i++;
+  if (i == key) {
+    return 0;
+  }
+  out->key = region + key;
+  out->key_len = i - key;
+  while (i < len && priv_sxml_is_space(region[i])) i++;
+  if (i >= len || region[i] != '=') {
+    return 0;
+  }
+  i++;
+  while (i < len && priv_sxml_is_space(region[i])) i++;
+  if (i >= len || (region[i] != '"' && region[i] != '\'')) {
+    return 0;
+  }
+  quote = region[i++];
+  out->value = region + i;
+  while (i < len && region[i] != quote) i++;
+  if (i >= len) {
+    return 0;
+  }
+  out->value_len = region + i - out->value;
+  *cursor = i + 1;
+  return 1;
+}
+
+void sxml_enable_lazy_attributes(SXMLExplorer* explorer, unsigned char enable) {
+  explorer->lazy_attributes = enable;
+}
+
+const char* sxml_attr_region(SXMLExplorer* explorer, unsigned int* len) {
+  unsigned int end = explorer->bp;
+
+  if (explorer->attr_region == 0 || explorer->bp <= explorer->attr_region) {
+    if (len != NULL) {
+      *len = 0;
+    }
+    return NULL;
+  }
+  if (explorer->buffer[end - 1] == '/') {
+    end--;
+  }
+  if (len != NULL) {
+    *len = end - explorer->attr_region - 1;
+  }
+  return explorer->buffer + explorer->attr_region + 1;
+}
+
+unsigned char sxml_attr_next(SXMLExplorer* explorer, unsigned int* cursor, SXMLAttribute* out) {
+  unsigned int len;
+  const char* region = sxml_attr_region(explorer, &len);
+
+  if (region == NULL) {
+    return 0;
+  }
+  return priv_sxml_next_attribute(region, len, cursor, out);
+}
+
+unsigned char sxml_attr_find(SXMLExplorer* explorer, const char* name, SXMLAttribute* out) {
+  unsigned int cursor = 0;
+  unsigned int len = strlen(name);
+
+  while (sxml_attr_next(explorer, &cursor, out)) {
+    if (out->key_len == len && memcmp(out->key, name, len) == 0) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// =============================================================================
+// XML PARSING: BASE64 CONTENT
+// =============================================================================
+
+#define SXMLBase64Space 0x40
+#define SXMLBase64Pad 0x41
+
+// Sextet per byte; whitespace and '=' are marked, everything else is 0xFF
+static const unsigned char priv_sxml_base64_table[256] = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x40, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+  0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF,
+  0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+  0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+  0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+// Hands the decoded block to the base64 func
+static unsigned char priv_sxml_base64_flush(SXMLExplorer* explorer, unsigned char* out, unsigned int* used) {
+  unsigned char ret = SXMLExplorerContinue;
+  if (*used > 0 && explorer->base64_func != NULL) {
+    ret = priv_sxml_callback_result(explorer, explorer->base64_func(explorer->base64_user, out, *used));
+  }
+  *used = 0;
+  return ret;
+}
+
+// A partial quantum of two or three sextets holds one or two bytes; a
+// single sextet cannot be decoded
+static unsigned char priv_sxml_base64_tail(SXMLExplorer* explorer, unsigned char* out, unsigned int* used) {
+  unsigned int bits = explorer->base64_bits;
+
+  switch (explorer->base64_count) {
+    case 1:
+      return 0;
+    case 2:
+      out[(*used)++] = (unsigned char)(bits >> 4);
+      break;
+    case 3:
+      out[(*used)++] = (unsigned char)(bits >> 10);
+      out[(*used)++] = (unsigned char)(bits >> 2);
+      break;
+  }
+  explorer->base64_count = 0;
+  explorer->base64_bits = 0;
+  return 1;
+}
+
+// Decodes the text from *at up to the next '<' (or the end of input or of
+// the byte budget) and leaves *at on the last byte consumed, or on the
+// offending one after an error. While the quantum is aligned eight
+// characters go through the table at once; whitespace, padding and
+// quanta split by line ends take the byte path.
+static unsigned char priv_sxml_base64_run(SXMLExplorer* explorer, char** at, char* limit) {
+  const unsigned char* table = priv_sxml_base64_table;
+  const unsigned char* in = (const unsigned char*)*at;
+  const unsigned char* end;
+  unsigned char out[SXMLBase64BlockLength];
+  unsigned int used = 0;
+  unsigned char ret = SXMLExplorerContinue;
+
+  // The text ends at '<', the end of input or the byte budget; nothing past
+  // the budget is read
+  if (limit == NULL) {
+    end = in + strcspn(*at, "<");
+  } else {
+    size_t len = strnlen(*at, limit - *at);
+    const char* tag = memchr(*at, '<', len);
+    end = (const unsigned char*)(tag != NULL ? tag : *at + len);
+  }
+  while (in < end && ret == SXMLExplorerContinue) {
+    unsigned char v;
+    if (used + 6 > SXMLBase64BlockLength) {
+      ret = priv_sxml_base64_flush(explorer, out, &used);
+      continue;
+    }
+    if (explorer->base64_count == 0 && end - in >= 8 && !explorer->base64_pad) {
+      unsigned int a = table[in[0]], b = table[in[1]], c = table[in[2]], d = table[in[3]];
+      unsigned int e = table[in[4]], f = table[in[5]], g = table[in[6]], h = table[in[7]];
+      if (((a | b | c | d | e | f | g | h) & 0xC0) == 0) {
+        unsigned int first = a << 18 | b << 12 | c << 6 | d;
+        unsigned int second = e << 18 | f << 12 | g << 6 | h;
+        out[used] = (unsigned char)(first >> 16);
+        out[used + 1] = (unsigned char)(first >> 8);
+        out[used + 2] = (unsigned char)first;
+        out[used + 3] = (unsigned char)(second >> 16);
+        out[used + 4] = (unsigned char)(second >> 8);
+        out[used + 5] = (unsigned char)second;
+        used += 6;
+        in += 8;
+        continue;
+      }
+    }
+    v = table[*in];
+    if (v < 64 && !explorer->base64_pad) {
+      explorer->base64_bits = explorer->base64_bits << 6 | v;
+      if (++explorer->base64_count == 4) {
+        out[used] = (unsigned char)(explorer->base64_bits >> 16);
+        out[used + 1] = (unsigned char)(explorer->base64_bits >> 8);
+        out[used + 2] = (unsigned char)explorer->base64_bits;
+        used += 3;
+        explorer->base64_count = 0;
+        explorer->base64_bits = 0;
+      }
+    } else if (v == SXMLBase64Pad && (explorer->base64_pad || explorer->base64_count >= 2)) {
+      priv_sxml_base64_tail(explorer, out, &used);
+      explorer->base64_pad = 1;
+    } else if (v != SXMLBase64Space) {
+      *at = (char*)in;
+      return SXMLExplorerErrorMalformedXML;
+    }
+    in++;
+  }
+  if (ret == SXMLExplorerContinue) {
+    ret = priv_sxml_base64_flush(explorer, out, &used);
+  }
+  *at = (char*)in - 1;
+  return ret;
+}
+
+// Ends the element's text when the content state is left
+static unsigned char priv_sxml_base64_end(SXMLExplorer* explorer) {
+  unsigned char out[2];
+  unsigned int used = 0;
+
+  explorer->base64 = 0;
+  explorer->base64_pad = 0;
+  if (!priv_sxml_base64_tail(explorer, out, &used)) {
+    return SXMLExplorerErrorMalformedXML;
+  }
+  return priv_sxml_base64_flush(explorer, out, &used);
+}
+
+void sxml_register_base64_func(SXMLExplorer* explorer, void* func, void* user) {
+  explorer->base64_func = func;
+  explorer->base64_user = user;
+}
+
+// =============================================================================
+// XML PARSING: STATE MANAGEMENT
+// =============================================================================
+
+// Skip and Base64 are remembered for the start tag being read and otherwise
+// mean Continue
+unsigned char priv_sxml_callback_result(SXMLExplorer* explorer, unsigned char ret) {
+  if (ret != SXMLExplorerSkip && ret != SXMLExplorerBase64) {
+    return ret;
+  }
+  if (explorer->state == IN_TAG || explorer->state == IN_ATTRIBUTE_KEY || explorer->state == IN_ATTRIBUTE_VALUE) {
+    if (ret == SXMLExplorerSkip) {
+      explorer->skip_pending = 1;
+    } else {
+      explorer->base64_pending = 1;
     }
-    return SXMLExplorerErrorInvalidEntity;
   }
-
-  return priv_append_char(explorer, replacement);
+  return SXMLExplorerContinue;
 }
 
-unsigned char priv_sxml_process_numeric_entity(SXMLExplorer* explorer, char* entity_buffer) {
-  unsigned int codepoint = 0;
-  char* end_ptr;
-  
-  if (entity_buffer[1] == 'x' || entity_buffer[1] == 'X') {
-    // Hexadecimal: &#xAB; or &#XAB;
-    codepoint = strtoul(entity_buffer + 2, &end_ptr, 16);
-  } else {
-    // Decimal: &#123;
-    codepoint = strtoul(entity_buffer + 1, &end_ptr, 10);
+unsigned char priv_sxml_dispatch_event(SXMLExplorer* explorer, SXMLEventType type, char* text) {
+  unsigned char ret = SXMLExplorerContinue;
+  unsigned char (*func)(char *) = NULL;
+
+  if (explorer->event_func != NULL) {
+    ret = priv_sxml_callback_result(explorer, explorer->event_func(explorer->event_user, type, text, strlen(text)));
+    // On Suspend the event is still complete: the per-type func gets it and
+    // it counts against the budget, so nothing is owed on resume
+    if (ret != SXMLExplorerContinue && ret != SXMLExplorerSuspend) {
+      return ret;
+    }
   }
-  
-  // Basic ASCII range check for embedded systems
-  if (codepoint == 0 || codepoint > 127) {
-    return SXMLExplorerErrorInvalidEntity;
+
+  switch (type) {
+    case SXMLEventTag: func = explorer->tag_func; break;
+    case SXMLEventContent: func = explorer->content_func; break;
+    case SXMLEventAttributeKey: func = explorer->attribute_key_func; break;
+    case SXMLEventAttributeValue: func = explorer->attribute_value_func; break;
+    case SXMLEventComment: func = explorer->comment_func; break;
+    case SXMLEventEndTag: break;
   }
-  
-  return priv_append_char(explorer, (char)codepoint);
+  if (func != NULL) {
+    unsigned char func_ret = priv_sxml_callback_result(explorer, func(text));
+    if (func_ret != SXMLExplorerContinue) {
+      ret = func_ret;
+    }
+  }
+  if (explorer->event_budget > 0 && --explorer->event_budget == 0 && ret == SXMLExplorerContinue) {
+    ret = SXMLExplorerSuspend;
+  }
+  return ret;
 }
 
-unsigned char priv_sxml_process_extended_entity(SXMLExplorer* explorer, char* entity_buffer) {
-  // Common HTML entities (keeping it minimal for embedded systems)
-  char replacement = '\0';
-  
-  if (strcmp(entity_buffer, "nbsp") == 0) {
-    replacement = ' ';  // Non-breaking space -> regular space
-  } else if (strcmp(entity_buffer, "copy") == 0) {
-    // For embedded systems, replace with simple text
-    const char* copyright_text = "(c)";
-    return priv_append_string(explorer, copyright_text);
-  } else if (strcmp(entity_buffer, "reg") == 0) {
-    const char* reg_text = "(R)";
-    return priv_append_string(explorer, reg_text);
-  } else if (strcmp(entity_buffer, "trade") == 0) {
-    const char* trade_text = "(TM)";
-    return priv_append_string(explorer, trade_text);
-  } else if (strcmp(entity_buffer, "euro") == 0) {
-    replacement = 'E';  // Euro symbol -> E for ASCII compatibility
-  } else if (strcmp(entity_buffer, "pound") == 0) {
-    replacement = '#';  // Pound symbol -> # for ASCII compatibility
-  } else {
-    return SXMLExplorerErrorInvalidEntity;
+// The first section of a tag tells start tags from end tags; when a start
+// tag that asked for Skip completes without '/', its subtree is skipped,
+// and when it asked for Base64 its text is decoded
+static void priv_sxml_skip_transition(SXMLExplorer* explorer, SXMLExplorerState state) {
+  if (explorer->state == IN_TAG && !explorer->start_tag_open && explorer->bp > 0) {
+    const char* name = explorer->buffer;
+    while (*name == '<' || priv_sxml_is_space(*name)) {
+      name++;
+    }
+    explorer->start_tag_open = *name != '\0' && *name != '/' && *name != '?' && *name != '!';
   }
-  
-  if (replacement != '\0') {
-    return priv_append_char(explorer, replacement);
+  if (state != IN_CONTENT) {
+    return;
   }
-
-  return SXMLExplorerContinue;
+  if (explorer->start_tag_open && (explorer->bp == 0 || explorer->buffer[explorer->bp - 1] != '/')) {
+    if (explorer->skip_pending) {
+      explorer->skip_depth = 1;
+      explorer->skip_mode = SXMLSkipContent;
+    } else if (explorer->base64_pending) {
+      explorer->base64 = 1;
+    }
+  }
+  explorer->start_tag_open = 0;
+  explorer->skip_pending = 0;
+  explorer->base64_pending = 0;
 }
 
-// =============================================================================
-// XML PARSING: STATE MANAGEMENT
-// =============================================================================
-
 unsigned char priv_sxml_change_explorer_state(SXMLExplorer* explorer, SXMLExplorerState state) {
   unsigned char ret = SXMLExplorerContinue;
 
+  if (explorer->base64 && explorer->state == IN_CONTENT) {
+    ret = priv_sxml_base64_end(explorer);
+  }
+
+  if (explorer->bp > 0 && priv_sxml_text_continues(explorer, state)) {
+    explorer->state = state;  // The buffer keeps the run
+    return ret;
+  }
+  if (explorer->bp > 0 && explorer->whitespace_skip && priv_sxml_text_ends(explorer, state) &&
+      priv_sxml_blank_run(explorer->buffer, explorer->bp)) {
+    explorer->bp = 0;
+    explorer->buffer[0] = '\0';
+  }
+
   if (explorer->bp > 0) {
-    if (explorer->state == IN_TAG && (state == IN_CONTENT || state == IN_TAG || state == IN_ATTRIBUTE_KEY) && explorer->tag_func != NULL) {
+    if (explorer->state == IN_TAG && (state == IN_CONTENT || state == IN_TAG || state == IN_ATTRIBUTE_KEY)) {
+      unsigned int name_len = explorer->bp;
+      if (explorer->attr_region > 0) {
+        // Lazy attributes: the name ends where the raw section starts
+        name_len = explorer->attr_region;
+        explorer->buffer[name_len] = '\0';
+      }
       if (explorer->enable_namespace_processing) {
-        char* namespace_uri = NULL;
-        char* local_name = NULL;
-        char tag_copy[SXMLElementLength];
-        strcpy(tag_copy, explorer->buffer);
-        priv_sxml_process_namespace(tag_copy, &namespace_uri, &local_name);
-        // For simplicity, we pass the local name for now
-        ret = explorer->tag_func(local_name ? local_name : explorer->buffer);
+        // Tag callbacks get the local name, a view into the buffer
+        char* colon = memchr(explorer->buffer, ':', name_len);
+        ret = priv_sxml_dispatch_event(explorer, SXMLEventTag, colon != NULL ? colon + 1 : explorer->buffer);
       } else {
-        ret = explorer->tag_func(explorer->buffer);
+        ret = priv_sxml_dispatch_event(explorer, SXMLEventTag, explorer->buffer);
+      }
+      // <a x="1"/> reports "/" after the name, as with eager attributes
+      if (explorer->attr_region > 0 && explorer->buffer[explorer->bp - 1] == '/' &&
+          (ret == SXMLExplorerContinue || ret == SXMLExplorerSuspend)) {
+        unsigned char end = priv_sxml_dispatch_event(explorer, SXMLEventTag, explorer->buffer + explorer->bp - 1);
+        if (end != SXMLExplorerContinue) {
+          ret = end;
+        }
       }
-    } else if (explorer->state == IN_CONTENT && state == IN_TAG && explorer->content_func != NULL) {
-      ret = explorer->content_func(explorer->buffer);
-    } else if (explorer->state == IN_ATTRIBUTE_KEY && state == IN_ATTRIBUTE_VALUE && explorer->attribute_key_func != NULL) {
-      ret = explorer->attribute_key_func(explorer->buffer);
-    } else if (explorer->state == IN_ATTRIBUTE_VALUE && state == IN_TAG && explorer->attribute_value_func != NULL) {
-      ret = explorer->attribute_value_func(explorer->buffer);
-    } else if (explorer->state == IN_COMMENT && state == IN_CONTENT && explorer->comment_func != NULL) {
-      ret = explorer->comment_func(explorer->buffer);
-    } else if (explorer->state == IN_CDATA && state == IN_CONTENT && explorer->content_func != NULL) {
-      ret = explorer->content_func(explorer->buffer);
+    } else if (priv_sxml_text_ends(explorer, state)) {
+      ret = priv_sxml_dispatch_event(explorer, SXMLEventContent, explorer->buffer);
+    } else if (explorer->state == IN_ATTRIBUTE_KEY && state == IN_ATTRIBUTE_VALUE) {
+      ret = priv_sxml_dispatch_event(explorer, SXMLEventAttributeKey, explorer->buffer);
+    } else if (explorer->state == IN_ATTRIBUTE_VALUE && state == IN_TAG) {
+      ret = priv_sxml_dispatch_event(explorer, SXMLEventAttributeValue, explorer->buffer);
+    } else if (explorer->state == IN_COMMENT && state == IN_CONTENT) {
+      ret = priv_sxml_dispatch_event(explorer, SXMLEventComment, explorer->buffer);
+    }
+  }
+
+  if (explorer->enable_namespace_processing && (ret == SXMLExplorerContinue || ret == SXMLExplorerSuspend)) {
+    unsigned char ns_ret = priv_sxml_namespace_transition(explorer, state);
+    if (ns_ret != SXMLExplorerContinue) {
+      ret = ns_ret;
+    }
+  }
+
+  if ((explorer->name_func != NULL || explorer->handler_count > 0 || explorer->element_path_enabled ||
+       explorer->start_element_func != NULL) &&
+      (ret == SXMLExplorerContinue || ret == SXMLExplorerSuspend)) {
+    unsigned char element_ret = priv_sxml_element_transition(explorer, state);
+    if (element_ret != SXMLExplorerContinue) {
+      ret = element_ret;
     }
   }
 
+  if (explorer->state == IN_TAG || explorer->state == IN_ATTRIBUTE_KEY) {
+    priv_sxml_skip_transition(explorer, state);
+  }
+
   explorer->bp = 0;
   explorer->buffer[0] = '\0';
+  explorer->text_has_entities = 0;
+  explorer->attr_region = 0;
 
   explorer->state = state;
 
@@ -231,14 +2183,125 @@ unsigned char priv_sxml_change_explorer_state(SXMLExplorer* explorer, SXMLExplor
 // =============================================================================
 
 unsigned char sxml_run_explorer(SXMLExplorer* explorer, char *xml) {
+  return sxml_run_explorer_budget(explorer, xml, 0, 0);
+}
+
+// Tag scan: next byte from stop (or the end of input), clamped to the run's
+// byte budget. strcspn is vectorized by common C libraries.
+static char* priv_sxml_skip_to(char* xml, const char* stop, char* limit) {
+  char* next = xml + strcspn(xml, stop);
+  return limit != NULL && next > limit ? limit : next;
+}
+
+// Skip: consumes the byte at *at, jumping ahead to the last byte that cannot
+// change the depth. Returns 1 with *at on the '/' of the matching end tag.
+static unsigned char priv_sxml_skip_subtree(SXMLExplorer* explorer, char** at, char* limit) {
+  char* xml = *at;
+  char stop[2];
+
+  switch (explorer->skip_mode) {
+    case SXMLSkipContent:
+      if (*xml == '<') {
+        explorer->skip_mode = SXMLSkipOpen;
+      } else {
+        *at = priv_sxml_skip_to(xml, "<", limit) - 1;
+      }
+      break;
+    case SXMLSkipOpen:
+      explorer->skip_last = '\0';
+      if (*xml == '/') {
+        if (--explorer->skip_depth == 0) {
+          explorer->skip_mode = SXMLSkipContent;
+          return 1;
+        }
+        explorer->skip_mode = SXMLSkipTag;
+      } else if (*xml == '!') {
+        explorer->skip_mode = SXMLSkipBang;
+      } else if (*xml == '?') {
+        explorer->skip_mode = SXMLSkipInstruction;
+      } else {
+        explorer->skip_depth++;
+        explorer->skip_mode = SXMLSkipTag;
+        explorer->skip_last = *xml;
+      }
+      break;
+    case SXMLSkipTag:
+      if (*xml == '"' || *xml == '\'') {
+        explorer->skip_last = *xml;
+        explorer->skip_mode = SXMLSkipQuote;
+      } else if (*xml == '>') {
+        // <a/> opened nothing
+        if (explorer->skip_last == '/') {
+          explorer->skip_depth--;
+        }
+        explorer->skip_mode = SXMLSkipContent;
+      } else if (!priv_sxml_is_space(*xml)) {
+        explorer->skip_last = *xml;
+      }
+      break;
+    case SXMLSkipQuote:
+      if (*xml == explorer->skip_last) {
+        explorer->skip_mode = SXMLSkipTag;
+      } else {
+        stop[0] = explorer->skip_last;
+        stop[1] = '\0';
+        *at = priv_sxml_skip_to(xml, stop, limit) - 1;
+      }
+      break;
+    case SXMLSkipBang:
+      explorer->skip_count = 0;
+      explorer->skip_mode = *xml == '-' ? SXMLSkipCommentOpen : *xml == '[' ? SXMLSkipCData : SXMLSkipTag;
+      break;
+    case SXMLSkipCommentOpen:
+      explorer->skip_mode = SXMLSkipComment;
+      break;
+    case SXMLSkipComment:
+    case SXMLSkipCData:
+      stop[0] = explorer->skip_mode == SXMLSkipComment ? '-' : ']';
+      stop[1] = '\0';
+      if (*xml == stop[0]) {
+        explorer->skip_count++;
+      } else if (*xml == '>' && explorer->skip_count >= 2) {
+        explorer->skip_mode = SXMLSkipContent;
+      } else {
+        explorer->skip_count = 0;
+        *at = priv_sxml_skip_to(xml, stop, limit) - 1;
+      }
+      break;
+    case SXMLSkipInstruction:
+      if (*xml == '>' && explorer->skip_last == '?') {
+        explorer->skip_mode = SXMLSkipContent;
+      }
+      explorer->skip_last = *xml;
+      break;
+  }
+  return 0;
+}
+
+unsigned char sxml_run_explorer_budget(SXMLExplorer* explorer, char *xml, unsigned long max_bytes, unsigned int max_events) {
 
   unsigned char result = SXMLExplorerContinue;
+  char* start = xml;
+  char* limit = max_bytes > 0 ? xml + max_bytes : NULL;
 
-  do {
+  // Nothing left to read: a resume after the last byte finishes the run
+  if (*xml == '\0') {
+    explorer->consumed = 0;
+    return SXMLExplorerComplete;
+  }
+
+  explorer->event_budget = max_events;
 
+  do {
 
     switch (explorer->state) {
       case INITIAL:
+        // Documents without an XML declaration may open with a DOCTYPE
+        if (*xml == '<' && *(xml+1) == '!' && strncmp(xml+2, "DOCTYPE", 7) == 0) {
+          result = priv_sxml_change_explorer_state(explorer, IN_DOCTYPE);
+          xml += 8; // Skip '!DOCTYPE'
+          continue;
+        }
         switch (*xml) {
           default:
             result = priv_sxml_change_explorer_state(explorer, IN_TAG);
@@ -255,11 +2318,31 @@ unsigned char sxml_run_explorer(SXMLExplorer* explorer, char *xml) {
         }
         break;
       case IN_TAG:
+        // Lazy attributes: everything up to the closing '>' stays raw
+        if (explorer->attr_region > 0) {
+          if (explorer->attr_quote != '\0') {
+            if (*xml == explorer->attr_quote) {
+              explorer->attr_quote = '\0';
+            }
+            break;
+          }
+          if (*xml == '"' || *xml == '\'') {
+            explorer->attr_quote = *xml;
+            break;
+          }
+          if (*xml != '>') {
+            break;
+          }
+        }
         switch (*xml) {
           case '>':
             result =  priv_sxml_change_explorer_state(explorer, IN_CONTENT);
             continue;
           case ' ':
+            if (explorer->lazy_attributes && explorer->bp > 0 && explorer->buffer[0] != '/') {
+              explorer->attr_region = explorer->bp;
+              break;
+            }
             result = priv_sxml_change_explorer_state(explorer, IN_ATTRIBUTE_KEY);
             continue;
           case '?':
@@ -289,6 +2372,10 @@ unsigned char sxml_run_explorer(SXMLExplorer* explorer, char *xml) {
             result = priv_sxml_change_explorer_state(explorer, IN_TAG);
             continue;
           case '&':
+            if (explorer->enable_entity_processing && explorer->lazy_entities) {
+              explorer->text_has_entities = 1;  // Delivered raw, see sxml_decode_entities
+              break;
+            }
             if (explorer->enable_entity_processing) {
               explorer->prev_state = explorer->state;
               explorer->state = IN_ENTITY;
@@ -300,6 +2387,25 @@ unsigned char sxml_run_explorer(SXMLExplorer* explorer, char *xml) {
         }
         break;
       case IN_CONTENT:
+        if (explorer->skip_depth > 0) {
+          if (!priv_sxml_skip_subtree(explorer, &xml, limit)) {
+            continue;
+          }
+          // The matching end tag is parsed as usual from its '/'
+          result = priv_sxml_change_explorer_state(explorer, IN_TAG);
+          break;
+        }
+        if (explorer->base64 && *xml != '<') {
+          result = priv_sxml_base64_run(explorer, &xml, limit);
+          if (result >= SXMLExplorerErrorInvalidEntity && result <= SXMLExplorerErrorMalformedXML) {
+            break;  // Aborts at the offending byte below
+          }
+          continue;
+        }
+        if (explorer->tag_scan && *xml != '<') {
+          xml = priv_sxml_skip_to(xml, "<", limit) - 1;
+          continue;
+        }
         switch (*xml) {
           case '<':
             // Check for comment start: <!--
@@ -324,6 +2430,10 @@ unsigned char sxml_run_explorer(SXMLExplorer* explorer, char *xml) {
             result = priv_sxml_change_explorer_state(explorer, IN_TAG);
             continue;
           case '&':
+            if (explorer->enable_entity_processing && explorer->lazy_entities) {
+              explorer->text_has_entities = 1;  // Delivered raw, see sxml_decode_entities
+              break;
+            }
             if (explorer->enable_entity_processing) {
               explorer->prev_state = explorer->state;
               explorer->state = IN_ENTITY;
@@ -335,20 +2445,34 @@ unsigned char sxml_run_explorer(SXMLExplorer* explorer, char *xml) {
         }
         break;
       case IN_COMMENT:
+        if (explorer->tag_scan && *xml != '-') {
+          xml = priv_sxml_skip_to(xml, "-", limit) - 1;
+          continue;
+        }
         // Look for comment end: -->
         if (*xml == '-' && *(xml+1) == '-' && *(xml+2) == '>') {
           result = priv_sxml_change_explorer_state(explorer, IN_CONTENT);
           xml += 2; // Skip '-->', the '>' will be processed in next iteration
           continue;
         }
+        if (explorer->tag_scan) {
+          continue;
+        }
         break;
       case IN_CDATA:
+        if (explorer->tag_scan && *xml != ']') {
+          xml = priv_sxml_skip_to(xml, "]", limit) - 1;
+          continue;
+        }
         // Look for CDATA end: ]]>
         if (*xml == ']' && *(xml+1) == ']' && *(xml+2) == '>') {
           result = priv_sxml_change_explorer_state(explorer, IN_CONTENT);
           xml += 2; // Skip ']]>', the '>' will be processed in next iteration
           continue;
         }
+        if (explorer->tag_scan) {
+          continue;
+        }
         break;
       case IN_ENTITY:
         if (*xml == ';') {
@@ -357,26 +2481,81 @@ unsigned char sxml_run_explorer(SXMLExplorer* explorer, char *xml) {
             explorer->entity_buffer[explorer->entity_bp] = '\0';
             result = priv_sxml_process_entity(explorer, explorer->entity_buffer);
             if (result != SXMLExplorerContinue) {
-              return result;
+              break;
             }
             explorer->state = explorer->prev_state;
             continue;
           } else {
-            return SXMLExplorerErrorInvalidEntity;
+            result = SXMLExplorerErrorInvalidEntity;
+            break;
           }
         } else {
           // Collect entity characters in entity buffer
           if (explorer->entity_bp < sizeof(explorer->entity_buffer) - 1) {
             explorer->entity_buffer[explorer->entity_bp++] = *xml;
           } else {
-            return SXMLExplorerErrorInvalidEntity;
+            result = SXMLExplorerErrorInvalidEntity;
+            break;
           }
         }
         break;
       case IN_DOCTYPE:
-        if (*xml == '>') {
-          result = priv_sxml_change_explorer_state(explorer, IN_CONTENT);
-          continue;
+        // Literals and subset comments may contain '>', '[' and ']'
+        if (explorer->doctype_quote != '\0') {
+          if (*xml == explorer->doctype_quote) {
+            explorer->doctype_quote = '\0';
+          }
+          break;
+        }
+        if (explorer->doctype_comment) {
+          if (*xml == '>' && explorer->bp >= 2 && explorer->buffer[explorer->bp - 1] == '-' &&
+              explorer->buffer[explorer->bp - 2] == '-') {
+            explorer->doctype_comment = 0;
+            explorer->bp = 0;
+            explorer->buffer[0] = '\0';
+            continue;
+          }
+          break;
+        }
+        switch (*xml) {
+          case '"':
+          case '\'':
+            explorer->doctype_quote = *xml;
+            break;
+          case '-':
+            if (explorer->doctype_subset && explorer->bp >= 3 && strcmp(explorer->buffer + explorer->bp - 3, "<!-") == 0) {
+              explorer->doctype_comment = 1;
+            }
+            break;
+          case '[':
+            if (explorer->doctype_subset) {
+              break;
+            }
+            explorer->doctype_subset = 1;
+            explorer->bp = 0;
+            explorer->buffer[0] = '\0';
+            continue;
+          case ']':
+            if (!explorer->doctype_subset) {
+              break;
+            }
+            explorer->doctype_subset = 0;
+            explorer->bp = 0;
+            explorer->buffer[0] = '\0';
+            continue;
+          case '>':
+            if (explorer->doctype_subset) {
+              // One markup declaration per '>' keeps the buffer small
+              result = priv_sxml_process_markup_declaration(explorer);
+              if (result != SXMLExplorerContinue) {
+                break;
+              }
+              explorer->bp = 0;
+              explorer->buffer[0] = '\0';
+              continue;
+            }
+            result = priv_sxml_change_explorer_state(explorer, IN_CONTENT);
+            continue;
         }
         break;
     }
@@ -393,16 +2572,451 @@ unsigned char sxml_run_explorer(SXMLExplorer* explorer, char *xml) {
       }
     }
 
-  } while ((*++xml != '\0') && (result == SXMLExplorerContinue));
+    // Entity errors abort at the offending byte
+    if (result >= SXMLExplorerErrorInvalidEntity && result <= SXMLExplorerErrorMalformedXML) {
+      explorer->consumed = xml - start;
+      explorer->offset += explorer->consumed;
+      explorer->event_budget = 0;
+      return result;
+    }
+
+  } while ((*++xml != '\0') && (result == SXMLExplorerContinue) && (limit == NULL || xml < limit));
+
+  // xml now points at the first byte not consumed
+  explorer->consumed = xml - start;
+  explorer->offset += explorer->consumed;
+  explorer->event_budget = 0;
 
   if (result == SXMLExplorerStop) {
     return SXMLExplorerInterrupted;
   }
+  // Errors from state changes (element depth, namespace tables)
+  if (result >= SXMLExplorerErrorInvalidEntity && result <= SXMLExplorerErrorMalformedXML) {
+    return result;
+  }
+  // A suspension on the last event leaves nothing to resume
+  if (*xml != '\0' && (result == SXMLExplorerSuspend || result == SXMLExplorerContinue)) {
+    return SXMLExplorerSuspended;
+  }
 
   return SXMLExplorerComplete;
 
 }
 
+// =============================================================================
+// TYPED VALUES
+// =============================================================================
+
+static unsigned char priv_sxml_value_space(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static void priv_sxml_trim_value(const char** text, unsigned int* len) {
+  while (*len > 0 && priv_sxml_value_space(**text)) {
+    (*text)++;
+    (*len)--;
+  }
+  while (*len > 0 && priv_sxml_value_space((*text)[*len - 1])) {
+    (*len)--;
+  }
+}
+
+// Eight bytes as a little-endian word whatever the host order; compilers
+// fold this into one load
+static unsigned long long priv_sxml_load8(const char* p) {
+  const unsigned char* u = (const unsigned char*)p;
+  return (unsigned long long)u[0] | (unsigned long long)u[1] << 8 | (unsigned long long)u[2] << 16 |
+         (unsigned long long)u[3] << 24 | (unsigned long long)u[4] << 32 | (unsigned long long)u[5] << 40 |
+         (unsigned long long)u[6] << 48 | (unsigned long long)u[7] << 56;
+}
+
+static unsigned char priv_sxml_eight_digits(unsigned long long word) {
+  return ((word & 0xF0F0F0F0F0F0F0F0ULL) |
+          (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+}
+
+// Eight ASCII digits in three multiplications: pairs, then quads, then all
+static unsigned int priv_sxml_parse_eight(unsigned long long word) {
+  word = ((word & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+  word = ((word & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+  return (unsigned int)(((word & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+}
+
+// Appends the digits at p to *value, eight per step while they last, and
+// returns how many there were. *value wraps past 19 significant digits.
+static unsigned int priv_sxml_read_digits(const char* p, const char* end, unsigned long long* value) {
+  const char* start = p;
+  unsigned long long v = *value;
+
+  while (end - p >= 8) {
+    unsigned long long word = priv_sxml_load8(p);
+    if (!priv_sxml_eight_digits(word)) {
+      break;
+    }
+    v = v * 100000000ULL + priv_sxml_parse_eight(word);
+    p += 8;
+  }
+  while (p < end && *p >= '0' && *p <= '9') {
+    v = v * 10 + (unsigned int)(*p - '0');
+    p++;
+  }
+  *value = v;
+  return (unsigned int)(p - start);
+}
+
+unsigned char sxml_to_int(const char* text, unsigned int len, long long* out) {
+  unsigned long long value = 0;
+  unsigned int digits, lead = 0;
+  unsigned char negative;
+
+  priv_sxml_trim_value(&text, &len);
+  if (len == 0) {
+    return 0;
+  }
+  negative = *text == '-';
+  if (*text == '-' || *text == '+') {
+    text++;
+    len--;
+  }
+  digits = priv_sxml_read_digits(text, text + len, &value);
+  if (digits == 0 || digits != len) {
+    return 0;
+  }
+  while (lead < digits && text[lead] == '0') {
+    lead++;
+  }
+  if (digits - lead > 19 || value > 0x7FFFFFFFFFFFFFFFULL + negative) {
+    return 0;
+  }
+  *out = negative ? -(long long)(value - 1) - 1 : (long long)value;
+  return 1;
+}
+
+unsigned char sxml_to_bool(const char* text, unsigned int len, unsigned char* out) {
+  priv_sxml_trim_value(&text, &len);
+  if ((len == 4 && memcmp(text, "true", 4) == 0) || (len == 1 && *text == '1')) {
+    *out = 1;
+  } else if ((len == 5 && memcmp(text, "false", 5) == 0) || (len == 1 && *text == '0')) {
+    *out = 0;
+  } else {
+    return 0;
+  }
+  return 1;
+}
+
+static void priv_sxml_mul128(unsigned long long a, unsigned long long b, unsigned long long* hi, unsigned long long* lo) {
+#if defined(__SIZEOF_INT128__)
+  unsigned __int128 r = (unsigned __int128)a * b;
+  *hi = (unsigned long long)(r >> 64);
+  *lo = (unsigned long long)r;
+#else
+  unsigned long long al = a & 0xFFFFFFFFULL, ah = a >> 32, bl = b & 0xFFFFFFFFULL, bh = b >> 32;
+  unsigned long long ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+  unsigned long long mid = (ll >> 32) + (lh & 0xFFFFFFFFULL) + (hl & 0xFFFFFFFFULL);
+  *lo = (mid << 32) | (ll & 0xFFFFFFFFULL);
+  *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+static unsigned int priv_sxml_clz64(unsigned long long v) {
+#if defined(__GNUC__)
+  return (unsigned int)__builtin_clzll(v);
+#else
+  unsigned int n = 0;
+  while (!(v & 0x8000000000000000ULL)) {
+    v <<= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+// Eisel-Lemire: w * 10^q rounded to nearest-even from one (rarely two) 64x128
+// bit products with the normalized power of five. Returns 0 in the few cases
+// the truncated product cannot decide, leaving them to the slow path.
+static unsigned char priv_sxml_eisel_lemire(unsigned long long w, int q, double* out) {
+  unsigned long long hi, lo, mantissa, bits;
+  unsigned int lz, upper, index;
+  int power2;
+
+  if (q < SXMLPow5Min) {
+    *out = 0.0;
+    return 1;
+  }
+  if (q > SXMLPow5Max) {
+    bits = 0x7FFULL << 52;
+    memcpy(out, &bits, sizeof(bits));
+    return 1;
+  }
+
+  lz = priv_sxml_clz64(w);
+  w <<= lz;
+  index = 2 * (unsigned int)(q - SXMLPow5Min);
+  priv_sxml_mul128(w, sxml_pow5_table[index], &hi, &lo);
+  if ((hi & 0x1FF) == 0x1FF) {
+    unsigned long long hi2, lo2;
+    priv_sxml_mul128(w, sxml_pow5_table[index + 1], &hi2, &lo2);
+    lo += hi2;
+    hi += hi2 > lo;
+  }
+  if (lo == 0xFFFFFFFFFFFFFFFFULL && (q < -27 || q > 55)) {
+    return 0;
+  }
+
+  upper = (unsigned int)(hi >> 63);
+  mantissa = hi >> (upper + 9);
+  power2 = ((217706 * q) >> 16) + 63 + (int)upper - (int)lz + 1023;
+
+  if (power2 <= 0) {
+    // Subnormal
+    if (-power2 + 1 >= 64) {
+      *out = 0.0;
+      return 1;
+    }
+    mantissa >>= -power2 + 1;
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    power2 = mantissa < (1ULL << 52) ? 0 : 1;
+  } else {
+    // Exactly halfway between two doubles: round to even
+    if (lo <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 && (mantissa << (upper + 9)) == hi) {
+      mantissa &= ~1ULL;
+    }
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (2ULL << 52)) {
+      mantissa = 1ULL << 52;
+      power2++;
+    }
+    mantissa &= ~(1ULL << 52);
+    if (power2 >= 0x7FF) {
+      power2 = 0x7FF;
+      mantissa = 0;
+    }
+  }
+  bits = mantissa | (unsigned long long)power2 << 52;
+  memcpy(out, &bits, sizeof(bits));
+  return 1;
+}
+
+// More than 19 significant digits or an undecided product: strtod on a copy
+// with the locale's decimal point
+static unsigned char priv_sxml_slow_double(const char* text, unsigned int len, double* out) {
+  const char* point = localeconv()->decimal_point;
+  size_t point_len = strlen(point);
+  char copy[512];
+  size_t n = 0;
+  unsigned int i;
+  char* end;
+
+  for (i = 0; i < len; i++) {
+    if (n + point_len + 1 >= sizeof(copy)) {
+      return 0;
+    }
+    if (text[i] == '.') {
+      memcpy(copy + n, point, point_len);
+      n += point_len;
+    } else {
+      copy[n++] = text[i];
+    }
+  }
+  copy[n] = '\0';
+  *out = strtod(copy, &end);
+  return *end == '\0';
+}
+
+unsigned char sxml_to_double(const char* text, unsigned int len, double* out) {
+  static const double powers[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+  const char* start;
+  const char* p;
+  const char* end;
+  unsigned long long w = 0;
+  unsigned int whole, fraction = 0, significant;
+  unsigned char negative;
+  long long exponent = 0;
+  double value;
+
+  priv_sxml_trim_value(&text, &len);
+  if (len == 0) {
+    return 0;
+  }
+  start = text;
+  end = text + len;
+  negative = *text == '-';
+  if (*text == '-' || *text == '+') {
+    text++;
+  }
+  // xs:double special values
+  if (end - text == 3 && memcmp(text, "INF", 3) == 0) {
+    *out = negative ? -HUGE_VAL : HUGE_VAL;
+    return 1;
+  }
+  if (end - start == 3 && memcmp(start, "NaN", 3) == 0) {
+    *out = NAN;
+    return 1;
+  }
+
+  p = text;
+  whole = priv_sxml_read_digits(p, end, &w);
+  p += whole;
+  if (p < end && *p == '.') {
+    p++;
+    fraction = priv_sxml_read_digits(p, end, &w);
+    p += fraction;
+  }
+  if (whole + fraction == 0) {
+    return 0;
+  }
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    unsigned long long e = 0;
+    unsigned char e_negative;
+    unsigned int e_digits;
+    p++;
+    e_negative = p < end && *p == '-';
+    if (p < end && (*p == '-' || *p == '+')) {
+      p++;
+    }
+    e_digits = priv_sxml_read_digits(p, end, &e);
+    if (e_digits == 0) {
+      return 0;
+    }
+    p += e_digits;
+    // Anything this large is 0 or infinity either way
+    exponent = e_digits > 6 ? 1000000 : (long long)e;
+    exponent = e_negative ? -exponent : exponent;
+  }
+  if (p != end) {
+    return 0;
+  }
+
+  significant = whole + fraction;
+  for (p = text; p < end && (*p == '0' || *p == '.') && significant > 0; p++) {
+    significant -= *p == '0';
+  }
+  if (significant > 19) {
+    return priv_sxml_slow_double(start, len, out);
+  }
+  exponent -= fraction;
+  if (w == 0) {
+    *out = negative ? -0.0 : 0.0;
+    return 1;
+  }
+
+#if !defined(FLT_EVAL_METHOD) || FLT_EVAL_METHOD == 0
+  // Clinger: both operands exact, so one IEEE operation rounds correctly
+  if (w <= (1ULL << 53) && exponent >= -22 && exponent <= 22) {
+    value = (double)w;
+    value = exponent < 0 ? value / powers[-exponent] : value * powers[exponent];
+    *out = negative ? -value : value;
+    return 1;
+  }
+#endif
+  if (exponent < -100000 || exponent > 100000) {
+    exponent = exponent < 0 ? -100000 : 100000;
+  }
+  if (!priv_sxml_eisel_lemire(w, (int)exponent, &value)) {
+    return priv_sxml_slow_double(start, len, out);
+  }
+  *out = negative ? -value : value;
+  return 1;
+}
+
+static unsigned int priv_sxml_two_digits(const char* p) {
+  if (p[0] < '0' || p[0] > '9' || p[1] < '0' || p[1] > '9') {
+    return 100;
+  }
+  return (unsigned int)(p[0] - '0') * 10 + (unsigned int)(p[1] - '0');
+}
+
+// Days from 1970-01-01 to a proleptic Gregorian date
+static long long priv_sxml_days_from_civil(int year, unsigned int month, unsigned int day) {
+  int era;
+  unsigned int yoe, doy;
+
+  year -= month <= 2;
+  era = (year >= 0 ? year : year - 399) / 400;
+  yoe = (unsigned int)(year - era * 400);
+  doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  return (long long)era * 146097 + yoe * 365 + yoe / 4 - yoe / 100 + doy - 719468;
+}
+
+unsigned char sxml_to_timestamp(const char* text, unsigned int len, long long* seconds, unsigned int* nanos) {
+  static const unsigned char month_days[] = { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+  unsigned int century, year, month, day, hour = 0, minute = 0, second = 0, fraction = 0, scale = 0, i = 10;
+  int offset = 0;
+
+  priv_sxml_trim_value(&text, &len);
+  if (len < 10 || text[4] != '-' || text[7] != '-') {
+    return 0;
+  }
+  century = priv_sxml_two_digits(text);
+  year = priv_sxml_two_digits(text + 2);
+  month = priv_sxml_two_digits(text + 5);
+  day = priv_sxml_two_digits(text + 8);
+  if (century > 99 || year > 99 || month < 1 || month > 12 || day < 1 || day > month_days[month - 1]) {
+    return 0;
+  }
+  year += century * 100;
+  if (month == 2 && day == 29 && (year % 4 != 0 || (year % 100 == 0 && year % 400 != 0))) {
+    return 0;
+  }
+
+  if (len > 10) {
+    // "THH:MM[:SS[.frac]]" then "Z" or "+HH:MM"; W3C-DTF lets seconds go
+    if (len < 17 || (text[10] != 'T' && text[10] != 't' && text[10] != ' ') || text[13] != ':') {
+      return 0;
+    }
+    hour = priv_sxml_two_digits(text + 11);
+    minute = priv_sxml_two_digits(text + 14);
+    i = 16;
+    if (i < len && text[i] == ':') {
+      if (len < 19 || (second = priv_sxml_two_digits(text + 17)) > 60) {
+        return 0;
+      }
+      i = 19;
+      if (i < len && text[i] == '.') {
+        unsigned int start = ++i;
+        for (; i < len && text[i] >= '0' && text[i] <= '9'; i++) {
+          if (scale < 9) {
+            fraction = fraction * 10 + (unsigned int)(text[i] - '0');
+            scale++;
+          }
+        }
+        if (i == start) {
+          return 0;
+        }
+      }
+    }
+    if (hour > 23 || minute > 59 || i == len) {
+      return 0;
+    }
+    if ((text[i] == 'Z' || text[i] == 'z') && i + 1 == len) {
+      offset = 0;
+    } else if ((text[i] == '+' || text[i] == '-') && i + 6 == len && text[i + 3] == ':') {
+      unsigned int oh = priv_sxml_two_digits(text + i + 1), om = priv_sxml_two_digits(text + i + 4);
+      if (oh > 23 || om > 59) {
+        return 0;
+      }
+      offset = (int)(oh * 3600 + om * 60);
+      offset = text[i] == '-' ? -offset : offset;
+    } else {
+      return 0;
+    }
+  }
+
+  for (; scale < 9; scale++) {
+    fraction *= 10;
+  }
+  *seconds = priv_sxml_days_from_civil((int)year, month, day) * 86400 + hour * 3600 + minute * 60 + second - offset;
+  if (nanos != NULL) {
+    *nanos = fraction;
+  }
+  return 1;
+}
+
 // =============================================================================
 // EXI SUPPORT: FLATTENED PARSER
 // =============================================================================
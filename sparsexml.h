@@ -3,12 +3,16 @@
 
 #define SXMLExplorerContinue 0x00
 #define SXMLExplorerStop 0x01
+#define SXMLExplorerSuspend 0x07
+#define SXMLExplorerSkip 0x09         // From a start tag's callbacks, see below
+#define SXMLExplorerBase64 0x0A       // Likewise
 
 #define SXMLExplorerComplete 0x02
 #define SXMLExplorerInterrupted 0x03
 #define SXMLExplorerErrorInvalidEntity 0x04
 #define SXMLExplorerErrorBufferOverflow 0x05
 #define SXMLExplorerErrorMalformedXML 0x06
+#define SXMLExplorerSuspended 0x08
 
 #define SXMLElementLength 1024
 
@@ -25,18 +29,176 @@ typedef enum __SXMLExplorerState {
   IN_DOCTYPE
 } SXMLExplorerState;
 
+typedef enum __SXMLEventType {
+  SXMLEventTag,
+  SXMLEventContent,
+  SXMLEventAttributeKey,
+  SXMLEventAttributeValue,
+  SXMLEventComment,
+  SXMLEventEndTag             // Name func and element handlers only
+} SXMLEventType;
+
 typedef struct __SXMLExplorer SXMLExplorer;
 
 SXMLExplorer* sxml_make_explorer(void);
 void sxml_destroy_explorer(SXMLExplorer*);
 void sxml_register_func(SXMLExplorer*, void*, void*, void*, void*);
 void sxml_register_comment_func(SXMLExplorer*, void*);
+// Event func: unsigned char (*)(void* user, SXMLEventType, char* text, unsigned int len),
+// called before the per-type callbacks with the pointer given at registration
+void sxml_register_event_func(SXMLExplorer*, void*, void*);
 void sxml_enable_entity_processing(SXMLExplorer*, unsigned char);
 void sxml_enable_namespace_processing(SXMLExplorer*, unsigned char);
 void sxml_enable_extended_entities(SXMLExplorer*, unsigned char);
 void sxml_enable_numeric_entities(SXMLExplorer*, unsigned char);
+// Tag scan: content, comments and CDATA are skipped with a vectorized
+// search for the next delimiter and never buffered, so only tag and
+// attribute callbacks (and the element layers above them) fire
+void sxml_enable_tag_scan(SXMLExplorer*, unsigned char);
+// Whitespace skip: content runs of only spaces, tabs and line breaks (such
+// as indentation) are dropped instead of reported
+void sxml_enable_whitespace_skip(SXMLExplorer*, unsigned char);
+// Text coalescing: text and CDATA sections next to each other make one
+// content event (of at most SXMLElementLength - 1 bytes) instead of one each;
+// with lazy entities CDATA sections stay events of their own
+void sxml_enable_text_coalescing(SXMLExplorer*, unsigned char);
+// Skip: any callback of a start tag (tag, attribute, name, element handler,
+// start element and namespace funcs) may return SXMLExplorerSkip. Once the
+// start tag is complete the element's content is passed over with a depth
+// counter and a vectorized search for '<', aware of comments, CDATA,
+// processing instructions and quoted attribute values; nothing inside is
+// buffered or reported. Parsing resumes at the matching end tag, whose
+// events fire as usual. Anywhere else Skip acts as SXMLExplorerContinue.
+
+// Base64: a start tag's callbacks may instead return SXMLExplorerBase64 to
+// have the element's text decoded as it streams, in blocks of at most
+// SXMLBase64BlockLength bytes, into the base64 func: unsigned char (*)(void*
+// user, const unsigned char* data, unsigned int len). The text is neither
+// buffered nor reported as content, so its length is unbounded. Whitespace
+// is ignored and padding is optional; decoding ends at the first markup,
+// normally the end tag. Characters outside the alphabet (references
+// included) fail with SXMLExplorerErrorMalformedXML.
+void sxml_register_base64_func(SXMLExplorer*, void*, void*);
+
+// Namespace func: unsigned char (*)(void* user, unsigned int uri, char* local,
+// unsigned int local_len, unsigned char end). With namespace processing on it
+// is called when a start tag is complete (its own xmlns attributes applied)
+// and at the end tag; local points into parser memory, valid for the call.
+#define SXMLNamespaceNone 0
+#define SXMLNamespaceUnbound 0xFFFF
+void sxml_register_namespace_func(SXMLExplorer*, void*, void*);
+// Name func: unsigned char (*)(void* user, SXMLEventType, unsigned int id,
+// char* name, unsigned int len) for SXMLEventTag, SXMLEventEndTag (also for
+// empty elements) and SXMLEventAttributeKey. Ids are stable for the explorer;
+// names not registered (and not interned) get SXMLNameUnknown. The span is
+// not NUL-terminated.
+#define SXMLNameUnknown 0xFFFF
+void sxml_register_name_func(SXMLExplorer*, void*, void*);
+unsigned int sxml_register_name(SXMLExplorer*, const char*);
+// Interns names on first sight until the symbol table is full
+void sxml_enable_name_interning(SXMLExplorer*, unsigned char);
+const char* sxml_name(SXMLExplorer*, unsigned int);
+// Element handler: unsigned char (*)(void* user, SXMLEventType, char* text,
+// unsigned int len) for one element name: its start tag, attribute keys and
+// values, its own text (not its children's) and SXMLEventEndTag. Elements
+// without a handler cost no call. Registering a name again replaces the
+// handler; returns SXMLExplorerErrorBufferOverflow when the tables are full.
+unsigned char sxml_on_element(SXMLExplorer*, const char* name, void* func, void* user);
+// Start element func: unsigned char (*)(void* user, char* name, unsigned int
+// len, SXMLAttribute* attrs, unsigned int count), once per start tag when
+// it is complete, with every attribute in document order. Spans are
+// NUL-terminated and point into the explorer, valid for the call. More than
+// SXMLAttributeMax attributes fail with SXMLExplorerErrorBufferOverflow.
+typedef struct {
+  const char* key;
+  const char* value;
+  unsigned int key_len;
+  unsigned int value_len;
+} SXMLAttribute;
+void sxml_register_start_element_func(SXMLExplorer*, void*, void*);
+// Lazy attributes: start tags are scanned to '>' without tokenizing their
+// attributes and no attribute callbacks fire. Inside the tag callback (or a
+// start element func, which still gets the pairs) the raw section is
+// available and parsed on demand. Spans point into the buffer, are not
+// NUL-terminated and keep their entity references; single and double
+// quotes are accepted. The cursor starts at 0; both return 1 on a match.
+void sxml_enable_lazy_attributes(SXMLExplorer*, unsigned char);
+const char* sxml_attr_region(SXMLExplorer*, unsigned int* len);
+unsigned char sxml_attr_next(SXMLExplorer*, unsigned int* cursor, SXMLAttribute*);
+unsigned char sxml_attr_find(SXMLExplorer*, const char* name, SXMLAttribute*);
+// Element path: with tracking on (enable before parsing), any callback can
+// ask for the open elements. Content, attribute and end tag callbacks see
+// their element as the innermost one; a start tag's own callback sees its
+// parent. Nesting deeper than the max depth (default and ceiling
+// SXMLElementMaxDepth) fails with SXMLExplorerErrorBufferOverflow.
+void sxml_enable_element_path(SXMLExplorer*, unsigned char);
+void sxml_set_max_depth(SXMLExplorer*, unsigned int);
+unsigned int sxml_element_depth(SXMLExplorer*);
+// Symbol id of the open element at level (0 = outermost), SXMLNameUnknown
+// unless the name is registered or interned
+unsigned int sxml_element_at(SXMLExplorer*, unsigned int level);
+// Open element names joined by '/', outermost first ("rss/channel/item")
+const char* sxml_element_path(SXMLExplorer*, unsigned int* len);
+
+// URI for an id given to the namespace func ("" for SXMLNamespaceNone)
+const char* sxml_namespace_uri(SXMLExplorer*, unsigned int);
+// Resolves a prefix ("" for the default namespace) against the bindings in
+// scope, e.g. for prefixed attribute names
+unsigned int sxml_resolve_prefix(SXMLExplorer*, const char*, unsigned int);
+// Lazy mode: content and attribute values keep their references and
+// sxml_text_needs_decoding() tells, inside the callback, whether they hold any
+void sxml_enable_lazy_entities(SXMLExplorer*, unsigned char);
+unsigned char sxml_text_needs_decoding(SXMLExplorer*);
+// Expands predefined, HTML5 and numeric references from src[0, len) into dst
+// (not overlapping src, SXMLDecodedLength(len) bytes) and returns the length
+// written. Invalid references are copied through; declared entities are not
+// known here and need eager processing.
+#define SXMLDecodedLength(len) ((len) + (len) / 5 + 1)
+unsigned int sxml_decode_entities(char* dst, const char* src, unsigned int len);
+// Same, expanding only what the explorer expands eagerly: numeric and HTML5
+// references need sxml_enable_numeric_entities and
+// sxml_enable_extended_entities, otherwise they are copied through.
+unsigned int sxml_explorer_decode_entities(SXMLExplorer*, char* dst, const char* src, unsigned int len);
+// Binds &name; to value (which may reference other entities). DOCTYPE
+// <!ENTITY> declarations share the table; the first binding of a name wins.
+unsigned char sxml_register_entity(SXMLExplorer*, const char* name, const char* value);
+// Caps the bytes a single declared entity reference may expand to
+void sxml_set_entity_expansion_limit(SXMLExplorer*, unsigned int);
+
+// Typed values: convert a span (content, an attribute value) where it lies,
+// without a copy or NUL termination, ignoring surrounding whitespace and the
+// locale. Each returns 1 when the whole span is a value of the type and
+// leaves the output alone otherwise.
+// Integers: optional sign and decimal digits within long long; eight digits
+// per step
+unsigned char sxml_to_int(const char*, unsigned int, long long*);
+// Doubles: xs:double forms (INF, -INF and NaN included), correctly rounded
+// by Clinger's fast path or Eisel-Lemire, strtod beyond 19 significant digits
+unsigned char sxml_to_double(const char*, unsigned int, double*);
+// Booleans: true, false, 1 and 0
+unsigned char sxml_to_bool(const char*, unsigned int, unsigned char*);
+// RFC 3339 date-times ("2003-12-13T18:30:02Z", "2003-12-13T18:30:02.25-05:00",
+// seconds optional as in W3C-DTF) and plain dates (midnight UTC) as seconds
+// since the epoch; nanos (may be NULL) receives the fraction
+unsigned char sxml_to_timestamp(const char*, unsigned int, long long* seconds, unsigned int* nanos);
 
 unsigned char sxml_run_explorer(SXMLExplorer*, char*);
+// Suspends after max_bytes input bytes or max_events events (0 = unlimited),
+// or when a callback returns SXMLExplorerSuspend (after the other callbacks
+// of that event). Resume with the same explorer at xml +
+// sxml_explorer_consumed().
+unsigned char sxml_run_explorer_budget(SXMLExplorer*, char*, unsigned long max_bytes, unsigned int max_events);
+unsigned long sxml_explorer_consumed(SXMLExplorer*);
+// Total input bytes consumed across all runs of this explorer
+unsigned long sxml_explorer_offset(SXMLExplorer*);
+
+// Copies parse state and callbacks; the clone parses independently
+SXMLExplorer* sxml_clone_explorer(SXMLExplorer*);
+// Serializes parse state into out and returns the blob length. Nothing is
+// written when out is NULL or size is too small, so call once to size it.
+unsigned int sxml_snapshot_explorer(SXMLExplorer*, unsigned char* out, unsigned int size);
+// Restores parse state (not callbacks) from a snapshot blob
+unsigned char sxml_restore_explorer(SXMLExplorer*, const unsigned char* blob, unsigned int len);
 unsigned char sxml_run_explorer_exi(SXMLExplorer*, unsigned char*, unsigned int);
 
 #endif
@@ -0,0 +1,214 @@
+#include <CUnit/CUnit.h>
+#include <CUnit/Basic.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "sparsexml.h"
+#include "sparsexml-aggregate.h"
+
+/*
+ * Aggregation tests: grouping and value paths over records, accumulated in
+ * one pass and emitted per group.
+ */
+
+static char* aggregate_read_file(const char* filename) {
+  FILE* f = fopen(filename, "rb");
+  if (!f) return NULL;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  rewind(f);
+  char* buffer = malloc(size + 1);
+  if (!buffer) { fclose(f); return NULL; }
+  size_t r = fread(buffer, 1, size, f);
+  buffer[r] = '\0';
+  fclose(f);
+  return buffer;
+}
+
+typedef struct {
+  unsigned int count;
+  unsigned int stop_after;  // Groups before answering Stop, 0 for never
+  char keys[8][64];         // Key parts of the first groups, joined by '|'
+  double values[8][4];
+} GroupLog;
+
+static unsigned char aggregate_log_group(void* user, const SXMLSpan* keys, unsigned int key_count,
+                                         const double* values, unsigned int value_count) {
+  GroupLog* log = user;
+  unsigned int i;
+  if (log->count < 8) {
+    for (i = 0; i < key_count; i++) {
+      size_t used = strlen(log->keys[log->count]);
+      snprintf(log->keys[log->count] + used, sizeof(log->keys[0]) - used, "%s%.*s", i > 0 ? "|" : "",
+               (int)keys[i].len, keys[i].text);
+    }
+    for (i = 0; i < value_count && i < 4; i++) {
+      log->values[log->count][i] = values[i];
+    }
+  }
+  log->count++;
+  return log->stop_after != 0 && log->count >= log->stop_after ? SXMLExplorerStop : SXMLExplorerContinue;
+}
+
+void test_aggregate_books(void) {
+  char* xml = aggregate_read_file("test-data/test-large-document.xml");
+  GroupLog log;
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  memset(&log, 0, sizeof(log));
+
+  // Books per year with their pages and cheapest ebook
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLAggregation* a = sxml_make_aggregation(ex, "/library/books/book");
+  CU_ASSERT_PTR_NOT_NULL_FATAL(a);
+  CU_ASSERT_EQUAL(sxml_aggregate_group(a, "publication/year"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateCount, NULL), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateSum, "publication/pages"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateMin, "availability/format[@type='ebook']/@price"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateMax, "publication/pages"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+
+  CU_ASSERT_EQUAL(sxml_aggregation_groups(a), 4);
+  CU_ASSERT_EQUAL(sxml_aggregation_emit(a, aggregate_log_group, &log), SXMLExplorerContinue);
+  CU_ASSERT_FATAL(log.count == 4);
+  CU_ASSERT_STRING_EQUAL(log.keys[0], "2023");
+  CU_ASSERT_STRING_EQUAL(log.keys[1], "2022");
+  CU_ASSERT_STRING_EQUAL(log.keys[2], "2021");
+  CU_ASSERT_STRING_EQUAL(log.keys[3], "2024");
+  CU_ASSERT_EQUAL(log.values[0][0], 2);
+  CU_ASSERT_EQUAL(log.values[0][1], 456 + 542);
+  CU_ASSERT_DOUBLE_EQUAL(log.values[0][2], 11.99, 1e-9);
+  CU_ASSERT_EQUAL(log.values[0][3], 542);
+  CU_ASSERT_EQUAL(log.values[3][0], 1);
+  CU_ASSERT_EQUAL(log.values[3][1], 1200);
+  CU_ASSERT_DOUBLE_EQUAL(log.values[3][2], 49.99, 1e-9);
+
+  // The result func can stop the emission
+  memset(&log, 0, sizeof(log));
+  log.stop_after = 2;
+  CU_ASSERT_EQUAL(sxml_aggregation_emit(a, aggregate_log_group, &log), SXMLExplorerStop);
+  CU_ASSERT_EQUAL(log.count, 2);
+
+  // Declarations are fixed once groups exist
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateCount, NULL), SXMLExplorerErrorBufferOverflow);
+  CU_ASSERT_EQUAL(sxml_aggregate_group(a, "@category"), SXMLExplorerErrorBufferOverflow);
+  sxml_destroy_aggregation(a);
+  sxml_destroy_explorer(ex);
+  free(xml);
+}
+
+void test_aggregate_composite_keys(void) {
+  char xml[] = "<sales>"
+               "<sale region=\"eu\"><product>tea</product><amount>10.5</amount><coupon>x</coupon></sale>"
+               "<sale region=\"us\"><product>tea</product><amount>4</amount></sale>"
+               "<sale region=\"eu\"><product>tea</product><amount>n/a</amount></sale>"
+               "<sale region=\"eu\"><amount>-2</amount><product>tea</product><amount>100</amount></sale>"
+               "<sale><product>tea</product><amount>1e1</amount></sale>"
+               "<sale region=\"eu\"><product>te</product><amount>3</amount></sale>"
+               "</sales>";
+  GroupLog log;
+  memset(&log, 0, sizeof(log));
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLAggregation* a = sxml_make_aggregation(ex, "/sales/sale");
+  CU_ASSERT_PTR_NOT_NULL_FATAL(a);
+  CU_ASSERT_EQUAL(sxml_aggregate_group(a, "@region"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_aggregate_group(a, "product"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateSum, "amount"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateCount, "coupon"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateMin, "amount"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateCount, "amount"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+
+  // Keys compare part by part ("eu|te" is not "eu|tea"); a missing key is "";
+  // the first value of a path in a record wins and non-numbers are ignored
+  CU_ASSERT_EQUAL(sxml_aggregation_emit(a, aggregate_log_group, &log), SXMLExplorerContinue);
+  CU_ASSERT_FATAL(log.count == 4);
+  CU_ASSERT_STRING_EQUAL(log.keys[0], "eu|tea");
+  CU_ASSERT_EQUAL(log.values[0][0], 8.5);
+  CU_ASSERT_EQUAL(log.values[0][1], 1);
+  CU_ASSERT_EQUAL(log.values[0][2], -2);
+  CU_ASSERT_EQUAL(log.values[0][3], 3);
+  CU_ASSERT_STRING_EQUAL(log.keys[1], "us|tea");
+  CU_ASSERT_EQUAL(log.values[1][0], 4);
+  CU_ASSERT_EQUAL(log.values[1][1], 0);
+  CU_ASSERT_STRING_EQUAL(log.keys[2], "|tea");
+  CU_ASSERT_EQUAL(log.values[2][0], 10);
+  CU_ASSERT_STRING_EQUAL(log.keys[3], "eu|te");
+  sxml_destroy_aggregation(a);
+  sxml_destroy_explorer(ex);
+
+  // Without grouping paths every record lands in one group
+  memset(&log, 0, sizeof(log));
+  ex = sxml_make_explorer();
+  a = sxml_make_aggregation(ex, "//sale");
+  CU_ASSERT_PTR_NOT_NULL_FATAL(a);
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateCount, NULL), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateMax, "amount"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateMin, "discount"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(sxml_aggregation_emit(a, aggregate_log_group, &log), SXMLExplorerContinue);
+  CU_ASSERT_FATAL(log.count == 1);
+  CU_ASSERT_STRING_EQUAL(log.keys[0], "");
+  CU_ASSERT_EQUAL(log.values[0][0], 6);
+  CU_ASSERT_EQUAL(log.values[0][1], 10.5);
+  CU_ASSERT(isnan(log.values[0][2]));
+  sxml_destroy_aggregation(a);
+  sxml_destroy_explorer(ex);
+}
+
+void test_aggregate_many_groups(void) {
+  unsigned int records = 20000, groups = 5000, i;
+  char* xml = malloc(records * 64 + 64);
+  size_t used = 0;
+  GroupLog log;
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  memset(&log, 0, sizeof(log));
+
+  used += sprintf(xml + used, "<log>");
+  for (i = 0; i < records; i++) {
+    used += sprintf(xml + used, "<hit user=\"u%u\"><bytes>%u</bytes></hit>", i % groups, i);
+  }
+  sprintf(xml + used, "</log>");
+
+  // The table grows past its first capacity and keeps first-seen order
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLAggregation* a = sxml_make_aggregation(ex, "/log/hit");
+  CU_ASSERT_PTR_NOT_NULL_FATAL(a);
+  CU_ASSERT_EQUAL(sxml_aggregate_group(a, "@user"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateCount, NULL), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateSum, "bytes"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(sxml_aggregation_groups(a), groups);
+  CU_ASSERT_EQUAL(sxml_aggregation_emit(a, aggregate_log_group, &log), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(log.count, groups);
+  CU_ASSERT_STRING_EQUAL(log.keys[7], "u7");
+  CU_ASSERT_EQUAL(log.values[7][0], 4);
+  CU_ASSERT_EQUAL(log.values[7][1], 7 + 5007 + 10007 + 15007);
+
+  // Declaration errors
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateSum, NULL), SXMLExplorerErrorMalformedXML);
+  CU_ASSERT_EQUAL(sxml_aggregate(a, 0x7F, "bytes"), SXMLExplorerErrorMalformedXML);
+  sxml_destroy_aggregation(a);
+  sxml_destroy_explorer(ex);
+
+  ex = sxml_make_explorer();
+  a = sxml_make_aggregation(ex, "/log/hit");
+  CU_ASSERT_PTR_NOT_NULL_FATAL(a);
+  CU_ASSERT_EQUAL(sxml_aggregate(a, SXMLAggregateSum, "a[@x="), SXMLExplorerErrorMalformedXML);
+  for (i = 0; i < SXMLAggregateKeys; i++) {
+    CU_ASSERT_EQUAL(sxml_aggregate_group(a, "@user"), SXMLExplorerContinue);
+  }
+  CU_ASSERT_EQUAL(sxml_aggregate_group(a, "@user"), SXMLExplorerErrorBufferOverflow);
+  sxml_destroy_aggregation(a);
+  CU_ASSERT_PTR_NULL(sxml_make_aggregation(ex, "not a path"));
+  sxml_destroy_explorer(ex);
+  free(xml);
+}
+
+void add_aggregate_tests(CU_pSuite* suite) {
+  CU_add_test(*suite, "Aggregate books by year", test_aggregate_books);
+  CU_add_test(*suite, "Aggregate over composite keys", test_aggregate_composite_keys);
+  CU_add_test(*suite, "Aggregate many groups", test_aggregate_many_groups);
+}
@@ -0,0 +1,260 @@
+#include <CUnit/CUnit.h>
+#include <CUnit/Basic.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+
+#include "sparsexml.h"
+#include "sparsexml-bind.h"
+
+/*
+ * Record binding tests: every record arrives once, converted, with the
+ * fields it carried flagged.
+ */
+
+#define BIND_MAX_RECORDS 8
+
+typedef struct {
+  SXMLSpan id;
+  SXMLSpan title;
+  SXMLSpan category;
+  long long year;
+  double ebook;
+  unsigned char available;
+} Book;
+
+typedef struct {
+  unsigned int count;
+  unsigned long fields[BIND_MAX_RECORDS];
+  char ids[BIND_MAX_RECORDS][16];
+  char titles[BIND_MAX_RECORDS][64];
+  long long years[BIND_MAX_RECORDS];
+  double ebooks[BIND_MAX_RECORDS];
+  unsigned char available[BIND_MAX_RECORDS];
+  unsigned int stop_after;
+} BookLog;
+
+static unsigned char bind_log_book(void* user, void* record, unsigned long fields) {
+  BookLog* log = user;
+  Book* book = record;
+  if (log->count < BIND_MAX_RECORDS) {
+    log->fields[log->count] = fields;
+    snprintf(log->ids[log->count], sizeof(log->ids[0]), "%.*s", (int)book->id.len, book->id.text);
+    snprintf(log->titles[log->count], sizeof(log->titles[0]), "%.*s", (int)book->title.len, book->title.text);
+    log->years[log->count] = book->year;
+    log->ebooks[log->count] = book->ebook;
+    log->available[log->count] = book->available;
+  }
+  log->count++;
+  if (log->stop_after && log->count == log->stop_after) {
+    return SXMLExplorerStop;
+  }
+  return SXMLExplorerContinue;
+}
+
+static char* bind_read_file(const char* filename) {
+  FILE* f = fopen(filename, "rb");
+  if (!f) return NULL;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  rewind(f);
+  char* str = (char*)malloc(size + 1);
+  if (!str) { fclose(f); return NULL; }
+  fread(str, 1, size, f);
+  str[size] = '\0';
+  fclose(f);
+  return str;
+}
+
+static SXMLBinding* bind_books(SXMLExplorer* ex, Book* book, BookLog* log) {
+  SXMLBinding* b = sxml_make_binding(ex, "/library/books/book", book, sizeof(Book));
+  CU_ASSERT_PTR_NOT_NULL(b);
+  if (b == NULL) return NULL;
+  CU_ASSERT_EQUAL(sxml_bind_field(b, "@id", SXMLBindText, offsetof(Book, id)), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_bind_field(b, "title", SXMLBindText, offsetof(Book, title)), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_bind_field(b, "publication/year", SXMLBindInt, offsetof(Book, year)), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_bind_field(b, "//format[@type='ebook']/@price", SXMLBindDouble, offsetof(Book, ebook)), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_bind_field(b, "@available", SXMLBindBool, offsetof(Book, available)), SXMLExplorerContinue);
+  // Bound but absent from the document
+  CU_ASSERT_EQUAL(sxml_bind_field(b, "@missing", SXMLBindText, offsetof(Book, category)), SXMLExplorerContinue);
+  sxml_binding_register_record_func(b, bind_log_book, log);
+  return b;
+}
+
+void test_bind_books(void) {
+  char* xml = bind_read_file("test-data/test-large-document.xml");
+  BookLog whole, budgeted, stopped;
+  Book book;
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  memset(&whole, 0, sizeof(whole));
+  memset(&budgeted, 0, sizeof(budgeted));
+  memset(&stopped, 0, sizeof(stopped));
+  stopped.stop_after = 2;
+
+  BookLog* logs[] = { &whole, &budgeted, &stopped };
+  for (unsigned int run = 0; run < 3; run++) {
+    SXMLExplorer* ex = sxml_make_explorer();
+    SXMLBinding* b = bind_books(ex, &book, logs[run]);
+    unsigned char result;
+    CU_ASSERT_PTR_NOT_NULL_FATAL(b);
+    if (run == 1) {
+      unsigned long pos = 0;
+      while ((result = sxml_run_explorer_budget(ex, xml + pos, 7, 0)) == SXMLExplorerSuspended) {
+        pos += sxml_explorer_consumed(ex);
+      }
+    } else {
+      result = sxml_run_explorer(ex, xml);
+    }
+    CU_ASSERT_EQUAL(result, run == 2 ? SXMLExplorerInterrupted : SXMLExplorerComplete);
+    sxml_destroy_binding(b);
+    sxml_destroy_explorer(ex);
+  }
+
+  CU_ASSERT_FATAL(whole.count == 5);
+  CU_ASSERT_EQUAL(whole.fields[0], 0x1Ful);
+  CU_ASSERT_STRING_EQUAL(whole.ids[0], "book001");
+  CU_ASSERT_STRING_EQUAL(whole.titles[0], "The Quantum Paradox");
+  CU_ASSERT_EQUAL(whole.years[0], 2023);
+  CU_ASSERT_DOUBLE_EQUAL(whole.ebooks[0], 12.99, 1e-9);
+  CU_ASSERT_EQUAL(whole.available[0], 1);
+  CU_ASSERT_STRING_EQUAL(whole.ids[2], "book003");
+  CU_ASSERT_EQUAL(whole.years[2], 2021);
+  CU_ASSERT_DOUBLE_EQUAL(whole.ebooks[2], 28.99, 1e-9);
+  CU_ASSERT_EQUAL(whole.available[2], 0);
+  CU_ASSERT_DOUBLE_EQUAL(whole.ebooks[4], 49.99, 1e-9);
+
+  CU_ASSERT_EQUAL(budgeted.count, whole.count);
+  for (unsigned int i = 0; i < whole.count; i++) {
+    CU_ASSERT_EQUAL(budgeted.fields[i], whole.fields[i]);
+    CU_ASSERT_STRING_EQUAL(budgeted.ids[i], whole.ids[i]);
+    CU_ASSERT_STRING_EQUAL(budgeted.titles[i], whole.titles[i]);
+    CU_ASSERT_EQUAL(budgeted.years[i], whole.years[i]);
+  }
+  CU_ASSERT_EQUAL(stopped.count, 2);
+
+  free(xml);
+}
+
+typedef struct {
+  SXMLSpan title;
+  SXMLSpan guid;
+  unsigned char permalink;
+  long long updated;
+} Entry;
+
+typedef struct {
+  Entry entry;
+  unsigned long fields;
+} EntryLog;
+
+// Spans are copied too: the arena holds them until the next record starts
+static unsigned char bind_keep_entry(void* user, void* record, unsigned long fields) {
+  EntryLog* log = user;
+  memcpy(&log->entry, record, sizeof(Entry));
+  log->fields = fields;
+  return SXMLExplorerContinue;
+}
+
+void test_bind_feeds(void) {
+  char* rss = bind_read_file("test-data/test-rss.xml");
+  char* atom = bind_read_file("test-data/test-oss-1.xml");
+  Entry entry;
+  EntryLog seen;
+  CU_ASSERT_PTR_NOT_NULL_FATAL(rss);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(atom);
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLBinding* b = sxml_make_binding(ex, "/rss/channel/item", &entry, sizeof(entry));
+  CU_ASSERT_PTR_NOT_NULL_FATAL(b);
+  sxml_bind_field(b, "guid", SXMLBindText, offsetof(Entry, guid));
+  sxml_bind_field(b, "guid/@isPermaLink", SXMLBindBool, offsetof(Entry, permalink));
+  sxml_bind_field(b, "pubDate", SXMLBindTimestamp, offsetof(Entry, updated));
+  sxml_binding_register_record_func(b, bind_keep_entry, &seen);
+  memset(&seen, 0, sizeof(seen));
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, rss), SXMLExplorerComplete);
+  // pubDate is RFC 822, not RFC 3339: the field stays unset
+  CU_ASSERT_EQUAL(seen.fields, 0x03);
+  CU_ASSERT_EQUAL(seen.entry.permalink, 0);
+  CU_ASSERT_EQUAL(seen.entry.guid.len, 36);
+  CU_ASSERT_NSTRING_EQUAL(seen.entry.guid.text, "7bd204c6-1655-4c27-aeee-53f933c5395f", 36);
+  CU_ASSERT_EQUAL(seen.entry.updated, 0);
+  sxml_destroy_binding(b);
+  sxml_destroy_explorer(ex);
+
+  ex = sxml_make_explorer();
+  b = sxml_make_binding(ex, "/feed/entry", &entry, sizeof(entry));
+  CU_ASSERT_PTR_NOT_NULL_FATAL(b);
+  sxml_bind_field(b, "title", SXMLBindText, offsetof(Entry, title));
+  sxml_bind_field(b, "updated", SXMLBindTimestamp, offsetof(Entry, updated));
+  sxml_bind_field(b, "link/@href", SXMLBindText, offsetof(Entry, guid));
+  sxml_binding_register_record_func(b, bind_keep_entry, &seen);
+  memset(&seen, 0, sizeof(seen));
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, atom), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(seen.fields, 0x07);
+  CU_ASSERT_EQUAL(seen.entry.updated, 1071340202LL);
+  CU_ASSERT_NSTRING_EQUAL(seen.entry.title.text, "Atom-Powered Robots Run Amok", seen.entry.title.len);
+  CU_ASSERT_NSTRING_EQUAL(seen.entry.guid.text, "http://example.org/2003/12/13/atom03", seen.entry.guid.len);
+  sxml_destroy_binding(b);
+  sxml_destroy_explorer(ex);
+
+  free(rss);
+  free(atom);
+}
+
+static unsigned char bind_keep_stamp(void* user, void* record, unsigned long fields) {
+  long long* out = user;
+  *out = fields ? *(long long*)record : -1;
+  return SXMLExplorerContinue;
+}
+
+void test_bind_conversions(void) {
+  const char* cases[][2] = {
+    { "<r><t>1970-01-01T00:00:00Z</t></r>", "0" },
+    { "<r><t> 2000-02-29T12:00:00.250+01:30 </t></r>", "951820200" },
+    { "<r><t>1969-12-31T23:59:59-00:00</t></r>", "-1" },
+    { "<r><t>2024-01-15</t></r>", "1705276800" },
+    { "<r><t>2024-01-15T10:30</t></r>", "missing" },
+    { "<r><t>2024-13-01T00:00:00Z</t></r>", "missing" },
+    { "<r><t>2024-01-15T10:30:00</t></r>", "missing" },
+  };
+  for (unsigned int i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    char xml[128];
+    long long stamp, got = -2;
+    strcpy(xml, cases[i][0]);
+    SXMLExplorer* ex = sxml_make_explorer();
+    SXMLBinding* b = sxml_make_binding(ex, "/r", &stamp, sizeof(stamp));
+    CU_ASSERT_EQUAL(sxml_bind_field(b, "t", SXMLBindTimestamp, 0), SXMLExplorerContinue);
+    sxml_binding_register_record_func(b, bind_keep_stamp, &got);
+    CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+    if (strcmp(cases[i][1], "missing") == 0) {
+      CU_ASSERT_EQUAL(got, -1);
+    } else {
+      CU_ASSERT_EQUAL(got, atoll(cases[i][1]));
+    }
+    sxml_destroy_binding(b);
+    sxml_destroy_explorer(ex);
+  }
+
+  // Table errors
+  Book book;
+  SXMLExplorer* ex = sxml_make_explorer();
+  CU_ASSERT_PTR_NULL(sxml_make_binding(ex, "book", &book, sizeof(book)));
+  SXMLBinding* b = sxml_make_binding(ex, "/book", &book, sizeof(book));
+  CU_ASSERT_EQUAL(sxml_bind_field(b, "", SXMLBindText, 0), SXMLExplorerErrorMalformedXML);
+  CU_ASSERT_EQUAL(sxml_bind_field(b, "a[@k", SXMLBindText, 0), SXMLExplorerErrorMalformedXML);
+  CU_ASSERT_EQUAL(sxml_bind_field(b, "a", 0x7F, 0), SXMLExplorerErrorMalformedXML);
+  CU_ASSERT_EQUAL(sxml_bind_field(b, "a", SXMLBindDouble, sizeof(book) - 4), SXMLExplorerErrorMalformedXML);
+  for (unsigned int i = 0; i < SXMLBindFields; i++) {
+    CU_ASSERT_EQUAL(sxml_bind_field(b, "a", SXMLBindInt, offsetof(Book, year)), SXMLExplorerContinue);
+  }
+  CU_ASSERT_EQUAL(sxml_bind_field(b, "a", SXMLBindInt, offsetof(Book, year)), SXMLExplorerErrorBufferOverflow);
+  sxml_destroy_binding(b);
+  sxml_destroy_explorer(ex);
+}
+
+void add_bind_tests(CU_pSuite* suite) {
+  CU_add_test(*suite, "Bind books", test_bind_books);
+  CU_add_test(*suite, "Bind RSS and Atom records", test_bind_feeds);
+  CU_add_test(*suite, "Binding conversions and table errors", test_bind_conversions);
+}
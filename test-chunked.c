@@ -133,10 +133,285 @@ void test_chunked_sitemap(void) {
     free(xml);
 }
 
+// Event log shared by the budgeted parsing tests
+typedef struct {
+    char text[4096];
+    unsigned int len;
+    unsigned int events;
+    const char* suspend_on;
+} BudgetLog;
+
+static unsigned char budget_log_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+    BudgetLog* log = user;
+    int n = snprintf(log->text + log->len, sizeof(log->text) - log->len, "%d:%s|", (int)type, text);
+    if (n > 0 && log->len + n < sizeof(log->text)) log->len += n;
+    log->events++;
+    if (log->suspend_on && strcmp(text, log->suspend_on) == 0) return SXMLExplorerSuspend;
+    return SXMLExplorerContinue;
+}
+
+static void budget_reference_log(const char* xml, BudgetLog* log) {
+    SXMLExplorer* ex = sxml_make_explorer();
+    memset(log, 0, sizeof(*log));
+    sxml_register_event_func(ex, budget_log_event, log);
+    CU_ASSERT_EQUAL(sxml_run_explorer(ex, (char*)xml), SXMLExplorerComplete);
+    sxml_destroy_explorer(ex);
+}
+
+void test_budget_bytes_resume(void) {
+    char* xml = read_file_to_string("test-data/test-sitemap.xml");
+    CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+    BudgetLog expected, actual;
+    budget_reference_log(xml, &expected);
+
+    SXMLExplorer* ex = sxml_make_explorer();
+    memset(&actual, 0, sizeof(actual));
+    sxml_register_event_func(ex, budget_log_event, &actual);
+    unsigned long pos = 0;
+    unsigned int calls = 0;
+    unsigned char ret;
+    do {
+        ret = sxml_run_explorer_budget(ex, xml + pos, 5, 0);
+        CU_ASSERT(sxml_explorer_consumed(ex) >= 5 || ret == SXMLExplorerComplete);
+        pos += sxml_explorer_consumed(ex);
+        calls++;
+    } while (ret == SXMLExplorerSuspended);
+    CU_ASSERT_EQUAL(ret, SXMLExplorerComplete);
+    CU_ASSERT_EQUAL(pos, strlen(xml));
+    CU_ASSERT(calls > 50);
+    CU_ASSERT_STRING_EQUAL(actual.text, expected.text);
+    sxml_destroy_explorer(ex);
+    free(xml);
+}
+
+void test_budget_events_resume(void) {
+    char* xml = read_file_to_string("test-data/test-rss.xml");
+    CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+    BudgetLog expected, actual;
+    budget_reference_log(xml, &expected);
+
+    SXMLExplorer* ex = sxml_make_explorer();
+    memset(&actual, 0, sizeof(actual));
+    sxml_register_event_func(ex, budget_log_event, &actual);
+    unsigned long pos = 0;
+    unsigned int suspensions = 0;
+    unsigned char ret;
+    while ((ret = sxml_run_explorer_budget(ex, xml + pos, 0, 1)) == SXMLExplorerSuspended) {
+        pos += sxml_explorer_consumed(ex);
+        suspensions++;
+        CU_ASSERT_EQUAL(actual.events, suspensions);
+    }
+    CU_ASSERT_EQUAL(ret, SXMLExplorerComplete);
+    CU_ASSERT_EQUAL(suspensions, expected.events);
+    CU_ASSERT_STRING_EQUAL(actual.text, expected.text);
+    sxml_destroy_explorer(ex);
+    free(xml);
+}
+
+void test_callback_suspend_and_offsets(void) {
+    char xml[] = "<?xml version=\"1.1\"?><tag><loc>a</loc><loc>b</loc></tag>";
+    BudgetLog log;
+    memset(&log, 0, sizeof(log));
+    log.suspend_on = "/loc";
+
+    SXMLExplorer* ex = sxml_make_explorer();
+    sxml_register_event_func(ex, budget_log_event, &log);
+    unsigned char ret = sxml_run_explorer(ex, xml);
+    CU_ASSERT_EQUAL(ret, SXMLExplorerSuspended);
+    CU_ASSERT_EQUAL(sxml_explorer_consumed(ex), strstr(xml, "</loc>") + 6 - xml);
+    unsigned long pos = sxml_explorer_consumed(ex);
+    ret = sxml_run_explorer(ex, xml + pos);
+    CU_ASSERT_EQUAL(ret, SXMLExplorerSuspended);
+    pos += sxml_explorer_consumed(ex);
+    CU_ASSERT_STRING_EQUAL(xml + pos, "</tag>");
+    CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml + pos), SXMLExplorerComplete);
+    CU_ASSERT_EQUAL(log.events, 8);
+    sxml_destroy_explorer(ex);
+
+    // Interrupted runs report their offset too
+    char xml2[] = "<?xml version=\"1.1\"?><tag></tag><rest/>";
+    simple_tag_counter = 0;
+    ex = sxml_make_explorer();
+    sxml_register_func(ex, chunked_simple_on_tag, NULL, NULL, NULL);
+    CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml2), SXMLExplorerInterrupted);
+    CU_ASSERT_STRING_EQUAL(xml2 + sxml_explorer_consumed(ex), "<rest/>");
+    sxml_destroy_explorer(ex);
+}
+
+static unsigned int suspend_tag_calls = 0;
+static unsigned char suspend_on_tag(char* name) {
+    suspend_tag_calls++;
+    return SXMLExplorerContinue;
+}
+
+static unsigned char suspend_every_tag(void* user, SXMLEventType type, char* text, unsigned int len) {
+    BudgetLog* log = user;
+    log->events++;
+    return type == SXMLEventTag ? SXMLExplorerSuspend : SXMLExplorerContinue;
+}
+
+void test_callback_suspend_with_tag_func(void) {
+    char xml[] = "<?xml version=\"1.1\"?><tag><loc>a</loc><loc>b</loc></tag>";
+    BudgetLog log;
+    unsigned long pos = 0;
+    unsigned int runs = 0;
+    unsigned char ret;
+
+    // An event func suspending on every tag still lets the tag func see each
+    memset(&log, 0, sizeof(log));
+    suspend_tag_calls = 0;
+    SXMLExplorer* ex = sxml_make_explorer();
+    sxml_register_event_func(ex, suspend_every_tag, &log);
+    sxml_register_func(ex, suspend_on_tag, NULL, NULL, NULL);
+    // The last tag ends the input, so its run completes
+    do {
+        ret = sxml_run_explorer(ex, xml + pos);
+        pos += sxml_explorer_consumed(ex);
+        runs++;
+        CU_ASSERT_EQUAL(suspend_tag_calls, runs);
+    } while (ret == SXMLExplorerSuspended);
+    CU_ASSERT_EQUAL(ret, SXMLExplorerComplete);
+    CU_ASSERT_EQUAL(pos, strlen(xml));
+    CU_ASSERT_EQUAL(runs, 6);
+    CU_ASSERT_EQUAL(suspend_tag_calls, 6);
+    CU_ASSERT_EQUAL(log.events, 8);
+    sxml_destroy_explorer(ex);
+
+    // A suspended event counts against the budget: one event per run
+    memset(&log, 0, sizeof(log));
+    suspend_tag_calls = 0;
+    pos = 0;
+    runs = 0;
+    ex = sxml_make_explorer();
+    sxml_register_event_func(ex, suspend_every_tag, &log);
+    sxml_register_func(ex, suspend_on_tag, NULL, NULL, NULL);
+    do {
+        ret = sxml_run_explorer_budget(ex, xml + pos, 0, 1);
+        pos += sxml_explorer_consumed(ex);
+        runs++;
+        CU_ASSERT_EQUAL(log.events, runs);
+    } while (ret == SXMLExplorerSuspended);
+    CU_ASSERT_EQUAL(ret, SXMLExplorerComplete);
+    CU_ASSERT_EQUAL(pos, strlen(xml));
+    // Resuming past the end reads nothing
+    CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml + pos), SXMLExplorerComplete);
+    CU_ASSERT_EQUAL(sxml_explorer_consumed(ex), 0);
+    CU_ASSERT_EQUAL(log.events, 8);
+    CU_ASSERT_EQUAL(suspend_tag_calls, 6);
+    CU_ASSERT_EQUAL(runs, 8);
+    sxml_destroy_explorer(ex);
+}
+
+void test_snapshot_restore_resume(void) {
+    char* xml = read_file_to_string("test-data/test-oss-1.xml");
+    CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+    BudgetLog expected, actual;
+    budget_reference_log(xml, &expected);
+
+    // Cut at several points, including inside the declaration, tags and content
+    unsigned long cuts[] = { 1, 7, 40, 101, 230, 400, 600 };
+    for (unsigned int i = 0; i < sizeof(cuts) / sizeof(cuts[0]); i++) {
+        SXMLExplorer* ex = sxml_make_explorer();
+        memset(&actual, 0, sizeof(actual));
+        sxml_register_event_func(ex, budget_log_event, &actual);
+        CU_ASSERT_EQUAL(sxml_run_explorer_budget(ex, xml, cuts[i], 0), SXMLExplorerSuspended);
+
+        unsigned int size = sxml_snapshot_explorer(ex, NULL, 0);
+        unsigned char* blob = malloc(size);
+        CU_ASSERT_EQUAL(sxml_snapshot_explorer(ex, blob, size), size);
+        sxml_destroy_explorer(ex);
+
+        SXMLExplorer* resumed = sxml_make_explorer();
+        sxml_register_event_func(resumed, budget_log_event, &actual);
+        CU_ASSERT_EQUAL(sxml_restore_explorer(resumed, blob, size), SXMLExplorerContinue);
+        unsigned long offset = sxml_explorer_offset(resumed);
+        CU_ASSERT(offset >= cuts[i]);
+        CU_ASSERT_EQUAL(sxml_run_explorer(resumed, xml + offset), SXMLExplorerComplete);
+        CU_ASSERT_EQUAL(sxml_explorer_offset(resumed), strlen(xml));
+        CU_ASSERT_STRING_EQUAL(actual.text, expected.text);
+        sxml_destroy_explorer(resumed);
+        free(blob);
+    }
+
+    // A clone is an independent speculation point
+    SXMLExplorer* ex = sxml_make_explorer();
+    memset(&actual, 0, sizeof(actual));
+    sxml_register_event_func(ex, budget_log_event, &actual);
+    sxml_run_explorer_budget(ex, xml, 230, 0);
+    SXMLExplorer* clone = sxml_clone_explorer(ex);
+    sxml_destroy_explorer(ex);
+    CU_ASSERT_EQUAL(sxml_run_explorer(clone, xml + sxml_explorer_offset(clone)), SXMLExplorerComplete);
+    CU_ASSERT_STRING_EQUAL(actual.text, expected.text);
+    sxml_destroy_explorer(clone);
+    free(xml);
+}
+
+static unsigned char snapshot_log_element(void* user, char* name, unsigned int len, SXMLAttribute* attrs, unsigned int count) {
+    char* log = user;
+    size_t used = strlen(log);
+    used += snprintf(log + used, 256 - used, "%.*s{", (int)len, name);
+    for (unsigned int i = 0; i < count; i++) {
+        used += snprintf(log + used, 256 - used, "%s=%s,", attrs[i].key, attrs[i].value);
+    }
+    snprintf(log + used, 256 - used, "} ");
+    return SXMLExplorerContinue;
+}
+
+void test_snapshot_with_start_element_func(void) {
+    char xml[] = "<?xml version=\"1.0\"?><r a=\"1\"><item id=\"42\">t</item><e/></r>";
+    const char* expected = "r{a=1,} item{id=42,} e{} ";
+    unsigned char blob[8192];
+    char log[256];
+
+    // Every cut, including between elements after a start tag was dispatched
+    for (unsigned long cut = 1; cut < strlen(xml); cut++) {
+        log[0] = '\0';
+        SXMLExplorer* ex = sxml_make_explorer();
+        sxml_register_start_element_func(ex, snapshot_log_element, log);
+        CU_ASSERT_EQUAL(sxml_run_explorer_budget(ex, xml, cut, 0), SXMLExplorerSuspended);
+        unsigned int size = sxml_snapshot_explorer(ex, blob, sizeof(blob));
+        CU_ASSERT_FATAL(size > 0 && size <= sizeof(blob));
+
+        SXMLExplorer* resumed = sxml_make_explorer();
+        sxml_register_start_element_func(resumed, snapshot_log_element, log);
+        CU_ASSERT_EQUAL(sxml_restore_explorer(resumed, blob, size), SXMLExplorerContinue);
+        CU_ASSERT_EQUAL(sxml_run_explorer(resumed, xml + sxml_explorer_offset(resumed)), SXMLExplorerComplete);
+        CU_ASSERT_STRING_EQUAL(log, expected);
+        sxml_destroy_explorer(resumed);
+        sxml_destroy_explorer(ex);
+    }
+}
+
+void test_snapshot_rejects_bad_blobs(void) {
+    unsigned char blob[64];
+    SXMLExplorer* ex = sxml_make_explorer();
+    sxml_run_explorer(ex, "<?xml version=\"1.0\"?><ro");
+    unsigned int size = sxml_snapshot_explorer(ex, blob, sizeof(blob));
+    CU_ASSERT(size > 0 && size <= sizeof(blob));
+    CU_ASSERT_EQUAL(sxml_snapshot_explorer(ex, blob, 3), size);
+
+    SXMLExplorer* other = sxml_make_explorer();
+    CU_ASSERT_EQUAL(sxml_restore_explorer(other, blob, size - 1), SXMLExplorerErrorMalformedXML);
+    unsigned char version = blob[3];
+    blob[3] = 0x7F;
+    CU_ASSERT_EQUAL(sxml_restore_explorer(other, blob, size), SXMLExplorerErrorMalformedXML);
+    blob[3] = version;
+    CU_ASSERT_EQUAL(sxml_restore_explorer(other, blob, size), SXMLExplorerContinue);
+    sxml_destroy_explorer(other);
+    sxml_destroy_explorer(ex);
+}
+
 void add_chunked_tests(CU_pSuite* suite) {
     CU_add_test(*suite, "Chunked simple XML", test_chunked_simple_xml);
     CU_add_test(*suite, "Chunked attributes", test_chunked_attributes);
     CU_add_test(*suite, "Chunked comments", test_chunked_comments);
     CU_add_test(*suite, "Chunked sitemap", test_chunked_sitemap);
+    CU_add_test(*suite, "Byte-budgeted parsing resumes exactly", test_budget_bytes_resume);
+    CU_add_test(*suite, "Event-budgeted parsing resumes exactly", test_budget_events_resume);
+    CU_add_test(*suite, "Callback suspension and resume offsets", test_callback_suspend_and_offsets);
+    CU_add_test(*suite, "Callback suspension with per-type funcs", test_callback_suspend_with_tag_func);
+    CU_add_test(*suite, "Snapshot, restore and clone resume", test_snapshot_restore_resume);
+    CU_add_test(*suite, "Snapshot with a start element func", test_snapshot_with_start_element_func);
+    CU_add_test(*suite, "Snapshot rejects bad blobs", test_snapshot_rejects_bad_blobs);
 }
 
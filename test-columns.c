@@ -0,0 +1,213 @@
+#include <CUnit/CUnit.h>
+#include <CUnit/Basic.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sparsexml.h"
+#include "sparsexml-columns.h"
+
+/*
+ * Columnar extraction tests: rows collected into typed column batches in
+ * the Arrow layout.
+ */
+
+static char* columns_read_file(const char* filename) {
+  FILE* f = fopen(filename, "rb");
+  if (!f) return NULL;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  rewind(f);
+  char* buffer = malloc(size + 1);
+  if (!buffer) { fclose(f); return NULL; }
+  size_t r = fread(buffer, 1, size, f);
+  buffer[r] = '\0';
+  fclose(f);
+  return buffer;
+}
+
+// Rows of every batch, rebuilt from the column buffers
+typedef struct {
+  unsigned int batches;
+  unsigned int rows;
+  unsigned int lengths[8];
+  unsigned int stop_after;  // Batches before answering Stop, 0 for never
+  char ids[256];            // Text column 0, joined by ' ' ("-" for null)
+  long long years[8];
+  double audiobooks[8];
+  unsigned char audiobook_valid[8];
+  unsigned char available[8];
+  long long reviewed[8];
+  unsigned int series_nulls;
+} BookColumns;
+
+static unsigned char columns_valid(const SXMLColumn* column, unsigned int row) {
+  return (column->validity[row / 8] >> (row % 8)) & 1;
+}
+
+static unsigned char columns_log_batch(void* user, const SXMLColumnBatch* batch) {
+  BookColumns* log = user;
+  const SXMLColumn* c = batch->columns;
+  const int* offsets = c[0].values;
+  unsigned int row;
+
+  CU_ASSERT_EQUAL(batch->column_count, 6);
+  CU_ASSERT_EQUAL(c[0].type, SXMLBindText);
+  CU_ASSERT_EQUAL(offsets[0], 0);
+  CU_ASSERT_EQUAL((unsigned int)offsets[batch->length], c[0].data_len);
+  CU_ASSERT_PTR_NULL(c[1].data);
+  for (row = 0; row < batch->length && log->rows < 8; row++, log->rows++) {
+    size_t used = strlen(log->ids);
+    if (columns_valid(&c[0], row)) {
+      snprintf(log->ids + used, sizeof(log->ids) - used, "%.*s ", offsets[row + 1] - offsets[row], c[0].data + offsets[row]);
+    } else {
+      snprintf(log->ids + used, sizeof(log->ids) - used, "- ");
+    }
+    log->years[log->rows] = ((const long long*)c[1].values)[row];
+    log->audiobooks[log->rows] = ((const double*)c[2].values)[row];
+    log->audiobook_valid[log->rows] = columns_valid(&c[2], row);
+    log->available[log->rows] = (((const unsigned char*)c[3].values)[row / 8] >> (row % 8)) & 1;
+    log->reviewed[log->rows] = ((const long long*)c[4].values)[row];
+  }
+  log->series_nulls += c[5].null_count;
+  log->lengths[log->batches < 8 ? log->batches : 7] = batch->length;
+  log->batches++;
+  return log->stop_after != 0 && log->batches >= log->stop_after ? SXMLExplorerStop : SXMLExplorerContinue;
+}
+
+static SXMLColumns* columns_books(SXMLExplorer* ex, unsigned int rows, BookColumns* log) {
+  SXMLColumns* c = sxml_make_columns(ex, "/library/books/book", rows);
+  if (c == NULL) return NULL;
+  CU_ASSERT_EQUAL(sxml_add_column(c, "@id", SXMLBindText), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_add_column(c, "publication/year", SXMLBindInt), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_add_column(c, "availability/format[@type='audiobook']/@price", SXMLBindDouble), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_add_column(c, "@available", SXMLBindBool), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_add_column(c, "reviews/review/date", SXMLBindTimestamp), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_add_column(c, "series", SXMLBindText), SXMLExplorerContinue);
+  sxml_columns_register_batch_func(c, columns_log_batch, log);
+  return c;
+}
+
+void test_columns_books(void) {
+  char* xml = columns_read_file("test-data/test-large-document.xml");
+  BookColumns log;
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  memset(&log, 0, sizeof(log));
+
+  // Batches of two rows: two full ones during the run, the rest on flush
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLColumns* c = columns_books(ex, 2, &log);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(c);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(log.batches, 2);
+  CU_ASSERT_EQUAL(sxml_columns_flush(c), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_columns_flush(c), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(log.batches, 3);
+  CU_ASSERT_EQUAL(log.lengths[2], 1);
+
+  CU_ASSERT_FATAL(log.rows == 5);
+  CU_ASSERT_STRING_EQUAL(log.ids, "book001 book002 book003 book004 book005 ");
+  CU_ASSERT_EQUAL(log.years[0], 2023);
+  CU_ASSERT_EQUAL(log.years[4], 2024);
+  CU_ASSERT(log.audiobook_valid[0] && log.audiobooks[0] == 24.95);
+  CU_ASSERT(!log.audiobook_valid[1] && log.audiobooks[1] == 0);
+  CU_ASSERT(!log.audiobook_valid[2]);
+  CU_ASSERT(log.audiobook_valid[3] && log.audiobooks[3] == 22.95);
+  CU_ASSERT_EQUAL(log.available[0], 1);
+  CU_ASSERT_EQUAL(log.available[2], 0);
+  CU_ASSERT_EQUAL(log.reviewed[0], 1702598400LL);
+  CU_ASSERT_EQUAL(log.reviewed[3], 1704844800LL);
+  CU_ASSERT_EQUAL(log.series_nulls, 5);
+
+  sxml_destroy_columns(c);
+  sxml_destroy_explorer(ex);
+
+  // One batch for the whole document, and a batch func that stops the run
+  memset(&log, 0, sizeof(log));
+  ex = sxml_make_explorer();
+  c = columns_books(ex, 0, &log);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(c);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(log.batches, 0);
+  CU_ASSERT_EQUAL(sxml_columns_flush(c), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(log.lengths[0], 5);
+  sxml_destroy_columns(c);
+  sxml_destroy_explorer(ex);
+
+  memset(&log, 0, sizeof(log));
+  log.stop_after = 1;
+  ex = sxml_make_explorer();
+  c = columns_books(ex, 1, &log);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(c);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerInterrupted);
+  CU_ASSERT_EQUAL(log.batches, 1);
+  CU_ASSERT_STRING_EQUAL(log.ids, "book001 ");
+  sxml_destroy_columns(c);
+  sxml_destroy_explorer(ex);
+  free(xml);
+}
+
+typedef struct {
+  unsigned int rows;
+  unsigned long long text_bytes;
+  unsigned long long sum;
+  unsigned int nulls;
+} CountColumns;
+
+static unsigned char columns_count_batch(void* user, const SXMLColumnBatch* batch) {
+  CountColumns* count = user;
+  const SXMLColumn* c = batch->columns;
+  unsigned int row;
+  count->rows += batch->length;
+  count->text_bytes += c[0].data_len;
+  count->nulls += c[1].null_count;
+  for (row = 0; row < batch->length; row++) {
+    count->sum += ((const long long*)c[1].values)[row];
+  }
+  return SXMLExplorerContinue;
+}
+
+void test_columns_batches(void) {
+  unsigned int records = 10000, i;
+  char* xml = malloc(records * 64 + 64);
+  size_t used = 0;
+  CountColumns count;
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  memset(&count, 0, sizeof(count));
+
+  used += sprintf(xml + used, "<log>");
+  for (i = 0; i < records; i++) {
+    if (i % 10 == 0) {
+      used += sprintf(xml + used, "<hit><path>/p%u</path></hit>", i);
+    } else {
+      used += sprintf(xml + used, "<hit><path>/p%u</path><bytes>%u</bytes></hit>", i, i);
+    }
+  }
+  sprintf(xml + used, "</log>");
+
+  // Text data grows past its first allocation within a batch
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLColumns* c = sxml_make_columns(ex, "/log/hit", 3000);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(c);
+  CU_ASSERT_EQUAL(sxml_add_column(c, "path", SXMLBindText), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_add_column(c, "bytes", SXMLBindInt), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_add_column(c, "bytes", 0x7F), SXMLExplorerErrorMalformedXML);
+  CU_ASSERT_EQUAL(sxml_add_column(c, "a[@x=", SXMLBindInt), SXMLExplorerErrorMalformedXML);
+  sxml_columns_register_batch_func(c, columns_count_batch, &count);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  // Columns are fixed while rows are pending
+  CU_ASSERT_EQUAL(sxml_add_column(c, "more", SXMLBindInt), SXMLExplorerErrorBufferOverflow);
+  CU_ASSERT_EQUAL(sxml_columns_flush(c), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(count.rows, records);
+  CU_ASSERT_EQUAL(count.nulls, records / 10);
+  CU_ASSERT_EQUAL(count.sum, (unsigned long long)records * (records - 1) / 2 - 10ull * (records / 10) * (records / 10 - 1) / 2);
+  CU_ASSERT_EQUAL(count.text_bytes, 58890ull);
+  sxml_destroy_columns(c);
+  sxml_destroy_explorer(ex);
+  free(xml);
+}
+
+void add_columns_tests(CU_pSuite* suite) {
+  CU_add_test(*suite, "Columns from books", test_columns_books);
+  CU_add_test(*suite, "Column batches", test_columns_batches);
+}
@@ -0,0 +1,1101 @@
+#include <CUnit/CUnit.h>
+#include <CUnit/Basic.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sparsexml.h"
+#include "sparsexml-priv.h"
+
+/*
+ * Element dispatch tests: interned names, compiled handlers and the
+ * structural views built on top of the explorer.
+ */
+
+static char* dispatch_read_file(const char* filename) {
+  FILE* f = fopen(filename, "rb");
+  if (!f) return NULL;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  rewind(f);
+  char* str = (char*)malloc(size + 1);
+  if (!str) { fclose(f); return NULL; }
+  fread(str, 1, size, f);
+  str[size] = '\0';
+  fclose(f);
+  return str;
+}
+
+// =============================================================================
+// NAME SYMBOLS
+// =============================================================================
+
+typedef struct {
+  SXMLExplorer* explorer;
+  unsigned int url, loc, lastmod;
+  unsigned int starts[4];
+  unsigned int ends[4];
+  unsigned int unknown;
+  char log[512];
+} NameLog;
+
+static unsigned char name_count_sitemap(void* user, SXMLEventType type, unsigned int id, char* name, unsigned int len) {
+  NameLog* log = user;
+  unsigned int slot = id == log->url ? 1 : id == log->loc ? 2 : id == log->lastmod ? 3 : 0;
+  if (id == SXMLNameUnknown) {
+    log->unknown++;
+  }
+  if (type == SXMLEventTag) {
+    log->starts[slot]++;
+  } else if (type == SXMLEventEndTag) {
+    log->ends[slot]++;
+  }
+  return SXMLExplorerContinue;
+}
+
+static unsigned char name_log_event(void* user, SXMLEventType type, unsigned int id, char* name, unsigned int len) {
+  NameLog* log = user;
+  size_t used = strlen(log->log);
+  const char* kind = type == SXMLEventTag ? "+" : type == SXMLEventEndTag ? "-" : "@";
+  snprintf(log->log + used, sizeof(log->log) - used, "%s%.*s=%s ", kind, (int)len, name,
+           id == SXMLNameUnknown ? "?" : sxml_name(log->explorer, id));
+  return SXMLExplorerContinue;
+}
+
+void test_registered_names(void) {
+  char* xml = dispatch_read_file("test-data/test-sitemap.xml");
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  static NameLog log;
+  memset(&log, 0, sizeof(log));
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  log.url = sxml_register_name(ex, "url");
+  log.loc = sxml_register_name(ex, "loc");
+  log.lastmod = sxml_register_name(ex, "lastmod");
+  CU_ASSERT(log.url != SXMLNameUnknown && log.loc != log.url && log.lastmod != log.loc);
+  CU_ASSERT_EQUAL(sxml_register_name(ex, "loc"), log.loc);
+  CU_ASSERT_STRING_EQUAL(sxml_name(ex, log.lastmod), "lastmod");
+
+  sxml_register_name_func(ex, name_count_sitemap, &log);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(log.starts[1], 1);
+  CU_ASSERT_EQUAL(log.starts[2], 1);
+  CU_ASSERT_EQUAL(log.starts[2], log.ends[2]);
+  CU_ASSERT_EQUAL(log.starts[3], log.ends[3]);
+  // urlset, xmlns and everything else not registered share the sentinel
+  CU_ASSERT_EQUAL(log.starts[0], 3);
+  CU_ASSERT_EQUAL(log.starts[0] + log.ends[0] + 1, log.unknown);
+
+  sxml_destroy_explorer(ex);
+  free(xml);
+}
+
+void test_interned_names(void) {
+  char xml[] = "<?xml version=\"1.0\"?><r a=\"1\"><e/><e b=\"2\"/><e c=\"3\" /><f>x</f></r>";
+  static NameLog log;
+  memset(&log, 0, sizeof(log));
+
+  log.explorer = sxml_make_explorer();
+  sxml_enable_name_interning(log.explorer, 1);
+  sxml_register_name_func(log.explorer, name_log_event, &log);
+  CU_ASSERT_EQUAL(sxml_run_explorer(log.explorer, xml), SXMLExplorerComplete);
+  // Empty elements in every spelling get an end event with the element name
+  CU_ASSERT_STRING_EQUAL(log.log,
+    "+r=r @a=a +e=e -e=e +e=e @b=b -e=e +e=e @c=c -e=e +f=f -f=f -r=r ");
+
+  // Ids handed out on first sight stay stable
+  unsigned int e = sxml_register_name(log.explorer, "e");
+  CU_ASSERT_STRING_EQUAL(sxml_name(log.explorer, e), "e");
+  CU_ASSERT_PTR_NULL(sxml_name(log.explorer, SXMLNameUnknown));
+
+  sxml_destroy_explorer(log.explorer);
+}
+
+// =============================================================================
+// ELEMENT HANDLERS
+// =============================================================================
+
+typedef struct {
+  unsigned int starts, ends, calls;
+  char text[256];
+} ElementLog;
+
+static unsigned char element_log_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+  ElementLog* log = user;
+  size_t used = strlen(log->text);
+  const char* kind = type == SXMLEventTag ? "+" : type == SXMLEventEndTag ? "-" :
+                     type == SXMLEventAttributeKey ? "@" : type == SXMLEventAttributeValue ? "=" : "";
+  log->calls++;
+  if (type == SXMLEventTag) log->starts++;
+  if (type == SXMLEventEndTag) log->ends++;
+  snprintf(log->text + used, sizeof(log->text) - used, "%s%.*s|", kind, (int)len, text);
+  return SXMLExplorerContinue;
+}
+
+static unsigned char element_stop(void* user, SXMLEventType type, char* text, unsigned int len) {
+  ElementLog* log = user;
+  element_log_event(user, type, text, len);
+  return log->starts == 2 ? SXMLExplorerStop : SXMLExplorerContinue;
+}
+
+void test_element_handlers_sitemap(void) {
+  char* xml = dispatch_read_file("test-data/test-sitemap.xml");
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  ElementLog loc, lastmod;
+  memset(&loc, 0, sizeof(loc));
+  memset(&lastmod, 0, sizeof(lastmod));
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  CU_ASSERT_EQUAL(sxml_on_element(ex, "loc", element_log_event, &loc), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_on_element(ex, "lastmod", element_log_event, &lastmod), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(loc.text, "+loc|http://www.example.com/|-loc|");
+  CU_ASSERT_STRING_EQUAL(lastmod.text, "+lastmod|2005-01-01|-lastmod|");
+
+  sxml_destroy_explorer(ex);
+  free(xml);
+}
+
+void test_element_handlers_rss(void) {
+  char* xml = dispatch_read_file("test-data/test-rss.xml");
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  ElementLog title, guid, item;
+  memset(&title, 0, sizeof(title));
+  memset(&guid, 0, sizeof(guid));
+  memset(&item, 0, sizeof(item));
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_on_element(ex, "title", element_log_event, &title);
+  sxml_on_element(ex, "guid", element_log_event, &guid);
+  sxml_on_element(ex, "item", element_log_event, &item);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+
+  CU_ASSERT_STRING_EQUAL(title.text, "+title|RSS Title|-title|+title|Example entry|-title|");
+  CU_ASSERT_STRING_EQUAL(guid.text,
+    "+guid|@isPermaLink|=false|7bd204c6-1655-4c27-aeee-53f933c5395f|-guid|");
+  // An element sees its own text only, here the whitespace between children
+  CU_ASSERT_EQUAL(item.starts, 1);
+  CU_ASSERT_EQUAL(item.ends, 1);
+  CU_ASSERT_PTR_NULL(strstr(item.text, "Example"));
+
+  sxml_destroy_explorer(ex);
+  free(xml);
+}
+
+void test_element_handlers_control(void) {
+  char xml[] = "<?xml version=\"1.0\"?><r><e a=\"1\"/><x><e/></x><e>t</e></r>";
+  ElementLog log;
+  memset(&log, 0, sizeof(log));
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_on_element(ex, "e", element_stop, &log);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerInterrupted);
+  CU_ASSERT_STRING_EQUAL(log.text, "+e|@a|=1|-e|+e|");
+  sxml_destroy_explorer(ex);
+
+  // Replacing a handler keeps one slot per name
+  memset(&log, 0, sizeof(log));
+  ex = sxml_make_explorer();
+  sxml_on_element(ex, "e", element_stop, &log);
+  sxml_on_element(ex, "e", element_log_event, &log);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(log.text, "+e|@a|=1|-e|+e|-e|+e|t|-e|");
+  sxml_destroy_explorer(ex);
+}
+
+void test_element_handlers_restore(void) {
+  char* xml = dispatch_read_file("test-data/test-sitemap.xml");
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  ElementLog loc;
+  unsigned char blob[4096];
+  unsigned int len;
+  memset(&loc, 0, sizeof(loc));
+
+  // Different registration order gives "loc" a different id in each explorer
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_on_element(ex, "lastmod", element_log_event, &loc);
+  sxml_on_element(ex, "loc", element_log_event, &loc);
+  CU_ASSERT_EQUAL(sxml_run_explorer_budget(ex, xml, 0, 4), SXMLExplorerSuspended);
+  len = sxml_snapshot_explorer(ex, blob, sizeof(blob));
+  CU_ASSERT_FATAL(len > 0 && len <= sizeof(blob));
+
+  SXMLExplorer* resumed = sxml_make_explorer();
+  sxml_on_element(resumed, "loc", element_log_event, &loc);
+  CU_ASSERT_EQUAL(sxml_restore_explorer(resumed, blob, len), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_run_explorer(resumed, xml + sxml_explorer_consumed(ex)), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(loc.text, "+loc|http://www.example.com/|-loc|");
+
+  sxml_destroy_explorer(ex);
+  sxml_destroy_explorer(resumed);
+  free(xml);
+}
+
+// =============================================================================
+// ELEMENT PATH
+// =============================================================================
+
+typedef struct {
+  SXMLExplorer* explorer;
+  char log[512];
+} PathLog;
+
+static unsigned char path_log_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+  PathLog* log = user;
+  size_t used = strlen(log->log);
+  unsigned int path_len;
+  const char* path = sxml_element_path(log->explorer, &path_len);
+  if (type == SXMLEventContent || type == SXMLEventAttributeValue) {
+    CU_ASSERT_EQUAL(path_len, strlen(path));
+    snprintf(log->log + used, sizeof(log->log) - used, "%s[%u]=%s ", path, sxml_element_depth(log->explorer), text);
+  }
+  return SXMLExplorerContinue;
+}
+
+void test_element_path(void) {
+  char xml[] = "<?xml version=\"1.0\"?><rss v=\"2\"><channel><item id=\"1\"><title>A</title></item>"
+               "<item id=\"2\"/><title>B</title></channel></rss>";
+  static PathLog log;
+  memset(&log, 0, sizeof(log));
+
+  log.explorer = sxml_make_explorer();
+  sxml_enable_element_path(log.explorer, 1);
+  sxml_register_event_func(log.explorer, path_log_event, &log);
+  CU_ASSERT_EQUAL(sxml_run_explorer(log.explorer, xml), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(log.log,
+    "rss[1]=2 rss/channel/item[3]=1 rss/channel/item/title[4]=A rss/channel/item[3]=2 rss/channel/title[3]=B ");
+  CU_ASSERT_EQUAL(sxml_element_depth(log.explorer), 0);
+  CU_ASSERT_STRING_EQUAL(sxml_element_path(log.explorer, NULL), "");
+
+  sxml_destroy_explorer(log.explorer);
+}
+
+void test_element_path_symbols(void) {
+  char xml[] = "<a><b><c>x</c></b></a>";
+  char part1[] = "<a><b><c>";
+  unsigned char blob[2048];
+  unsigned int len;
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  unsigned int a = sxml_register_name(ex, "a");
+  unsigned int c = sxml_register_name(ex, "c");
+  sxml_enable_element_path(ex, 1);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, part1), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(sxml_element_depth(ex), 3);
+  CU_ASSERT_EQUAL(sxml_element_at(ex, 0), a);
+  CU_ASSERT_EQUAL(sxml_element_at(ex, 1), SXMLNameUnknown);  // Only registered names have ids
+  CU_ASSERT_EQUAL(sxml_element_at(ex, 2), c);
+  CU_ASSERT_EQUAL(sxml_element_at(ex, 3), SXMLNameUnknown);
+
+  // The stack and the path travel with snapshots
+  len = sxml_snapshot_explorer(ex, blob, sizeof(blob));
+  CU_ASSERT_FATAL(len > 0 && len <= sizeof(blob));
+  SXMLExplorer* resumed = sxml_make_explorer();
+  CU_ASSERT_EQUAL(sxml_restore_explorer(resumed, blob, len), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_element_depth(resumed), 3);
+  CU_ASSERT_STRING_EQUAL(sxml_element_path(resumed, NULL), "a/b/c");
+  CU_ASSERT_EQUAL(sxml_run_explorer(resumed, xml + strlen(part1)), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(sxml_element_depth(resumed), 0);
+
+  sxml_destroy_explorer(ex);
+  sxml_destroy_explorer(resumed);
+}
+
+void test_element_max_depth(void) {
+  char deep[] = "<a><b><c><d/></c></b></a>";
+  char xml[sizeof(deep)];
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_enable_element_path(ex, 1);
+  sxml_set_max_depth(ex, 3);
+  memcpy(xml, deep, sizeof(deep));
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerErrorBufferOverflow);
+  sxml_destroy_explorer(ex);
+
+  ex = sxml_make_explorer();
+  sxml_enable_element_path(ex, 1);
+  sxml_set_max_depth(ex, 4);
+  memcpy(xml, deep, sizeof(deep));
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  sxml_destroy_explorer(ex);
+}
+
+// =============================================================================
+// ATTRIBUTE BATCHES
+// =============================================================================
+
+typedef struct {
+  unsigned int calls;
+  char log[512];
+} BatchLog;
+
+static unsigned char batch_log_element(void* user, char* name, unsigned int len, SXMLAttribute* attrs, unsigned int count) {
+  BatchLog* log = user;
+  size_t used = strlen(log->log);
+  CU_ASSERT_EQUAL(len, strlen(name));
+  log->calls++;
+  used += snprintf(log->log + used, sizeof(log->log) - used, "%s{", name);
+  for (unsigned int i = 0; i < count && used < sizeof(log->log); i++) {
+    CU_ASSERT_EQUAL(attrs[i].key_len, strlen(attrs[i].key));
+    CU_ASSERT_EQUAL(attrs[i].value_len, strlen(attrs[i].value));
+    used += snprintf(log->log + used, sizeof(log->log) - used, "%s%s=%s", i ? "," : "", attrs[i].key, attrs[i].value);
+  }
+  if (used < sizeof(log->log)) {
+    snprintf(log->log + used, sizeof(log->log) - used, "} ");
+  }
+  return SXMLExplorerContinue;
+}
+
+void test_attribute_batches(void) {
+  char xml[] = "<?xml version=\"1.0\"?><r a=\"1\" b=\"\" c=\"x&amp;y\"><e k=\"v\"/><f/>"
+               "<g  m=\"2\" /><h>t</h></r>";
+  BatchLog log;
+  memset(&log, 0, sizeof(log));
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_enable_entity_processing(ex, 1);
+  sxml_register_start_element_func(ex, batch_log_element, &log);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(log.log, "r{a=1,b=,c=x&y} e{k=v} f{} g{m=2} h{} ");
+  CU_ASSERT_EQUAL(log.calls, 5);
+  sxml_destroy_explorer(ex);
+}
+
+void test_attribute_batch_limits(void) {
+  char xml[2048];
+  BatchLog log;
+  unsigned int used;
+
+  for (unsigned int count = SXMLAttributeMax; count <= SXMLAttributeMax + 1; count++) {
+    used = snprintf(xml, sizeof(xml), "<r");
+    for (unsigned int i = 0; i < count; i++) {
+      used += snprintf(xml + used, sizeof(xml) - used, " a%u=\"%u\"", i, i);
+    }
+    snprintf(xml + used, sizeof(xml) - used, "/>");
+    memset(&log, 0, sizeof(log));
+
+    SXMLExplorer* ex = sxml_make_explorer();
+    sxml_register_start_element_func(ex, batch_log_element, &log);
+    CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml),
+                    count <= SXMLAttributeMax ? SXMLExplorerComplete : SXMLExplorerErrorBufferOverflow);
+    CU_ASSERT_EQUAL(log.calls, count <= SXMLAttributeMax ? 1 : 0);
+    sxml_destroy_explorer(ex);
+  }
+}
+
+void test_attribute_batch_resume(void) {
+  char xml[] = "<?xml version=\"1.0\"?><r><item id=\"42\" lang=\"en\" kind=\"x\">t</item></r>";
+  unsigned char blob[8192];
+  unsigned int len;
+  BatchLog log;
+  memset(&log, 0, sizeof(log));
+
+  // Stop inside the attribute list of <item>
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_register_start_element_func(ex, batch_log_element, &log);
+  CU_ASSERT_EQUAL(sxml_run_explorer_budget(ex, xml, strstr(xml, "lang") - xml, 0), SXMLExplorerSuspended);
+  len = sxml_snapshot_explorer(ex, blob, sizeof(blob));
+  CU_ASSERT_FATAL(len > 0 && len <= sizeof(blob));
+
+  SXMLExplorer* resumed = sxml_make_explorer();
+  sxml_register_start_element_func(resumed, batch_log_element, &log);
+  CU_ASSERT_EQUAL(sxml_restore_explorer(resumed, blob, len), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_run_explorer(resumed, xml + sxml_explorer_consumed(ex)), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(log.log, "r{} item{id=42,lang=en,kind=x} ");
+
+  sxml_destroy_explorer(ex);
+  sxml_destroy_explorer(resumed);
+}
+
+// =============================================================================
+// LAZY ATTRIBUTES
+// =============================================================================
+
+typedef struct {
+  SXMLExplorer* explorer;
+  unsigned int attribute_events;
+  char log[512];
+} LazyLog;
+
+static unsigned char lazy_log_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+  LazyLog* log = user;
+  size_t used = strlen(log->log);
+  SXMLAttribute attr;
+
+  if (type == SXMLEventAttributeKey || type == SXMLEventAttributeValue) {
+    log->attribute_events++;
+  }
+  if (type != SXMLEventTag) {
+    return SXMLExplorerContinue;
+  }
+  used += snprintf(log->log + used, sizeof(log->log) - used, "%s", text);
+  // Only <item> pays for attribute parsing
+  if (strcmp(text, "item") == 0) {
+    unsigned int cursor = 0;
+    if (sxml_attr_find(log->explorer, "title", &attr)) {
+      used += snprintf(log->log + used, sizeof(log->log) - used, "(title=%.*s)", (int)attr.value_len, attr.value);
+    }
+    while (sxml_attr_next(log->explorer, &cursor, &attr)) {
+      used += snprintf(log->log + used, sizeof(log->log) - used, "[%.*s=%.*s]",
+                       (int)attr.key_len, attr.key, (int)attr.value_len, attr.value);
+    }
+  }
+  snprintf(log->log + used, sizeof(log->log) - used, " ");
+  return SXMLExplorerContinue;
+}
+
+void test_lazy_attributes(void) {
+  char xml[] = "<?xml version=\"1.0\"?><r><item id=\"1\" lang='en' title=\"a > b\"/>"
+               "<skip a=\"1\" b=\"2\">x</skip><item  id = \"2\" >y</item></r>";
+  static LazyLog log;
+  memset(&log, 0, sizeof(log));
+
+  log.explorer = sxml_make_explorer();
+  sxml_enable_lazy_attributes(log.explorer, 1);
+  sxml_register_event_func(log.explorer, lazy_log_event, &log);
+  CU_ASSERT_EQUAL(sxml_run_explorer(log.explorer, xml), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(log.log,
+    "r item(title=a > b)[id=1][lang=en][title=a > b] / skip /skip item[id=2] /item /r ");
+  CU_ASSERT_EQUAL(log.attribute_events, 0);
+  CU_ASSERT_PTR_NULL(sxml_attr_region(log.explorer, NULL));
+
+  sxml_destroy_explorer(log.explorer);
+}
+
+typedef struct {
+  unsigned int uris[4];
+  unsigned int count;
+} LazyNamespaces;
+
+static unsigned char lazy_namespace(void* user, unsigned int uri, char* local, unsigned int len, unsigned char end) {
+  LazyNamespaces* ns = user;
+  if (!end && ns->count < 4) {
+    ns->uris[ns->count++] = uri;
+  }
+  return SXMLExplorerContinue;
+}
+
+void test_lazy_attributes_consumers(void) {
+  char xml[] = "<?xml version=\"1.0\"?><a xmlns=\"urn:x\" xmlns:p=\"urn:p\"><p:b k=\"v&amp;w\"/><c/></a>";
+  LazyNamespaces ns;
+  BatchLog batch;
+  memset(&ns, 0, sizeof(ns));
+  memset(&batch, 0, sizeof(batch));
+
+  // xmlns bindings and batches are cut from the raw section
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_enable_lazy_attributes(ex, 1);
+  sxml_enable_namespace_processing(ex, 1);
+  sxml_register_namespace_func(ex, lazy_namespace, &ns);
+  sxml_register_start_element_func(ex, batch_log_element, &batch);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(ns.count, 3);
+  CU_ASSERT_STRING_EQUAL(sxml_namespace_uri(ex, ns.uris[0]), "urn:x");
+  CU_ASSERT_STRING_EQUAL(sxml_namespace_uri(ex, ns.uris[1]), "urn:p");
+  CU_ASSERT_STRING_EQUAL(sxml_namespace_uri(ex, ns.uris[2]), "urn:x");
+  CU_ASSERT_STRING_EQUAL(batch.log, "a{xmlns=urn:x,xmlns:p=urn:p} p:b{k=v&amp;w} c{} ");
+  sxml_destroy_explorer(ex);
+}
+
+void test_lazy_attributes_resume(void) {
+  char xml[] = "<?xml version=\"1.0\"?><r><item id=\"1\" title=\"a > b\">t</item></r>";
+  unsigned char blob[8192];
+  unsigned int len;
+  static LazyLog log;
+  memset(&log, 0, sizeof(log));
+
+  // Suspend inside the quoted '>' so the quote state must travel too
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_enable_lazy_attributes(ex, 1);
+  CU_ASSERT_EQUAL(sxml_run_explorer_budget(ex, xml, strchr(strstr(xml, "title"), '>') - xml, 0), SXMLExplorerSuspended);
+  len = sxml_snapshot_explorer(ex, blob, sizeof(blob));
+  CU_ASSERT_FATAL(len > 0 && len <= sizeof(blob));
+
+  log.explorer = sxml_make_explorer();
+  sxml_register_event_func(log.explorer, lazy_log_event, &log);
+  CU_ASSERT_EQUAL(sxml_restore_explorer(log.explorer, blob, len), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_run_explorer(log.explorer, xml + sxml_explorer_consumed(ex)), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(log.log, "item(title=a > b)[id=1][title=a > b] /item /r ");
+
+  sxml_destroy_explorer(ex);
+  sxml_destroy_explorer(log.explorer);
+}
+
+// =============================================================================
+// TAG SCAN
+// =============================================================================
+
+typedef struct {
+  unsigned int tags, attributes, others;
+  unsigned long hash;      // Order-sensitive digest of tag and attribute text
+} ScanDigest;
+
+static unsigned char scan_digest_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+  ScanDigest* digest = user;
+  if (type == SXMLEventTag) {
+    digest->tags++;
+  } else if (type == SXMLEventAttributeKey || type == SXMLEventAttributeValue) {
+    digest->attributes++;
+  } else {
+    digest->others++;
+    return SXMLExplorerContinue;
+  }
+  for (unsigned int i = 0; i < len; i++) {
+    digest->hash = digest->hash * 31 + (unsigned char)text[i];
+  }
+  digest->hash = digest->hash * 31 + type;
+  return SXMLExplorerContinue;
+}
+
+static unsigned char scan_file(const char* path, unsigned char tag_scan, unsigned long step, ScanDigest* digest) {
+  char* xml = dispatch_read_file(path);
+  unsigned long pos = 0;
+  unsigned char result;
+  if (xml == NULL) return SXMLExplorerErrorMalformedXML;
+  memset(digest, 0, sizeof(*digest));
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_enable_tag_scan(ex, tag_scan);
+  sxml_register_event_func(ex, scan_digest_event, digest);
+  do {
+    result = sxml_run_explorer_budget(ex, xml + pos, step, 0);
+    pos += sxml_explorer_consumed(ex);
+  } while (result == SXMLExplorerSuspended);
+  sxml_destroy_explorer(ex);
+  free(xml);
+  return result;
+}
+
+void test_tag_scan(void) {
+  char xml[] = "<?xml version=\"1.0\"?><r a=\"1\">text &bogus; <!-- <no> - -- --><b>x</b>"
+               "<![CDATA[<fake> ]] ]>]]><c k=\"v\"/>tail</r>";
+  static LazyLog log;
+  memset(&log, 0, sizeof(log));
+
+  // Content is never looked at, so a bad reference cannot fail the scan
+  log.explorer = sxml_make_explorer();
+  sxml_enable_entity_processing(log.explorer, 1);
+  sxml_enable_tag_scan(log.explorer, 1);
+  sxml_register_event_func(log.explorer, lazy_log_event, &log);
+  CU_ASSERT_EQUAL(sxml_run_explorer(log.explorer, xml), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(log.log, "r b /b c / /r ");
+  CU_ASSERT_EQUAL(log.attribute_events, 4);
+  sxml_destroy_explorer(log.explorer);
+}
+
+void test_tag_scan_matches_full_parse(void) {
+  const char* files[] = { "test-data/test-oss-1.xml", "test-data/test-with-comments.xml",
+                          "test-data/test-with-cdata.xml", "test-data/test-rss.xml" };
+  ScanDigest full, scan, stepped;
+
+  for (unsigned int i = 0; i < sizeof(files) / sizeof(files[0]); i++) {
+    CU_ASSERT_EQUAL(scan_file(files[i], 0, 0, &full), SXMLExplorerComplete);
+    CU_ASSERT_EQUAL(scan_file(files[i], 1, 0, &scan), SXMLExplorerComplete);
+    CU_ASSERT_EQUAL(scan_file(files[i], 1, 97, &stepped), SXMLExplorerComplete);
+    CU_ASSERT(full.tags > 0);
+    CU_ASSERT_EQUAL(scan.tags, full.tags);
+    CU_ASSERT_EQUAL(scan.attributes, full.attributes);
+    CU_ASSERT_EQUAL(scan.hash, full.hash);
+    CU_ASSERT_EQUAL(scan.others, 0);
+    CU_ASSERT_EQUAL(stepped.hash, full.hash);
+  }
+}
+
+// =============================================================================
+// SUBTREE SKIP
+// =============================================================================
+
+typedef struct {
+  SXMLExplorer* explorer;
+  const char* skip;        // Tag name whose start tag answers Skip
+  unsigned char tags_only;
+  char log[512];
+} SkipLog;
+
+static unsigned char skip_log_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+  SkipLog* log = user;
+  size_t used = strlen(log->log);
+  const char* format = type == SXMLEventTag ? "%s " : type == SXMLEventContent ? "'%s' " :
+                       type == SXMLEventAttributeKey ? "@%s " : type == SXMLEventAttributeValue ? "=%s " : "!%s ";
+  if (type == SXMLEventTag || !log->tags_only) {
+    snprintf(log->log + used, sizeof(log->log) - used, format, text);
+  }
+  if (type == SXMLEventContent) {
+    return SXMLExplorerSkip;  // Not a start tag: same as Continue
+  }
+  if (type == SXMLEventTag && log->skip != NULL && strncmp(text, log->skip, strlen(log->skip)) == 0 &&
+      (text[strlen(log->skip)] == '\0' || text[strlen(log->skip)] == '/')) {
+    return SXMLExplorerSkip;
+  }
+  return SXMLExplorerContinue;
+}
+
+static unsigned char skip_handler(void* user, SXMLEventType type, char* text, unsigned int len) {
+  return type == SXMLEventTag ? SXMLExplorerSkip : SXMLExplorerContinue;
+}
+
+void test_subtree_skip(void) {
+  char xml[] = "<?xml version=\"1.0\"?><r><skip a=\"1\">in<x q='/>' p=\"c>d\">t</x><skip>nested</skip>"
+               "<!-- </skip> --><![CDATA[</skip>]]]><?pi </skip>?><e/>text</skip>after<skip/><keep>k</keep></r>";
+  const char* expected = "r skip @a =1 /skip 'after' skip/ keep 'k' /keep /r ";
+  static SkipLog log;
+
+  // Skip from the tag callback; empty elements have nothing to skip
+  memset(&log, 0, sizeof(log));
+  log.skip = "skip";
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_register_event_func(ex, skip_log_event, &log);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(log.log, expected);
+  sxml_destroy_explorer(ex);
+
+  // Skip from an element handler; the element layers stay balanced
+  memset(&log, 0, sizeof(log));
+  ex = sxml_make_explorer();
+  sxml_register_event_func(ex, skip_log_event, &log);
+  sxml_enable_element_path(ex, 1);
+  CU_ASSERT_EQUAL(sxml_on_element(ex, "skip", skip_handler, NULL), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(log.log, expected);
+  CU_ASSERT_EQUAL(sxml_element_depth(ex), 0);
+  sxml_destroy_explorer(ex);
+}
+
+void test_subtree_skip_atom(void) {
+  char* xml = dispatch_read_file("test-data/test-oss-1.xml");
+  static SkipLog log;
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  memset(&log, 0, sizeof(log));
+  log.tags_only = 1;
+
+  // Entry bodies never reach the callbacks; their end tags do
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_enable_entity_processing(ex, 1);
+  sxml_register_event_func(ex, skip_log_event, &log);
+  CU_ASSERT_EQUAL(sxml_on_element(ex, "entry", skip_handler, NULL), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(log.log, "feed title /title link / updated /updated author name /name /author id /id "
+                                  "entry /entry /feed ");
+  sxml_destroy_explorer(ex);
+  free(xml);
+}
+
+void test_subtree_skip_resume(void) {
+  char* xml = dispatch_read_file("test-data/test-large-document.xml");
+  unsigned char blob[16384];
+  unsigned long pos = 0;
+  unsigned int len, runs = 0;
+  unsigned char result;
+  static SkipLog whole, stepped;
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  memset(&whole, 0, sizeof(whole));
+  memset(&stepped, 0, sizeof(stepped));
+  whole.skip = stepped.skip = "book";
+  whole.tags_only = stepped.tags_only = 1;
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_register_event_func(ex, skip_log_event, &whole);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  sxml_destroy_explorer(ex);
+  CU_ASSERT(strstr(whole.log, "/book ") != NULL);
+  CU_ASSERT(strstr(whole.log, "keyword") == NULL);
+
+  // Suspend every 13 bytes and continue in a fresh explorer each time, so
+  // the skip depth and scanner mode travel through snapshots
+  ex = sxml_make_explorer();
+  sxml_register_event_func(ex, skip_log_event, &stepped);
+  while ((result = sxml_run_explorer_budget(ex, xml + pos, 13, 0)) == SXMLExplorerSuspended) {
+    SXMLExplorer* next = sxml_make_explorer();
+    pos += sxml_explorer_consumed(ex);
+    len = sxml_snapshot_explorer(ex, blob, sizeof(blob));
+    CU_ASSERT_FATAL(len > 0 && len <= sizeof(blob));
+    CU_ASSERT_FATAL(sxml_restore_explorer(next, blob, len) == SXMLExplorerContinue);
+    sxml_register_event_func(next, skip_log_event, &stepped);
+    sxml_destroy_explorer(ex);
+    ex = next;
+    runs++;
+  }
+  CU_ASSERT_EQUAL(result, SXMLExplorerComplete);
+  CU_ASSERT(runs > 100);
+  CU_ASSERT_STRING_EQUAL(stepped.log, whole.log);
+  sxml_destroy_explorer(ex);
+  free(xml);
+}
+
+// =============================================================================
+// BASE64 CONTENT
+// =============================================================================
+
+typedef struct {
+  unsigned char data[65536];
+  unsigned int len;
+  unsigned int calls;
+  unsigned int largest;
+  unsigned int stop_after;  // Calls before answering Stop, 0 for never
+  char content[256];        // Content events, joined by '|'
+} Base64Sink;
+
+static unsigned char base64_sink(void* user, const unsigned char* data, unsigned int len) {
+  Base64Sink* sink = user;
+  if (sink->len + len <= sizeof(sink->data)) {
+    memcpy(sink->data + sink->len, data, len);
+  }
+  sink->len += len;
+  sink->calls++;
+  sink->largest = len > sink->largest ? len : sink->largest;
+  return sink->stop_after != 0 && sink->calls >= sink->stop_after ? SXMLExplorerStop : SXMLExplorerContinue;
+}
+
+static unsigned char base64_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+  Base64Sink* sink = user;
+  if (type == SXMLEventContent) {
+    size_t used = strlen(sink->content);
+    snprintf(sink->content + used, sizeof(sink->content) - used, "%s|", text);
+  }
+  return SXMLExplorerContinue;
+}
+
+static unsigned char base64_handler(void* user, SXMLEventType type, char* text, unsigned int len) {
+  return type == SXMLEventTag ? SXMLExplorerBase64 : SXMLExplorerContinue;
+}
+
+// MIME style: 76 columns, CRLF line ends
+static unsigned int base64_encode(const unsigned char* in, unsigned int len, char* out) {
+  static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  unsigned int i, n = 0, column = 0;
+  for (i = 0; i < len; i += 3) {
+    unsigned int bits = in[i] << 16 | (i + 1 < len ? in[i + 1] << 8 : 0) | (i + 2 < len ? in[i + 2] : 0);
+    out[n++] = alphabet[bits >> 18];
+    out[n++] = alphabet[(bits >> 12) & 63];
+    out[n++] = i + 1 < len ? alphabet[(bits >> 6) & 63] : '=';
+    out[n++] = i + 2 < len ? alphabet[bits & 63] : '=';
+    if ((column += 4) == 76) {
+      out[n++] = '\r';
+      out[n++] = '\n';
+      column = 0;
+    }
+  }
+  out[n] = '\0';
+  return n;
+}
+
+static char* base64_document(const unsigned char* payload, unsigned int len) {
+  const char* head = "<?xml version=\"1.0\"?><doc><name>logo.png</name><data type=\"png\">\n";
+  const char* tail = "\n  </data><empty></empty><note>done</note></doc>";
+  char* xml = malloc(strlen(head) + len * 2 + 64 + strlen(tail));
+  strcpy(xml, head);
+  base64_encode(payload, len, xml + strlen(xml));
+  strcat(xml, tail);
+  return xml;
+}
+
+static void base64_payload(unsigned char* payload, unsigned int len) {
+  unsigned int i, state = 12345;
+  for (i = 0; i < len; i++) {
+    state = state * 1103515245 + 12345;
+    payload[i] = (unsigned char)(state >> 16);
+  }
+}
+
+void test_base64_content(void) {
+  char small[] = "<r><a>SGVs bG8s\n IHdv\tcmxk IQ==</a><a>QUJD</a><a>QUI</a><a/><a x=\"1\"/><b>QUJD</b><a>QQ</a></r>";
+  static unsigned char payload[40000];
+  static Base64Sink sink;
+  char* xml;
+
+  // Whitespace anywhere, padding optional, self-closing elements decode nothing
+  memset(&sink, 0, sizeof(sink));
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_register_event_func(ex, base64_event, &sink);
+  sxml_register_base64_func(ex, base64_sink, &sink);
+  CU_ASSERT_EQUAL(sxml_on_element(ex, "a", base64_handler, NULL), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, small), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(sink.len, 19);
+  CU_ASSERT(memcmp(sink.data, "Hello, world!ABCABA", 19) == 0);
+  CU_ASSERT_STRING_EQUAL(sink.content, "QUJD|");
+  sxml_destroy_explorer(ex);
+
+  // Tens of kilobytes of MIME-wrapped text, past SXMLElementLength
+  base64_payload(payload, sizeof(payload));
+  xml = base64_document(payload, sizeof(payload));
+  memset(&sink, 0, sizeof(sink));
+  ex = sxml_make_explorer();
+  sxml_register_event_func(ex, base64_event, &sink);
+  sxml_register_base64_func(ex, base64_sink, &sink);
+  sxml_enable_element_path(ex, 1);
+  CU_ASSERT_EQUAL(sxml_on_element(ex, "data", base64_handler, NULL), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(sink.len, sizeof(payload));
+  CU_ASSERT(memcmp(sink.data, payload, sizeof(payload)) == 0);
+  CU_ASSERT(sink.calls > 1);
+  CU_ASSERT(sink.largest <= 768);
+  CU_ASSERT_STRING_EQUAL(sink.content, "logo.png|done|");
+  CU_ASSERT_EQUAL(sxml_element_depth(ex), 0);
+  sxml_destroy_explorer(ex);
+  free(xml);
+}
+
+void test_base64_content_errors(void) {
+  const char* bad[] = {
+    "<r><a>QU!D</a></r>",        // Outside the alphabet
+    "<r><a>QUJDR</a></r>",       // A lone sextet
+    "<r><a>QQ==QQ==</a></r>",    // Data after padding
+    "<r><a>Q===</a></r>",        // Padding too early
+    "<r><a>QU&amp;D</a></r>",    // References are not decoded
+  };
+  char xml[64];
+  static Base64Sink sink;
+  unsigned int i;
+
+  for (i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+    SXMLExplorer* ex = sxml_make_explorer();
+    strcpy(xml, bad[i]);
+    memset(&sink, 0, sizeof(sink));
+    sxml_enable_entity_processing(ex, 1);
+    sxml_register_base64_func(ex, base64_sink, &sink);
+    sxml_on_element(ex, "a", base64_handler, NULL);
+    CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerErrorMalformedXML);
+    sxml_destroy_explorer(ex);
+  }
+
+  // The sink can stop the run; nothing after it is consumed
+  strcpy(xml, "<r><a>QUJD</a><a>REVG</a></r>");
+  memset(&sink, 0, sizeof(sink));
+  sink.stop_after = 1;
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_register_base64_func(ex, base64_sink, &sink);
+  sxml_on_element(ex, "a", base64_handler, NULL);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerInterrupted);
+  CU_ASSERT_EQUAL(sink.len, 3);
+  CU_ASSERT_EQUAL(sxml_explorer_consumed(ex), 10);
+  sxml_destroy_explorer(ex);
+}
+
+void test_base64_content_resume(void) {
+  static unsigned char payload[3000];
+  static Base64Sink sink;
+  unsigned char blob[16384];
+  unsigned long pos = 0;
+  unsigned int len, runs = 0;
+  unsigned char result;
+  char* xml;
+
+  // Suspend every 7 bytes and continue in a fresh explorer each time, so the
+  // partial quantum travels through snapshots
+  base64_payload(payload, sizeof(payload));
+  xml = base64_document(payload, sizeof(payload) - 1);
+  memset(&sink, 0, sizeof(sink));
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_register_event_func(ex, base64_event, &sink);
+  sxml_register_base64_func(ex, base64_sink, &sink);
+  sxml_on_element(ex, "data", base64_handler, NULL);
+  while ((result = sxml_run_explorer_budget(ex, xml + pos, 7, 0)) == SXMLExplorerSuspended) {
+    SXMLExplorer* next = sxml_make_explorer();
+    pos += sxml_explorer_consumed(ex);
+    len = sxml_snapshot_explorer(ex, blob, sizeof(blob));
+    CU_ASSERT_FATAL(len > 0 && len <= sizeof(blob));
+    CU_ASSERT_FATAL(sxml_restore_explorer(next, blob, len) == SXMLExplorerContinue);
+    sxml_register_event_func(next, base64_event, &sink);
+    sxml_register_base64_func(next, base64_sink, &sink);
+    sxml_on_element(next, "data", base64_handler, NULL);
+    sxml_destroy_explorer(ex);
+    ex = next;
+    runs++;
+  }
+  CU_ASSERT_EQUAL(result, SXMLExplorerComplete);
+  CU_ASSERT(runs > 500);
+  CU_ASSERT_EQUAL(sink.len, sizeof(payload) - 1);
+  CU_ASSERT(memcmp(sink.data, payload, sizeof(payload) - 1) == 0);
+  CU_ASSERT_STRING_EQUAL(sink.content, "logo.png|done|");
+  sxml_destroy_explorer(ex);
+  free(xml);
+}
+
+// =============================================================================
+// TEXT RUNS
+// =============================================================================
+
+typedef struct {
+  unsigned int content;
+  unsigned int blank;
+  unsigned int handler;
+  char log[256];
+} TextLog;
+
+static unsigned char text_log_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+  TextLog* log = user;
+  size_t used = strlen(log->log);
+  unsigned int i;
+
+  if (type == SXMLEventContent || type == SXMLEventComment) {
+    snprintf(log->log + used, sizeof(log->log) - used, "%s%s|", type == SXMLEventComment ? "#" : "", text);
+  }
+  if (type != SXMLEventContent) {
+    return SXMLExplorerContinue;
+  }
+  CU_ASSERT_EQUAL(strlen(text), len);
+  log->content++;
+  for (i = 0; i < len && strchr(" \t\r\n", text[i]) != NULL; i++);
+  if (i == len) {
+    log->blank++;
+  }
+  return SXMLExplorerContinue;
+}
+
+static unsigned char text_log_handler(void* user, SXMLEventType type, char* text, unsigned int len) {
+  TextLog* log = user;
+  if (type == SXMLEventContent) {
+    log->handler++;
+  }
+  return SXMLExplorerContinue;
+}
+
+static void text_run(const char* xml, unsigned char skip, unsigned char coalesce, TextLog* log) {
+  SXMLExplorer* ex = sxml_make_explorer();
+  memset(log, 0, sizeof(TextLog));
+  sxml_enable_whitespace_skip(ex, skip);
+  sxml_enable_text_coalescing(ex, coalesce);
+  sxml_register_event_func(ex, text_log_event, log);
+  sxml_on_element(ex, "url", text_log_handler, log);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, (char*)xml), SXMLExplorerComplete);
+  sxml_destroy_explorer(ex);
+}
+
+void test_whitespace_skip(void) {
+  char* xml = dispatch_read_file("test-data/test-sitemap.xml");
+  TextLog all, skipped;
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+
+  // Indentation is about half of the content runs of a pretty-printed file
+  text_run(xml, 0, 0, &all);
+  text_run(xml, 1, 0, &skipped);
+  CU_ASSERT(all.blank * 2 >= all.content);
+  CU_ASSERT_EQUAL(skipped.blank, 0);
+  CU_ASSERT_EQUAL(skipped.content, all.content - all.blank);
+  CU_ASSERT(all.handler > 0);
+  CU_ASSERT_EQUAL(skipped.handler, 0);  // <url> holds only indentation
+  free(xml);
+
+  // Whitespace on both sides of eight-byte steps; \v and NBSP are text
+  text_run("<r>        </r>", 1, 0, &skipped);
+  CU_ASSERT_STRING_EQUAL(skipped.log, "");
+  text_run("<r>\t\r\n \t\r\n \t\r\n \t\r\n \t</r>", 1, 0, &skipped);
+  CU_ASSERT_STRING_EQUAL(skipped.log, "");
+  text_run("<r>        x</r><r>   x            </r>", 1, 0, &skipped);
+  CU_ASSERT_STRING_EQUAL(skipped.log, "        x|   x            |");
+  text_run("<r>    \v   </r><r>  \xc2\xa0 </r><r>       \t        *</r>", 1, 0, &skipped);
+  CU_ASSERT_EQUAL(skipped.content, 3);
+  CU_ASSERT_EQUAL(skipped.blank, 0);
+}
+
+void test_text_coalescing(void) {
+  const char* xml = "<r>x <![CDATA[y]]> z<!--c-->w<![CDATA[]]></r><r>\n <![CDATA[ ]]>\n</r><r><![CDATA[a]]><![CDATA[b]]></r>";
+  TextLog log;
+
+  // Plain runs end at a tag; coalesced ones also at a comment
+  text_run(xml, 0, 0, &log);
+  CU_ASSERT_STRING_EQUAL(log.log, "y|#c| |\n|a|b|");
+  text_run(xml, 0, 1, &log);
+  CU_ASSERT_STRING_EQUAL(log.log, "x y z|#c|w|\n  \n|ab|");
+  text_run(xml, 1, 1, &log);
+  CU_ASSERT_STRING_EQUAL(log.log, "x y z|#c|w|ab|");
+  text_run(xml, 1, 0, &log);
+  CU_ASSERT_STRING_EQUAL(log.log, "y|#c|a|b|");
+}
+
+typedef struct {
+  SXMLExplorer* explorer;
+  char log[128];
+} DecodeLog;
+
+static unsigned char text_decode_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+  DecodeLog* log = user;
+  size_t used = strlen(log->log);
+  char out[SXMLDecodedLength(64)];
+
+  if (type != SXMLEventContent) {
+    return SXMLExplorerContinue;
+  }
+  if (sxml_text_needs_decoding(log->explorer)) {
+    out[sxml_decode_entities(out, text, len)] = '\0';
+    snprintf(log->log + used, sizeof(log->log) - used, "%s|", out);
+  } else {
+    snprintf(log->log + used, sizeof(log->log) - used, "=%s|", text);
+  }
+  return SXMLExplorerContinue;
+}
+
+void test_text_coalescing_lazy_entities(void) {
+  DecodeLog log;
+
+  // CDATA is never decoded, so it does not join a run that needs decoding
+  memset(&log, 0, sizeof(log));
+  log.explorer = sxml_make_explorer();
+  sxml_enable_entity_processing(log.explorer, 1);
+  sxml_enable_lazy_entities(log.explorer, 1);
+  sxml_enable_text_coalescing(log.explorer, 1);
+  sxml_register_event_func(log.explorer, text_decode_event, &log);
+  CU_ASSERT_EQUAL(sxml_run_explorer(log.explorer, "<a>x &amp; y<![CDATA[ &lt;b&gt; ]]></a>"), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(log.log, "x & y|= &lt;b&gt; |");
+  sxml_destroy_explorer(log.explorer);
+}
+
+void test_text_coalescing_resume(void) {
+  const char* xml = "<r>one <![CDATA[<two>]]> three\n  <![CDATA[  ]]>\n</r>";
+  unsigned char blob[16384];
+  unsigned long pos = 0;
+  unsigned int len, runs = 0;
+  unsigned char result;
+  TextLog log;
+
+  // Suspend every 3 bytes; the run and both options travel in snapshots
+  memset(&log, 0, sizeof(log));
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_enable_whitespace_skip(ex, 1);
+  sxml_enable_text_coalescing(ex, 1);
+  sxml_register_event_func(ex, text_log_event, &log);
+  while ((result = sxml_run_explorer_budget(ex, (char*)xml + pos, 3, 0)) == SXMLExplorerSuspended) {
+    SXMLExplorer* next = sxml_make_explorer();
+    pos += sxml_explorer_consumed(ex);
+    len = sxml_snapshot_explorer(ex, blob, sizeof(blob));
+    CU_ASSERT_FATAL(len > 0 && len <= sizeof(blob));
+    CU_ASSERT_FATAL(sxml_restore_explorer(next, blob, len) == SXMLExplorerContinue);
+    sxml_register_event_func(next, text_log_event, &log);
+    sxml_destroy_explorer(ex);
+    ex = next;
+    runs++;
+  }
+  CU_ASSERT_EQUAL(result, SXMLExplorerComplete);
+  CU_ASSERT(runs > 10);
+  CU_ASSERT_STRING_EQUAL(log.log, "one <two> three\n    \n|");
+  sxml_destroy_explorer(ex);
+}
+
+void add_dispatch_tests(CU_pSuite* suite) {
+  CU_add_test(*suite, "Registered names", test_registered_names);
+  CU_add_test(*suite, "Interned names", test_interned_names);
+  CU_add_test(*suite, "Element handlers on sitemap", test_element_handlers_sitemap);
+  CU_add_test(*suite, "Element handlers on RSS", test_element_handlers_rss);
+  CU_add_test(*suite, "Element handler control flow", test_element_handlers_control);
+  CU_add_test(*suite, "Element handlers across restore", test_element_handlers_restore);
+  CU_add_test(*suite, "Element path in callbacks", test_element_path);
+  CU_add_test(*suite, "Element path symbols and snapshots", test_element_path_symbols);
+  CU_add_test(*suite, "Element max depth", test_element_max_depth);
+  CU_add_test(*suite, "Attribute batches", test_attribute_batches);
+  CU_add_test(*suite, "Attribute batch limits", test_attribute_batch_limits);
+  CU_add_test(*suite, "Attribute batch resume", test_attribute_batch_resume);
+  CU_add_test(*suite, "Lazy attributes", test_lazy_attributes);
+  CU_add_test(*suite, "Lazy attributes with namespaces and batches", test_lazy_attributes_consumers);
+  CU_add_test(*suite, "Lazy attributes resume", test_lazy_attributes_resume);
+  CU_add_test(*suite, "Tag scan", test_tag_scan);
+  CU_add_test(*suite, "Tag scan matches full parse", test_tag_scan_matches_full_parse);
+  CU_add_test(*suite, "Subtree skip", test_subtree_skip);
+  CU_add_test(*suite, "Subtree skip on Atom entries", test_subtree_skip_atom);
+  CU_add_test(*suite, "Subtree skip resume", test_subtree_skip_resume);
+  CU_add_test(*suite, "Base64 content", test_base64_content);
+  CU_add_test(*suite, "Base64 content errors", test_base64_content_errors);
+  CU_add_test(*suite, "Base64 content resume", test_base64_content_resume);
+  CU_add_test(*suite, "Whitespace skip", test_whitespace_skip);
+  CU_add_test(*suite, "Text coalescing", test_text_coalescing);
+  CU_add_test(*suite, "Text coalescing with lazy entities", test_text_coalescing_lazy_entities);
+  CU_add_test(*suite, "Text coalescing resume", test_text_coalescing_resume);
+}
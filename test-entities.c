@@ -2,6 +2,7 @@
 #include <CUnit/Basic.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "sparsexml.h"
 
@@ -50,7 +51,7 @@ static unsigned char test_numeric_hex_on_content(char *content) {
 static unsigned char test_extended_html_on_content(char *content) {
   test_extended_content_count++;
   if (test_extended_content_count == 1) {
-    CU_ASSERT(strcmp(content, "(c) (R) (TM)   E #") == 0);
+    CU_ASSERT(strcmp(content, "\xC2\xA9 \xC2\xAE \xE2\x84\xA2 \xC2\xA0 \xE2\x82\xAC \xC2\xA3") == 0);
   }
   return SXMLExplorerContinue;
 }
@@ -58,7 +59,7 @@ static unsigned char test_extended_html_on_content(char *content) {
 static unsigned char test_mixed_entity_on_content(char *content) {
   test_mixed_content_count++;
   if (test_mixed_content_count == 1) {
-    CU_ASSERT(strcmp(content, "<TestA> (c)  ") == 0);
+    CU_ASSERT(strcmp(content, "<TestA> \xC2\xA9  ") == 0);
   }
   return SXMLExplorerContinue;
 }
@@ -88,7 +89,7 @@ static unsigned char test_complex_real_world_on_content(char *content) {
   if (strstr(content, "API Reference & Documentation") != NULL) {
     found_amp = 1;
   }
-  if (strstr(content, "(c) 2024 Company (TM)") != NULL) {
+  if (strstr(content, "\xC2\xA9 2024 Company \xE2\x84\xA2") != NULL) {
     found_copy = 1;
   }
   if (strstr(content, "<html>") != NULL && strstr(content, "</html>") != NULL) {
@@ -226,18 +227,62 @@ void test_invalid_entities_handling(void) {
 
 void test_numeric_entity_out_of_range(void) {
   SXMLExplorer* explorer;
-  char xml[] = "<?xml version=\"1.0\"?><test>&#255;</test>";  // Beyond ASCII range
-  
+  const char* invalid[] = {
+    "<?xml version=\"1.0\"?><test>&#x110000;</test>",  // Beyond Unicode
+    "<?xml version=\"1.0\"?><test>&#xD800;</test>",    // Surrogate
+    "<?xml version=\"1.0\"?><test>&#0;</test>",
+    "<?xml version=\"1.0\"?><test>&#12a;</test>",
+    "<?xml version=\"1.0\"?><test>&#x;</test>",
+  };
+  char xml[64];
+
+  for (unsigned int i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+    strcpy(xml, invalid[i]);
+    explorer = sxml_make_explorer();
+    sxml_enable_entity_processing(explorer, 1);
+    sxml_enable_numeric_entities(explorer, 1);
+    sxml_register_func(explorer, NULL, NULL, NULL, NULL);
+
+    // Should return error for out-of-range or malformed numeric entity
+    CU_ASSERT(sxml_run_explorer(explorer, xml) == SXMLExplorerErrorInvalidEntity);
+
+    sxml_destroy_explorer(explorer);
+  }
+}
+
+static char test_unicode_content[64];
+
+static unsigned char test_unicode_on_content(char *content) {
+  snprintf(test_unicode_content, sizeof(test_unicode_content), "%s", content);
+  return SXMLExplorerContinue;
+}
+
+void test_unicode_entities(void) {
+  SXMLExplorer* explorer;
+  char numeric[] = "<?xml version=\"1.0\"?><test>&#255;&#x20AC;&#x1F600;</test>";
+  char named[] = "<?xml version=\"1.0\"?><test>&NotEqualTilde;&fjlig;&Aopf;</test>";
+  char plain[] = "<?xml version=\"1.0\"?><test>&copy;</test>";
+
   explorer = sxml_make_explorer();
   sxml_enable_entity_processing(explorer, 1);
   sxml_enable_numeric_entities(explorer, 1);
-  sxml_register_func(explorer, NULL, NULL, NULL, NULL);
-  
-  unsigned char result = sxml_run_explorer(explorer, xml);
-  
-  // Should return error for out-of-range numeric entity
-  CU_ASSERT(result == SXMLExplorerErrorInvalidEntity);
-  
+  sxml_enable_extended_entities(explorer, 1);
+  sxml_register_func(explorer, NULL, test_unicode_on_content, NULL, NULL);
+
+  // Full-range numeric references become UTF-8
+  CU_ASSERT(sxml_run_explorer(explorer, numeric) == SXMLExplorerComplete);
+  CU_ASSERT(strcmp(test_unicode_content, "\xC3\xBF\xE2\x82\xAC\xF0\x9F\x98\x80") == 0);
+
+  // Multi-codepoint and astral HTML5 entities
+  CU_ASSERT(sxml_run_explorer(explorer, named) == SXMLExplorerComplete);
+  CU_ASSERT(strcmp(test_unicode_content, "\xE2\x89\x82\xCC\xB8" "fj\xF0\x9D\x94\xB8") == 0);
+  sxml_destroy_explorer(explorer);
+
+  // HTML entities stay opt-in
+  explorer = sxml_make_explorer();
+  sxml_enable_entity_processing(explorer, 1);
+  sxml_register_func(explorer, NULL, test_unicode_on_content, NULL, NULL);
+  CU_ASSERT(sxml_run_explorer(explorer, plain) == SXMLExplorerErrorInvalidEntity);
   sxml_destroy_explorer(explorer);
 }
 
@@ -289,6 +334,284 @@ void test_complex_real_world_entities(void) {
   sxml_destroy_explorer(explorer);
 }
 
+static char test_declared_log[512];
+
+static unsigned char test_declared_on_text(char *text) {
+  strncat(test_declared_log, text, sizeof(test_declared_log) - strlen(test_declared_log) - 2);
+  strcat(test_declared_log, "|");
+  return SXMLExplorerContinue;
+}
+
+static char* test_entities_read_file(const char* filename) {
+  FILE* f = fopen(filename, "rb");
+  if (!f) return NULL;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  rewind(f);
+  char* str = (char*)malloc(size + 1);
+  if (!str) { fclose(f); return NULL; }
+  fread(str, 1, size, f);
+  str[size] = '\0';
+  fclose(f);
+  return str;
+}
+
+void test_doctype_declared_entities(void) {
+  char* xml = test_entities_read_file("test-data/test-doctype-entities.xml");
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+
+  test_declared_log[0] = '\0';
+  SXMLExplorer* explorer = sxml_make_explorer();
+  sxml_enable_entity_processing(explorer, 1);
+  sxml_enable_numeric_entities(explorer, 1);
+  sxml_register_func(explorer, NULL, test_declared_on_text, NULL, test_declared_on_text);
+
+  CU_ASSERT_EQUAL(sxml_run_explorer(explorer, xml), SXMLExplorerComplete);
+  CU_ASSERT(strstr(test_declared_log, "Acme & Sons|Acme & Sons \xC2\xA9 2024|") != NULL);
+  CU_ASSERT(strstr(test_declared_log, "-->a]b|") != NULL);
+
+  // Declarations split across byte-budgeted runs land in the same table
+  SXMLExplorer* chunked = sxml_make_explorer();
+  sxml_enable_entity_processing(chunked, 1);
+  sxml_enable_numeric_entities(chunked, 1);
+  sxml_register_func(chunked, NULL, test_declared_on_text, NULL, test_declared_on_text);
+  char expected[512];
+  strcpy(expected, test_declared_log);
+  test_declared_log[0] = '\0';
+  unsigned long pos = 0;
+  while (sxml_run_explorer_budget(chunked, xml + pos, 7, 0) == SXMLExplorerSuspended) {
+    pos += sxml_explorer_consumed(chunked);
+  }
+  CU_ASSERT_STRING_EQUAL(test_declared_log, expected);
+
+  sxml_destroy_explorer(chunked);
+  sxml_destroy_explorer(explorer);
+  free(xml);
+}
+
+void test_registered_entities(void) {
+  char xml[] = "<?xml version=\"1.0\"?><!DOCTYPE r [<!ENTITY co \"Other\">]><r>&co;/&dept;</r>";
+
+  test_declared_log[0] = '\0';
+  SXMLExplorer* explorer = sxml_make_explorer();
+  sxml_enable_entity_processing(explorer, 1);
+  sxml_register_func(explorer, NULL, test_declared_on_text, NULL, NULL);
+  CU_ASSERT_EQUAL(sxml_register_entity(explorer, "co", "Acme"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_register_entity(explorer, "dept", "R&amp;D of &co;"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_register_entity(explorer, "", "x"), SXMLExplorerErrorMalformedXML);
+
+  // Registered bindings come first and win over later declarations
+  CU_ASSERT_EQUAL(sxml_run_explorer(explorer, xml), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(test_declared_log, "Acme/R&D of Acme|");
+
+  // Clones carry the table, so one configured explorer can serve as a profile
+  SXMLExplorer* clone = sxml_clone_explorer(explorer);
+  char again[] = "<r>&dept;</r>";
+  test_declared_log[0] = '\0';
+  CU_ASSERT_EQUAL(sxml_run_explorer(clone, again), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(test_declared_log, "R&D of Acme|");
+
+  // The table is bounded: registering past capacity fails cleanly
+  unsigned char result = SXMLExplorerContinue;
+  for (unsigned int i = 0; i < 256 && result == SXMLExplorerContinue; i++) {
+    char name[16];
+    snprintf(name, sizeof(name), "e%u", i);
+    result = sxml_register_entity(clone, name, "v");
+  }
+  CU_ASSERT_EQUAL(result, SXMLExplorerErrorBufferOverflow);
+
+  sxml_destroy_explorer(clone);
+  sxml_destroy_explorer(explorer);
+}
+
+void test_entity_expansion_limits(void) {
+  char laughs[] = "<!DOCTYPE l ["
+                  "<!ENTITY a \"lollollollollollollollollollol\">"
+                  "<!ENTITY b \"&a;&a;&a;&a;&a;&a;&a;&a;&a;&a;\">"
+                  "<!ENTITY c \"&b;&b;&b;&b;&b;&b;&b;&b;&b;&b;\">"
+                  "<!ENTITY d \"&c;&c;&c;&c;&c;&c;&c;&c;&c;&c;\">"
+                  "]><l>&d;</l>";
+  char loop[] = "<!DOCTYPE l [<!ENTITY x \"&y;\"><!ENTITY y \"&x;\">]><l>&x;</l>";
+  char small[] = "<!DOCTYPE l [<!ENTITY a \"lollollollollollollollollollol\">]><l>&a;</l>";
+  char bad[] = "<!DOCTYPE l [<!ENTITY a unquoted>]><l/>";
+  char wide[1280];
+  unsigned int wide_len;
+  SXMLExplorer* explorer;
+
+  // Seven levels of sixteen references each over an empty leaf: nothing is
+  // output, but a full expansion would visit 16^7 references
+  wide_len = sprintf(wide, "<!DOCTYPE l [<!ENTITY e0 \"\">");
+  for (unsigned int level = 1; level <= 7; level++) {
+    wide_len += sprintf(wide + wide_len, "<!ENTITY e%u \"", level);
+    for (unsigned int i = 0; i < 16; i++) {
+      wide_len += sprintf(wide + wide_len, "&e%u;", level - 1);
+    }
+    wide_len += sprintf(wide + wide_len, "\">");
+  }
+  sprintf(wide + wide_len, "]><l>&e7;</l>");
+
+  // Exponential expansion stops at the buffer instead of exhausting memory
+  explorer = sxml_make_explorer();
+  sxml_enable_entity_processing(explorer, 1);
+  CU_ASSERT_EQUAL(sxml_run_explorer(explorer, laughs), SXMLExplorerErrorBufferOverflow);
+  sxml_destroy_explorer(explorer);
+
+  // Recursive definitions hit the nesting limit
+  explorer = sxml_make_explorer();
+  sxml_enable_entity_processing(explorer, 1);
+  CU_ASSERT_EQUAL(sxml_run_explorer(explorer, loop), SXMLExplorerErrorInvalidEntity);
+  sxml_destroy_explorer(explorer);
+
+  // Wide trees of empty values hit the reference count limit
+  explorer = sxml_make_explorer();
+  sxml_enable_entity_processing(explorer, 1);
+  CU_ASSERT_EQUAL(sxml_run_explorer(explorer, wide), SXMLExplorerErrorInvalidEntity);
+  sxml_destroy_explorer(explorer);
+
+  // Per-reference byte limit
+  explorer = sxml_make_explorer();
+  sxml_enable_entity_processing(explorer, 1);
+  sxml_set_entity_expansion_limit(explorer, 16);
+  CU_ASSERT_EQUAL(sxml_run_explorer(explorer, small), SXMLExplorerErrorInvalidEntity);
+  sxml_destroy_explorer(explorer);
+
+  // The limit travels in snapshots: a fresh explorer restored before the
+  // reference enforces it too
+  unsigned char blob[2048];
+  unsigned long cut = strstr(small, "&a;") - small;
+  explorer = sxml_make_explorer();
+  sxml_enable_entity_processing(explorer, 1);
+  sxml_set_entity_expansion_limit(explorer, 16);
+  CU_ASSERT_EQUAL(sxml_run_explorer_budget(explorer, small, cut, 0), SXMLExplorerSuspended);
+  unsigned int size = sxml_snapshot_explorer(explorer, blob, sizeof(blob));
+  CU_ASSERT_FATAL(size > 0 && size <= sizeof(blob));
+  sxml_destroy_explorer(explorer);
+  explorer = sxml_make_explorer();
+  CU_ASSERT_EQUAL(sxml_restore_explorer(explorer, blob, size), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_run_explorer(explorer, small + sxml_explorer_offset(explorer)), SXMLExplorerErrorInvalidEntity);
+  sxml_destroy_explorer(explorer);
+
+  explorer = sxml_make_explorer();
+  CU_ASSERT_EQUAL(sxml_run_explorer(explorer, bad), SXMLExplorerErrorMalformedXML);
+  sxml_destroy_explorer(explorer);
+}
+
+static SXMLExplorer* test_lazy_explorer;
+static char test_lazy_log[256];
+
+static unsigned char test_lazy_on_text(char *text) {
+  char decoded[SXMLDecodedLength(64)];
+  size_t used = strlen(test_lazy_log);
+  if (sxml_text_needs_decoding(test_lazy_explorer)) {
+    sxml_decode_entities(decoded, text, strlen(text));
+    snprintf(test_lazy_log + used, sizeof(test_lazy_log) - used, "[%s=%s]", text, decoded);
+  } else {
+    snprintf(test_lazy_log + used, sizeof(test_lazy_log) - used, "[%s]", text);
+  }
+  return SXMLExplorerContinue;
+}
+
+static char test_decode_log[256];
+
+static unsigned char test_decode_on_text(char *text) {
+  char decoded[SXMLDecodedLength(64)];
+  size_t used = strlen(test_decode_log);
+  if (test_lazy_explorer != NULL && sxml_text_needs_decoding(test_lazy_explorer)) {
+    sxml_explorer_decode_entities(test_lazy_explorer, decoded, text, strlen(text));
+    text = decoded;
+  }
+  snprintf(test_decode_log + used, sizeof(test_decode_log) - used, "[%s]", text);
+  return SXMLExplorerContinue;
+}
+
+static unsigned char test_decode_run(const char* xml, unsigned char numeric, unsigned char extended, unsigned char lazy) {
+  char doc[256];
+  unsigned char ret;
+  SXMLExplorer* explorer = sxml_make_explorer();
+
+  strcpy(doc, xml);
+  test_decode_log[0] = '\0';
+  test_lazy_explorer = lazy ? explorer : NULL;
+  sxml_enable_entity_processing(explorer, 1);
+  sxml_enable_numeric_entities(explorer, numeric);
+  sxml_enable_extended_entities(explorer, extended);
+  sxml_enable_lazy_entities(explorer, lazy);
+  sxml_register_func(explorer, NULL, test_decode_on_text, NULL, test_decode_on_text);
+  ret = sxml_run_explorer(explorer, doc);
+  sxml_destroy_explorer(explorer);
+  test_lazy_explorer = NULL;
+  return ret;
+}
+
+void test_lazy_decode_follows_flags(void) {
+  char eager[256];
+  char numeric_doc[] = "<?xml version=\"1.0\"?><r a=\"&lt;&amp;\"><t>&#65;&gt;&#x42;</t></r>";
+  char extended_doc[] = "<?xml version=\"1.0\"?><r a=\"&quot;&copy;\"><t>&amp;&eacute;</t></r>";
+
+  // Numeric off, extended on: predefined and HTML5 only, like eager mode
+  CU_ASSERT_EQUAL(test_decode_run(extended_doc, 0, 1, 0), SXMLExplorerComplete);
+  strcpy(eager, test_decode_log);
+  CU_ASSERT_EQUAL(test_decode_run(extended_doc, 0, 1, 1), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(test_decode_log, eager);
+  CU_ASSERT_EQUAL(test_decode_run(numeric_doc, 0, 1, 0), SXMLExplorerErrorInvalidEntity);
+  CU_ASSERT_EQUAL(test_decode_run(numeric_doc, 0, 1, 1), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(test_decode_log, "[<&][&#65;>&#x42;]");
+
+  // Extended off, numeric on: predefined and numeric only
+  CU_ASSERT_EQUAL(test_decode_run(numeric_doc, 1, 0, 0), SXMLExplorerComplete);
+  strcpy(eager, test_decode_log);
+  CU_ASSERT_EQUAL(test_decode_run(numeric_doc, 1, 0, 1), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(test_decode_log, eager);
+  CU_ASSERT_STRING_EQUAL(test_decode_log, "[<&][A>B]");
+  CU_ASSERT_EQUAL(test_decode_run(extended_doc, 1, 0, 0), SXMLExplorerErrorInvalidEntity);
+  CU_ASSERT_EQUAL(test_decode_run(extended_doc, 1, 0, 1), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(test_decode_log, "[\"&copy;][&&eacute;]");
+
+  // Both on matches the flag-free decoder
+  CU_ASSERT_EQUAL(test_decode_run(extended_doc, 1, 1, 0), SXMLExplorerComplete);
+  strcpy(eager, test_decode_log);
+  CU_ASSERT_EQUAL(test_decode_run(extended_doc, 1, 1, 1), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(test_decode_log, eager);
+  CU_ASSERT_STRING_EQUAL(test_decode_log, "[\"\xC2\xA9][&\xC3\xA9]");
+}
+
+void test_lazy_entities(void) {
+  char xml[] = "<?xml version=\"1.0\"?><r a=\"x&amp;y\" b=\"plain\"><u>&lt;b&gt;</u><![CDATA[&raw;]]>"
+               "<s>plain</s><t>&#x1F600;&copy;</t></r>";
+
+  test_lazy_log[0] = '\0';
+  test_lazy_explorer = sxml_make_explorer();
+  sxml_enable_entity_processing(test_lazy_explorer, 1);
+  sxml_enable_lazy_entities(test_lazy_explorer, 1);
+  sxml_register_func(test_lazy_explorer, NULL, test_lazy_on_text, NULL, test_lazy_on_text);
+
+  CU_ASSERT_EQUAL(sxml_run_explorer(test_lazy_explorer, xml), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(test_lazy_log,
+    "[x&amp;y=x&y][plain][&lt;b&gt;=<b>][&raw;][plain]"
+    "[&#x1F600;&copy;=\xF0\x9F\x98\x80\xC2\xA9]");
+
+  sxml_destroy_explorer(test_lazy_explorer);
+}
+
+void test_decode_entities(void) {
+  char out[SXMLDecodedLength(64)];
+  const char* grow = "&nGt;&nLt;";
+
+  CU_ASSERT_EQUAL(sxml_decode_entities(out, "a &amp b &unknown; c & d &#xD800;", 33), 33);
+  CU_ASSERT_STRING_EQUAL(out, "a &amp b &unknown; c & d &#xD800;");
+
+  CU_ASSERT_EQUAL(sxml_decode_entities(out, "&quot;q&quot; &#65;&#x42;", 25), 6);
+  CU_ASSERT_STRING_EQUAL(out, "\"q\" AB");
+
+  // The only references whose UTF-8 outgrows their source text
+  CU_ASSERT_EQUAL(sxml_decode_entities(out, grow, strlen(grow)), 12);
+  CU_ASSERT(strlen(grow) + 2 <= SXMLDecodedLength(strlen(grow)));
+
+  // Only len bytes are read
+  CU_ASSERT_EQUAL(sxml_decode_entities(out, "&lt;&gt;", 3), 3);
+  CU_ASSERT_STRING_EQUAL(out, "&lt");
+}
+
 void add_entity_tests(CU_pSuite* suite) {
   CU_add_test(*suite, "Standard XML entities", test_standard_xml_entities);
   CU_add_test(*suite, "Numeric character references (decimal)", test_numeric_character_references_decimal);
@@ -298,6 +621,13 @@ void add_entity_tests(CU_pSuite* suite) {
   CU_add_test(*suite, "Entities in attributes", test_entity_in_attributes);
   CU_add_test(*suite, "Invalid entities handling", test_invalid_entities_handling);
   CU_add_test(*suite, "Numeric entity out of range", test_numeric_entity_out_of_range);
+  CU_add_test(*suite, "Unicode entities", test_unicode_entities);
   CU_add_test(*suite, "Entity processing disabled", test_entity_processing_disabled);
   CU_add_test(*suite, "Complex real-world entities", test_complex_real_world_entities);
+  CU_add_test(*suite, "DOCTYPE-declared entities", test_doctype_declared_entities);
+  CU_add_test(*suite, "Registered entities", test_registered_entities);
+  CU_add_test(*suite, "Entity expansion limits", test_entity_expansion_limits);
+  CU_add_test(*suite, "Lazy entity delivery", test_lazy_entities);
+  CU_add_test(*suite, "Lazy decoding follows the entity flags", test_lazy_decode_follows_flags);
+  CU_add_test(*suite, "On-demand entity decoding", test_decode_entities);
 }
\ No newline at end of file
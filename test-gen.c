@@ -0,0 +1,194 @@
+#include <CUnit/CUnit.h>
+#include <CUnit/Basic.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sparsexml.h"
+#include "test-gen-rss.h"
+#include "test-gen-library.h"
+
+/*
+ * Generated parser tests: test-gen-rss is inferred from test-rss.xml and
+ * test-gen-library from test-library.xsd by tools/sxml-gen at build time.
+ */
+
+#define GEN_MAX_RECORDS 8
+
+typedef struct {
+  unsigned int count;
+  unsigned long fields[GEN_MAX_RECORDS];
+  char ids[GEN_MAX_RECORDS][16];
+  char titles[GEN_MAX_RECORDS][64];
+  char formats[GEN_MAX_RECORDS][16];
+  long long years[GEN_MAX_RECORDS];
+  long long pages[GEN_MAX_RECORDS];
+  long long ratings[GEN_MAX_RECORDS];
+  long long dates[GEN_MAX_RECORDS];
+  double prices[GEN_MAX_RECORDS];
+  unsigned char available[GEN_MAX_RECORDS];
+} GenBookLog;
+
+static unsigned char gen_log_book(void* user, gen_library_book* book, unsigned long fields) {
+  GenBookLog* log = user;
+  unsigned int n = log->count++;
+  if (n >= GEN_MAX_RECORDS) {
+    return SXMLExplorerContinue;
+  }
+  log->fields[n] = fields;
+  snprintf(log->ids[n], sizeof(log->ids[0]), "%.*s", (int)book->id.len, book->id.text);
+  snprintf(log->titles[n], sizeof(log->titles[0]), "%.*s", (int)book->title.len, book->title.text);
+  snprintf(log->formats[n], sizeof(log->formats[0]), "%.*s", (int)book->availability_format_type.len,
+           book->availability_format_type.text);
+  log->years[n] = book->publication_year;
+  log->pages[n] = book->publication_pages;
+  log->ratings[n] = book->reviews_review_rating;
+  log->dates[n] = book->reviews_review_date;
+  log->prices[n] = book->availability_format_price;
+  log->available[n] = book->available;
+  return SXMLExplorerContinue;
+}
+
+static char* gen_read_test_file(const char* filename) {
+  FILE* f = fopen(filename, "rb");
+  if (!f) return NULL;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  rewind(f);
+  char* str = (char*)malloc(size + 1);
+  if (!str) { fclose(f); return NULL; }
+  fread(str, 1, size, f);
+  str[size] = '\0';
+  fclose(f);
+  return str;
+}
+
+typedef struct {
+  gen_rss_item item;
+  unsigned long fields;
+} GenItemLog;
+
+static unsigned char gen_keep_item(void* user, gen_rss_item* item, unsigned long fields) {
+  GenItemLog* log = user;
+  log->item = *item;
+  log->fields = fields;
+  return SXMLExplorerContinue;
+}
+
+void test_gen_rss_sample(void) {
+  char* xml = gen_read_test_file("test-data/test-rss.xml");
+  GenItemLog log;
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  memset(&log, 0xFF, sizeof(log));
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  gen_rss_parser* parser = gen_rss_make_parser(ex);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(parser);
+  gen_rss_register_record_func(parser, gen_keep_item, &log);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+
+  // isPermaLink="false" was inferred as a bool, the RFC 822 pubDate as text
+  CU_ASSERT_EQUAL(log.fields, GEN_RSS_ITEM_TITLE | GEN_RSS_ITEM_DESCRIPTION | GEN_RSS_ITEM_LINK |
+                              GEN_RSS_ITEM_GUID | GEN_RSS_ITEM_GUID_ISPERMALINK | GEN_RSS_ITEM_PUBDATE);
+  CU_ASSERT_EQUAL(log.item.guid_isPermaLink, 0);
+  CU_ASSERT_EQUAL(log.item.title.len, 13);
+  CU_ASSERT_NSTRING_EQUAL(log.item.title.text, "Example entry", log.item.title.len);
+  CU_ASSERT_NSTRING_EQUAL(log.item.guid.text, "7bd204c6-1655-4c27-aeee-53f933c5395f", log.item.guid.len);
+  CU_ASSERT_NSTRING_EQUAL(log.item.pubDate.text, "Sun, 06 Sep 2009 16:20:00 +0000", log.item.pubDate.len);
+
+  gen_rss_destroy_parser(parser);
+  sxml_destroy_explorer(ex);
+  free(xml);
+}
+
+void test_gen_library_schema(void) {
+  char* xml = gen_read_test_file("test-data/test-large-document.xml");
+  GenBookLog whole, budgeted;
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  memset(&whole, 0, sizeof(whole));
+  memset(&budgeted, 0, sizeof(budgeted));
+
+  GenBookLog* logs[] = { &whole, &budgeted };
+  for (unsigned int run = 0; run < 2; run++) {
+    SXMLExplorer* ex = sxml_make_explorer();
+    gen_library_parser* parser = gen_library_make_parser(ex);
+    unsigned char result;
+    CU_ASSERT_PTR_NOT_NULL_FATAL(parser);
+    gen_library_register_record_func(parser, gen_log_book, logs[run]);
+    if (run == 1) {
+      unsigned long pos = 0;
+      while ((result = sxml_run_explorer_budget(ex, xml + pos, 7, 0)) == SXMLExplorerSuspended) {
+        pos += sxml_explorer_consumed(ex);
+      }
+    } else {
+      result = sxml_run_explorer(ex, xml);
+    }
+    CU_ASSERT_EQUAL(result, SXMLExplorerComplete);
+    gen_library_destroy_parser(parser);
+    sxml_destroy_explorer(ex);
+  }
+
+  CU_ASSERT_FATAL(whole.count == 5);
+  // Schema types: gYear and int as integers, xs:date as a timestamp,
+  // xs:decimal as a double, xs:boolean as a bool
+  CU_ASSERT_EQUAL(whole.fields[0] & GEN_LIBRARY_BOOK_PUBLICATION_YEAR, GEN_LIBRARY_BOOK_PUBLICATION_YEAR);
+  CU_ASSERT_EQUAL(whole.fields[0] & GEN_LIBRARY_BOOK_AVAILABLE, GEN_LIBRARY_BOOK_AVAILABLE);
+  CU_ASSERT_STRING_EQUAL(whole.ids[0], "book001");
+  CU_ASSERT_STRING_EQUAL(whole.titles[0], "The Quantum Paradox");
+  CU_ASSERT_EQUAL(whole.years[0], 2023);
+  CU_ASSERT_EQUAL(whole.pages[0], 456);
+  CU_ASSERT_EQUAL(whole.ratings[0], 5);
+  CU_ASSERT_EQUAL(whole.dates[0], 1702598400LL);
+  CU_ASSERT_STRING_EQUAL(whole.formats[0], "hardcover");
+  CU_ASSERT_DOUBLE_EQUAL(whole.prices[0], 29.95, 1e-9);
+  CU_ASSERT_EQUAL(whole.available[0], 1);
+  CU_ASSERT_STRING_EQUAL(whole.ids[1], "book002");
+  CU_ASSERT_STRING_EQUAL(whole.titles[1], "Chronicles of the Mystic Realm");
+  CU_ASSERT_EQUAL(whole.pages[1], 678);
+  CU_ASSERT_STRING_EQUAL(whole.ids[2], "book003");
+  CU_ASSERT_EQUAL(whole.available[2], 0);
+  CU_ASSERT_EQUAL(whole.pages[2], 890);
+
+  CU_ASSERT_EQUAL(budgeted.count, whole.count);
+  for (unsigned int i = 0; i < whole.count; i++) {
+    CU_ASSERT_EQUAL(budgeted.fields[i], whole.fields[i]);
+    CU_ASSERT_STRING_EQUAL(budgeted.ids[i], whole.ids[i]);
+    CU_ASSERT_STRING_EQUAL(budgeted.titles[i], whole.titles[i]);
+    CU_ASSERT_EQUAL(budgeted.dates[i], whole.dates[i]);
+  }
+
+  free(xml);
+}
+
+void test_gen_unknown_structure(void) {
+  // Unknown elements and whatever they contain are absorbed, known names
+  // in the wrong place included
+  char xml[] = "<?xml version=\"1.0\"?><library><books><extra><book id=\"x\"><title>no</title></book></extra>"
+               "<book\n  id=\"b1\"\n  available=\"1\"><note><title>no</title></note><title>yes</title>"
+               "<publication><pages> 12 </pages><year>n/a</year></publication></book>"
+               "<book id=\"b2\"/></books></library>";
+  GenBookLog log;
+  memset(&log, 0, sizeof(log));
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  gen_library_parser* parser = gen_library_make_parser(ex);
+  gen_library_register_record_func(parser, gen_log_book, &log);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_FATAL(log.count == 2);
+  CU_ASSERT_STRING_EQUAL(log.ids[0], "b1");
+  CU_ASSERT_STRING_EQUAL(log.titles[0], "yes");
+  CU_ASSERT_EQUAL(log.pages[0], 12);
+  CU_ASSERT_EQUAL(log.available[0], 1);
+  CU_ASSERT_EQUAL(log.fields[0], GEN_LIBRARY_BOOK_ID | GEN_LIBRARY_BOOK_AVAILABLE | GEN_LIBRARY_BOOK_TITLE |
+                                 GEN_LIBRARY_BOOK_PUBLICATION_PAGES);
+  CU_ASSERT_STRING_EQUAL(log.ids[1], "b2");
+  CU_ASSERT_EQUAL(log.fields[1], GEN_LIBRARY_BOOK_ID);
+  gen_library_destroy_parser(parser);
+  sxml_destroy_explorer(ex);
+}
+
+void add_gen_tests(CU_pSuite* suite) {
+  CU_add_test(*suite, "Parser generated from a sample", test_gen_rss_sample);
+  CU_add_test(*suite, "Parser generated from a schema", test_gen_library_schema);
+  CU_add_test(*suite, "Generated parser on unknown structure", test_gen_unknown_structure);
+}
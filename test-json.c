@@ -0,0 +1,203 @@
+#include <CUnit/CUnit.h>
+#include <CUnit/Basic.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sparsexml.h"
+#include "sparsexml-json.h"
+
+/*
+ * JSON conversion tests: element, attribute and text conventions, escaping
+ * and output through a small buffer and a sink.
+ */
+
+static char* json_read_file(const char* filename) {
+  FILE* f = fopen(filename, "rb");
+  if (!f) return NULL;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  rewind(f);
+  char* buffer = malloc(size + 1);
+  if (!buffer) { fclose(f); return NULL; }
+  size_t r = fread(buffer, 1, size, f);
+  buffer[r] = '\0';
+  fclose(f);
+  return buffer;
+}
+
+// Converts a whole document into out, NUL-terminated
+static unsigned char json_convert(const char* xml, unsigned int options, char* out, unsigned int size) {
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLJson* json = sxml_make_json(ex, out, size - 1);
+  unsigned char ret;
+
+  sxml_json_set_options(json, options);
+  ret = sxml_run_explorer(ex, (char*)xml);
+  if (ret == SXMLExplorerComplete) {
+    ret = sxml_json_finish(json);
+  }
+  out[sxml_json_length(json)] = '\0';
+  sxml_destroy_json(json);
+  sxml_destroy_explorer(ex);
+  return ret;
+}
+
+typedef struct {
+  char* data;
+  unsigned int len;
+  unsigned int calls;
+  unsigned int largest;
+} JsonSink;
+
+static unsigned char json_collect(void* user, const char* data, unsigned int len) {
+  JsonSink* sink = user;
+  memcpy(sink->data + sink->len, data, len);
+  sink->len += len;
+  sink->data[sink->len] = '\0';
+  sink->largest = len > sink->largest ? len : sink->largest;
+  sink->calls++;
+  return SXMLExplorerContinue;
+}
+
+void test_json_conventions(void) {
+  char out[512];
+
+  CU_ASSERT_EQUAL(json_convert("<?xml version=\"1.0\"?>\n<a>hi</a>", 0, out, sizeof(out)), SXMLExplorerContinue);
+  CU_ASSERT_STRING_EQUAL(out, "{\"a\":\"hi\"}");
+
+  // Attributes and children make an object; text next to them is "#text"
+  json_convert("<?xml version=\"1.0\"?>\n"
+               "<feed lang=\"en\">\n  <title type=\"text\">News</title>\n  <empty/>\n  <blank>  </blank>\n"
+               "  <p>one <b>two</b> three</p>\n</feed>", 0, out, sizeof(out));
+  CU_ASSERT_STRING_EQUAL(out, "{\"feed\":{\"@lang\":\"en\",\"title\":{\"@type\":\"text\",\"#text\":\"News\"},"
+                              "\"empty\":null,\"blank\":null,\"p\":{\"#text\":\"one \",\"b\":\"two\",\"#text\":\" three\"}}}");
+
+  // Repeated children stay repeated keys by default
+  json_convert("<r><i>1</i><i>2</i><j/><i>3</i></r>", 0, out, sizeof(out));
+  CU_ASSERT_STRING_EQUAL(out, "{\"r\":{\"i\":\"1\",\"i\":\"2\",\"j\":null,\"i\":\"3\"}}");
+
+  // Arrays: adjacent namesakes share one array, the root stays bare
+  json_convert("<r><i>1</i><i>2</i><j/><i>3</i><k><i/></k></r>", SXMLJsonArrays, out, sizeof(out));
+  CU_ASSERT_STRING_EQUAL(out, "{\"r\":{\"i\":[\"1\",\"2\"],\"j\":[null],\"i\":[\"3\"],\"k\":[{\"i\":[null]}]}}");
+  json_convert("<r><i>a</i>text<i>b</i></r>", SXMLJsonArrays, out, sizeof(out));
+  CU_ASSERT_STRING_EQUAL(out, "{\"r\":{\"i\":[\"a\"],\"#text\":\"text\",\"i\":[\"b\"]}}");
+
+  // Typed values: only whole JSON numbers and booleans are left unquoted
+  json_convert("<r n=\"-1.5e3\" b=\"true\"><i> 42 </i><i>007</i><i>1.</i><i>0x10</i><i>False</i><i>-0.25</i></r>",
+               SXMLJsonTypedValues, out, sizeof(out));
+  CU_ASSERT_STRING_EQUAL(out, "{\"r\":{\"@n\":-1.5e3,\"@b\":true,\"i\":42,\"i\":\"007\",\"i\":\"1.\","
+                              "\"i\":\"0x10\",\"i\":\"False\",\"i\":-0.25}}");
+
+  // Other keys, attributes dropped
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLJson* json = sxml_make_json(ex, out, sizeof(out) - 1);
+  CU_ASSERT_EQUAL(sxml_json_set_keys(json, "-", "$"), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_json_set_keys(json, "-", "a-key-far-too-long"), SXMLExplorerErrorBufferOverflow);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, "<r id=\"1\">x<y/></r>"), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(sxml_json_finish(json), SXMLExplorerContinue);
+  out[sxml_json_length(json)] = '\0';
+  CU_ASSERT_STRING_EQUAL(out, "{\"r\":{\"-id\":\"1\",\"$\":\"x\",\"y\":null}}");
+  sxml_destroy_json(json);
+  sxml_destroy_explorer(ex);
+
+  json_convert("<r id=\"1\"><y/></r>", SXMLJsonSkipAttributes, out, sizeof(out));
+  CU_ASSERT_STRING_EQUAL(out, "{\"r\":{\"y\":null}}");
+  json_convert("<r id=\"1\"/>", SXMLJsonSkipAttributes, out, sizeof(out));
+  CU_ASSERT_STRING_EQUAL(out, "{\"r\":null}");
+}
+
+void test_json_escaping(void) {
+  char out[512];
+
+  // References are decoded, CDATA joins the surrounding text
+  json_convert("<r a=\"&quot;q&quot;\">x &amp; y <![CDATA[<b>\"]]> <![CDATA[z]]></r>", 0, out, sizeof(out));
+  CU_ASSERT_STRING_EQUAL(out, "{\"r\":{\"@a\":\"\\\"q\\\"\",\"#text\":\"x & y <b>\\\" z\"}}");
+
+  // Escapes on both sides of eight-byte boundaries, UTF-8 passed through
+  json_convert("<r>abcdefgh\\ijklmnop\tqrstuvw\x01xyz\"\xc3\xa9t\xc3\xa9\nend</r>", 0, out, sizeof(out));
+  CU_ASSERT_STRING_EQUAL(out, "{\"r\":\"abcdefgh\\\\ijklmnop\\tqrstuvw\\u0001xyz\\\"\xc3\xa9t\xc3\xa9\\nend\"}");
+
+  json_convert("<r>\r\x1f\b\f</r>", 0, out, sizeof(out));
+  CU_ASSERT_STRING_EQUAL(out, "{\"r\":\"\\r\\u001f\\b\\f\"}");
+
+  // Names are escaped as well
+  json_convert("<r><a-b.c_d/></r>", 0, out, sizeof(out));
+  CU_ASSERT_STRING_EQUAL(out, "{\"r\":{\"a-b.c_d\":null}}");
+}
+
+void test_json_sink(void) {
+  char* xml = json_read_file("test-data/test-large-document.xml");
+  char* whole = malloc(1 << 20);
+  JsonSink sink = { malloc(1 << 20), 0, 0, 0 };
+  char small[61];
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(whole);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(sink.data);
+
+  CU_ASSERT_EQUAL(json_convert(xml, SXMLJsonArrays, whole, 1 << 20), SXMLExplorerContinue);
+  CU_ASSERT(strncmp(whole, "{\"library\":{", 12) == 0);
+  CU_ASSERT(strstr(whole, "\"book\":[{\"@id\":\"book001\"") != NULL);
+
+  // The same bytes through a 61-byte buffer
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLJson* json = sxml_make_json(ex, small, sizeof(small));
+  sxml_json_set_options(json, SXMLJsonArrays);
+  sxml_json_register_sink_func(json, json_collect, &sink);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(sxml_json_finish(json), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_json_length(json), 0);
+  CU_ASSERT_STRING_EQUAL(sink.data, whole);
+  CU_ASSERT_EQUAL(sink.largest, sizeof(small));
+  CU_ASSERT(sink.calls > strlen(whole) / sizeof(small));
+  sxml_destroy_json(json);
+  sxml_destroy_explorer(ex);
+
+  // Without a sink the buffer has to hold everything
+  CU_ASSERT_EQUAL(json_convert(xml, 0, small, sizeof(small)), SXMLExplorerErrorBufferOverflow);
+
+  // Pending text past the explorer's buffer is an error, not cut short
+  char* long_xml = malloc(2048);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(long_xml);
+  strcpy(long_xml, "<r>");
+  memset(long_xml + 3, 'x', 900);
+  strcpy(long_xml + 903, "<![CDATA[");
+  memset(long_xml + 912, 'y', 900);
+  strcpy(long_xml + 1812, "]]></r>");
+  CU_ASSERT_EQUAL(json_convert(long_xml, 0, whole, 1 << 20), SXMLExplorerErrorBufferOverflow);
+  memset(long_xml + 3, 'x', 1100);
+  strcpy(long_xml + 1103, "</r>");
+  CU_ASSERT_EQUAL(json_convert(long_xml, 0, whole, 1 << 20), SXMLExplorerErrorBufferOverflow);
+  long_xml[1003] = '\0';
+  strcat(long_xml, "<!--c-->");
+  memset(long_xml + 1011, 'z', 100);
+  strcpy(long_xml + 1111, "</r>");
+  CU_ASSERT_EQUAL(json_convert(long_xml, 0, whole, 1 << 20), SXMLExplorerErrorBufferOverflow);
+  memset(long_xml + 3, 'x', 1000);
+  strcpy(long_xml + 1003, "</r>");
+  CU_ASSERT_EQUAL(json_convert(long_xml, 0, whole, 1 << 20), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(strlen(whole), 1000 + strlen("{\"r\":\"\"}"));
+  free(long_xml);
+
+  // Open elements at finish
+  ex = sxml_make_explorer();
+  json = sxml_make_json(ex, small, sizeof(small));
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, "<r><a>"), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(sxml_json_finish(json), SXMLExplorerErrorMalformedXML);
+  sxml_destroy_json(json);
+  sxml_destroy_explorer(ex);
+
+  // A document without elements is an empty object
+  CU_ASSERT_EQUAL(json_convert("<?xml version=\"1.0\"?>\n", 0, small, sizeof(small)), SXMLExplorerContinue);
+  CU_ASSERT_STRING_EQUAL(small, "{}");
+
+  free(sink.data);
+  free(whole);
+  free(xml);
+}
+
+void add_json_tests(CU_pSuite* suite) {
+  CU_add_test(*suite, "JSON conventions", test_json_conventions);
+  CU_add_test(*suite, "JSON escaping", test_json_escaping);
+  CU_add_test(*suite, "JSON through a sink", test_json_sink);
+}
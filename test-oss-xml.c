@@ -545,6 +545,92 @@ void test_large_document_xml(void) {
     free(xml);
 }
 
+// Namespace scope tests: the namespace func logs "+uri|local" / "-uri|local"
+typedef struct {
+  SXMLExplorer* explorer;
+  char text[4096];
+  unsigned int dc_titles;
+  unsigned int library_elements;
+} NamespaceLog;
+
+static unsigned char namespace_log_element(void* user, unsigned int uri, char* local, unsigned int len, unsigned char end) {
+  NamespaceLog* log = user;
+  const char* uri_text = uri == SXMLNamespaceUnbound ? "?" : sxml_namespace_uri(log->explorer, uri);
+  size_t used = strlen(log->text);
+  CU_ASSERT(uri == SXMLNamespaceUnbound || uri_text != NULL);
+  snprintf(log->text + used, sizeof(log->text) - used, "%c%s|%.*s ", end ? '-' : '+', uri_text, (int)len, local);
+  if (!end && uri != SXMLNamespaceUnbound && strcmp(uri_text, "http://purl.org/dc/elements/1.1/") == 0 &&
+      len == 5 && strncmp(local, "title", 5) == 0) {
+    log->dc_titles++;
+  }
+  if (!end && uri != SXMLNamespaceUnbound && strcmp(uri_text, "http://example.com/library") == 0) {
+    log->library_elements++;
+  }
+  return SXMLExplorerContinue;
+}
+
+void test_namespace_scopes(void) {
+  char xml[] = "<?xml version=\"1.0\"?>"
+               "<r xmlns=\"urn:d\" xmlns:p=\"urn:p\">"
+               "<p:a/><b x=\"1\"/><p:c xmlns:p=\"urn:q\" y=\"2\" /><p:d>t</p:d>"
+               "<e xmlns=\"\"><q:f/></e><g/></r>";
+  static NamespaceLog log;
+  memset(&log, 0, sizeof(log));
+
+  log.explorer = sxml_make_explorer();
+  sxml_enable_namespace_processing(log.explorer, 1);
+  sxml_register_namespace_func(log.explorer, namespace_log_element, &log);
+  CU_ASSERT_EQUAL(sxml_run_explorer(log.explorer, xml), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(log.text,
+    "+urn:d|r +urn:p|a -urn:p|a +urn:d|b -urn:d|b +urn:q|c -urn:q|c "
+    "+urn:p|d -urn:p|d +|e +?|f -?|f -|e +urn:d|g -urn:d|g -urn:d|r ");
+
+  // Everything is popped again at the end of the document
+  CU_ASSERT_EQUAL(sxml_resolve_prefix(log.explorer, "p", 1), SXMLNamespaceUnbound);
+  CU_ASSERT_EQUAL(sxml_resolve_prefix(log.explorer, "", 0), SXMLNamespaceNone);
+  sxml_destroy_explorer(log.explorer);
+}
+
+void test_namespace_large_document(void) {
+  char* xml = read_file_to_string("test-data/test-large-document.xml");
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  static NamespaceLog log, resumed;
+  unsigned char blob[4096];
+  unsigned long len = strlen(xml);
+  memset(&log, 0, sizeof(log));
+  memset(&resumed, 0, sizeof(resumed));
+
+  log.explorer = sxml_make_explorer();
+  sxml_enable_namespace_processing(log.explorer, 1);
+  sxml_register_namespace_func(log.explorer, namespace_log_element, &log);
+  CU_ASSERT_EQUAL(sxml_run_explorer(log.explorer, xml), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(log.dc_titles, 1);
+  CU_ASSERT(log.library_elements > 10);
+  CU_ASSERT(strstr(log.text, "+http://purl.org/dc/elements/1.1/|creator ") != NULL);
+  CU_ASSERT(strstr(log.text, "+http://example.com/library|book ") != NULL);
+  CU_ASSERT(strstr(log.text, "?") == NULL);
+
+  // Scopes survive a snapshot taken mid-document
+  SXMLExplorer* first = sxml_make_explorer();
+  sxml_enable_namespace_processing(first, 1);
+  resumed.explorer = first;
+  sxml_register_namespace_func(first, namespace_log_element, &resumed);
+  CU_ASSERT_EQUAL(sxml_run_explorer_budget(first, xml, len / 2, 0), SXMLExplorerSuspended);
+  unsigned int size = sxml_snapshot_explorer(first, blob, sizeof(blob));
+  CU_ASSERT_FATAL(size <= sizeof(blob));
+  sxml_destroy_explorer(first);
+
+  resumed.explorer = sxml_make_explorer();
+  CU_ASSERT_EQUAL(sxml_restore_explorer(resumed.explorer, blob, size), SXMLExplorerContinue);
+  sxml_register_namespace_func(resumed.explorer, namespace_log_element, &resumed);
+  CU_ASSERT_EQUAL(sxml_run_explorer(resumed.explorer, xml + sxml_explorer_offset(resumed.explorer)), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(resumed.text, log.text);
+
+  sxml_destroy_explorer(resumed.explorer);
+  sxml_destroy_explorer(log.explorer);
+  free(xml);
+}
+
 void add_oss_xml_tests(CU_pSuite* suite) {
   CU_add_test(*suite, "Real-world XML Sitemap parsing", test_real_world_xml_sitemap);
   CU_add_test(*suite, "Real-world Atom Feed parsing", test_real_world_atom_feed);
@@ -555,4 +641,6 @@ void add_oss_xml_tests(CU_pSuite* suite) {
   CU_add_test(*suite, "Parse XML with comments", test_with_comments);
   CU_add_test(*suite, "Parse XML with CDATA", test_with_cdata);
   CU_add_test(*suite, "Parse large document XML", test_large_document_xml);
+  CU_add_test(*suite, "Namespace scopes", test_namespace_scopes);
+  CU_add_test(*suite, "Namespace URIs in large document", test_namespace_large_document);
 }
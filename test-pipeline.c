@@ -0,0 +1,164 @@
+#include <CUnit/CUnit.h>
+#include <CUnit/Basic.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sched.h>
+
+#include "sparsexml.h"
+#include "sparsexml-pipeline.h"
+
+/*
+ * Threaded pipeline tests: events must reach the consumer in document order,
+ * with the same text the synchronous callbacks would see.
+ */
+
+#define PIPELINE_MAX_EVENTS 64
+
+typedef struct {
+  unsigned int count;
+  SXMLEventType types[PIPELINE_MAX_EVENTS];
+  char texts[PIPELINE_MAX_EVENTS][32];
+  unsigned int stop_after;
+  unsigned char slow;
+} PipelineRecord;
+
+static unsigned char pipeline_record_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+  PipelineRecord* record = user;
+  if (record->slow) {
+    for (int i = 0; i < 200; i++) sched_yield();
+  }
+  if (record->count < PIPELINE_MAX_EVENTS) {
+    record->types[record->count] = type;
+    snprintf(record->texts[record->count], sizeof(record->texts[0]), "%s", text);
+    CU_ASSERT_EQUAL(len, strlen(text));
+  }
+  record->count++;
+  if (record->stop_after && record->count == record->stop_after) {
+    return SXMLExplorerStop;
+  }
+  return SXMLExplorerContinue;
+}
+
+typedef struct {
+  const char* data;
+  unsigned int pos;
+  unsigned int step;
+} PipelineSource;
+
+static unsigned int pipeline_read_source(void* user, char* buf, unsigned int size) {
+  PipelineSource* source = user;
+  unsigned int left = strlen(source->data + source->pos);
+  unsigned int n = left < source->step ? left : source->step;
+  if (n > size) n = size;
+  memcpy(buf, source->data + source->pos, n);
+  source->pos += n;
+  return n;
+}
+
+static char* pipeline_read_file(const char* filename) {
+  FILE* f = fopen(filename, "rb");
+  if (!f) return NULL;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  rewind(f);
+  char* str = (char*)malloc(size + 1);
+  if (!str) { fclose(f); return NULL; }
+  fread(str, 1, size, f);
+  str[size] = '\0';
+  fclose(f);
+  return str;
+}
+
+void test_pipeline_event_order(void) {
+  char xml[] = "<?xml version=\"1.0\"?><root a=\"1\">text<child/><!--c--></root>";
+  PipelineRecord record;
+  memset(&record, 0, sizeof(record));
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLPipeline* pipeline = sxml_make_pipeline(ex, 4, SXMLPipelineBlock);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(pipeline);
+  sxml_pipeline_register_consumer(pipeline, pipeline_record_event, &record);
+  CU_ASSERT_EQUAL(sxml_pipeline_start(pipeline, xml), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(sxml_pipeline_wait(pipeline), SXMLExplorerComplete);
+
+  CU_ASSERT_EQUAL(record.count, 7);
+  CU_ASSERT(record.types[0] == SXMLEventTag && strcmp(record.texts[0], "root") == 0);
+  CU_ASSERT(record.types[1] == SXMLEventAttributeKey && strcmp(record.texts[1], "a") == 0);
+  CU_ASSERT(record.types[2] == SXMLEventAttributeValue && strcmp(record.texts[2], "1") == 0);
+  CU_ASSERT(record.types[3] == SXMLEventContent && strcmp(record.texts[3], "text") == 0);
+  CU_ASSERT(record.types[4] == SXMLEventTag && strcmp(record.texts[4], "child/") == 0);
+  CU_ASSERT(record.types[5] == SXMLEventComment && strcmp(record.texts[5], "c") == 0);
+  CU_ASSERT(record.types[6] == SXMLEventTag && strcmp(record.texts[6], "/root") == 0);
+  CU_ASSERT_EQUAL(sxml_pipeline_dropped(pipeline), 0);
+
+  sxml_destroy_pipeline(pipeline);
+  sxml_destroy_explorer(ex);
+}
+
+void test_pipeline_reader_stage(void) {
+  char* xml = pipeline_read_file("test-data/test-sitemap.xml");
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  PipelineRecord record;
+  PipelineSource source = { xml, 0, 7 };
+  unsigned int tags = 0;
+  memset(&record, 0, sizeof(record));
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLPipeline* pipeline = sxml_make_pipeline(ex, 2, SXMLPipelineBlock);
+  sxml_pipeline_register_reader(pipeline, pipeline_read_source, &source);
+  sxml_pipeline_register_consumer(pipeline, pipeline_record_event, &record);
+  sxml_pipeline_start(pipeline, NULL);
+  CU_ASSERT_EQUAL(sxml_pipeline_wait(pipeline), SXMLExplorerComplete);
+
+  for (unsigned int i = 0; i < record.count && i < PIPELINE_MAX_EVENTS; i++) {
+    if (record.types[i] == SXMLEventTag) tags++;
+  }
+  CU_ASSERT_EQUAL(tags, 12);
+
+  sxml_destroy_pipeline(pipeline);
+  sxml_destroy_explorer(ex);
+  free(xml);
+}
+
+void test_pipeline_consumer_stop(void) {
+  char xml[] = "<a><b>1</b><b>2</b><b>3</b><b>4</b></a>";
+  PipelineRecord record;
+  memset(&record, 0, sizeof(record));
+  record.stop_after = 3;
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLPipeline* pipeline = sxml_make_pipeline(ex, 2, SXMLPipelineBlock);
+  sxml_pipeline_register_consumer(pipeline, pipeline_record_event, &record);
+  sxml_pipeline_start(pipeline, xml);
+  CU_ASSERT_EQUAL(sxml_pipeline_wait(pipeline), SXMLExplorerInterrupted);
+  CU_ASSERT_EQUAL(record.count, 3);
+
+  sxml_destroy_pipeline(pipeline);
+  sxml_destroy_explorer(ex);
+}
+
+void test_pipeline_drop_backpressure(void) {
+  char xml[] = "<a><b>1</b><b>2</b><b>3</b><b>4</b><b>5</b><b>6</b><b>7</b><b>8</b></a>";
+  PipelineRecord record;
+  memset(&record, 0, sizeof(record));
+  record.slow = 1;
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLPipeline* pipeline = sxml_make_pipeline(ex, 2, SXMLPipelineDrop);
+  sxml_pipeline_register_consumer(pipeline, pipeline_record_event, &record);
+  sxml_pipeline_start(pipeline, xml);
+  CU_ASSERT_EQUAL(sxml_pipeline_wait(pipeline), SXMLExplorerComplete);
+  // Every event is either delivered or accounted for as dropped
+  CU_ASSERT_EQUAL(record.count + sxml_pipeline_dropped(pipeline), 26);
+
+  sxml_destroy_pipeline(pipeline);
+  sxml_destroy_explorer(ex);
+}
+
+void add_pipeline_tests(CU_pSuite* suite) {
+  CU_add_test(*suite, "Pipeline delivers events in order", test_pipeline_event_order);
+  CU_add_test(*suite, "Pipeline reader stage", test_pipeline_reader_stage);
+  CU_add_test(*suite, "Pipeline consumer stop", test_pipeline_consumer_stop);
+  CU_add_test(*suite, "Pipeline drop backpressure", test_pipeline_drop_backpressure);
+}
@@ -51,7 +51,101 @@ void test_parse_separated_xml(void) {
   sxml_destroy_explorer(explorer);
 }
 
+static unsigned char test_tables_on_start(void* user, char* name, unsigned int len, SXMLAttribute* attrs, unsigned int count) {
+  return SXMLExplorerContinue;
+}
+
+void test_tables_on_first_use(void) {
+  SXMLExplorer* explorer;
+  SXMLExplorer* clone;
+  char plain[] = "<?xml version=\"1.0\"?><r a=\"1\"><x:e xmlns:x=\"u\">t &amp; u</x:e></r>";
+
+  // Features left off allocate nothing, even with entity processing on
+  explorer = sxml_make_explorer();
+  sxml_enable_entity_processing(explorer, 1);
+  CU_ASSERT_EQUAL(sxml_run_explorer(explorer, plain), SXMLExplorerComplete);
+  CU_ASSERT_PTR_NULL(explorer->entities);
+  CU_ASSERT_PTR_NULL(explorer->ns);
+  CU_ASSERT_PTR_NULL(explorer->symbols);
+  CU_ASSERT_STRING_EQUAL(sxml_name(explorer, SXMLNamespaceNone), "");
+  CU_ASSERT_EQUAL(sxml_resolve_prefix(explorer, "", 0), SXMLNamespaceNone);
+  clone = sxml_clone_explorer(explorer);
+  CU_ASSERT_PTR_NULL(clone->entities);
+  CU_ASSERT_PTR_NULL(clone->ns);
+  CU_ASSERT_PTR_NULL(clone->symbols);
+  CU_ASSERT_PTR_NULL(clone->handlers);
+  CU_ASSERT_PTR_NULL(clone->elements);
+  CU_ASSERT_PTR_NULL(clone->attrs);
+  CU_ASSERT_STRING_EQUAL(sxml_element_path(clone, NULL), "");
+  sxml_destroy_explorer(clone);
+
+  // A binding allocates the table; clones get their own copy
+  CU_ASSERT_EQUAL(sxml_register_entity(explorer, "v", "w"), SXMLExplorerContinue);
+  CU_ASSERT_PTR_NOT_NULL(explorer->entities);
+  clone = sxml_clone_explorer(explorer);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(clone->entities);
+  CU_ASSERT(clone->entities != explorer->entities);
+  CU_ASSERT_EQUAL(memcmp(clone->entities, explorer->entities, sizeof(*clone->entities)), 0);
+  sxml_destroy_explorer(clone);
+
+  // So does the first element handler
+  CU_ASSERT_PTR_NULL(explorer->handlers);
+  CU_ASSERT_EQUAL(sxml_on_element(explorer, "e", NULL, NULL), SXMLExplorerContinue);
+  CU_ASSERT_PTR_NOT_NULL(explorer->handlers);
+  clone = sxml_clone_explorer(explorer);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(clone->handlers);
+  CU_ASSERT(clone->handlers != explorer->handlers);
+  CU_ASSERT_EQUAL(memcmp(clone->handlers, explorer->handlers, sizeof(*clone->handlers)), 0);
+  sxml_destroy_explorer(clone);
+  sxml_destroy_explorer(explorer);
+
+  // Namespace scopes appear with the first tag once processing is on
+  explorer = sxml_make_explorer();
+  sxml_enable_namespace_processing(explorer, 1);
+  CU_ASSERT_EQUAL(sxml_run_explorer_budget(explorer, plain, strstr(plain, ">t") - plain, 0), SXMLExplorerSuspended);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(explorer->ns);
+  CU_ASSERT_EQUAL(explorer->ns_count, 1);
+  clone = sxml_clone_explorer(explorer);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(clone->ns);
+  CU_ASSERT(clone->ns != explorer->ns);
+  CU_ASSERT_EQUAL(clone->ns->bindings[0].uri, explorer->ns->bindings[0].uri);
+  // The binding interned its prefix and URI next to the empty name
+  CU_ASSERT_PTR_NOT_NULL_FATAL(clone->symbols);
+  CU_ASSERT(clone->symbols != explorer->symbols);
+  CU_ASSERT_STRING_EQUAL(sxml_name(clone, SXMLNamespaceNone), "");
+  CU_ASSERT_STRING_EQUAL(sxml_namespace_uri(clone, sxml_resolve_prefix(clone, "x", 1)), "u");
+  sxml_destroy_explorer(clone);
+  sxml_destroy_explorer(explorer);
+
+  // The element stack comes with the first tracked start tag
+  explorer = sxml_make_explorer();
+  sxml_enable_element_path(explorer, 1);
+  CU_ASSERT_PTR_NULL(explorer->elements);
+  CU_ASSERT_EQUAL(sxml_run_explorer_budget(explorer, plain, strstr(plain, ">t") - plain, 0), SXMLExplorerSuspended);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(explorer->elements);
+  clone = sxml_clone_explorer(explorer);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(clone->elements);
+  CU_ASSERT(clone->elements != explorer->elements);
+  CU_ASSERT_STRING_EQUAL(sxml_element_path(clone, NULL), "r/x:e");
+  CU_ASSERT_PTR_NULL(clone->attrs);
+  sxml_destroy_explorer(clone);
+  sxml_destroy_explorer(explorer);
+
+  // The attribute batch comes with the first start tag it collects
+  explorer = sxml_make_explorer();
+  sxml_register_start_element_func(explorer, test_tables_on_start, NULL);
+  CU_ASSERT_EQUAL(sxml_run_explorer_budget(explorer, plain, strstr(plain, "=\"1\"") - plain, 0), SXMLExplorerSuspended);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(explorer->attrs);
+  clone = sxml_clone_explorer(explorer);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(clone->attrs);
+  CU_ASSERT(clone->attrs != explorer->attrs);
+  CU_ASSERT_STRING_EQUAL(clone->attrs->arena, "r");
+  sxml_destroy_explorer(clone);
+  sxml_destroy_explorer(explorer);
+}
+
 void add_private_test(CU_pSuite* suite) {
   CU_add_test(*suite, "initialize phase", test_initialize_explorer);
   CU_add_test(*suite, "Parse simple separated XML", test_parse_separated_xml);
+  CU_add_test(*suite, "Feature tables allocated on first use", test_tables_on_first_use);
 }
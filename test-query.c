@@ -0,0 +1,246 @@
+#include <CUnit/CUnit.h>
+#include <CUnit/Basic.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sparsexml.h"
+#include "sparsexml-query.h"
+
+/*
+ * Streaming query tests: each match reports its query id and value in
+ * document order, the same however the input is budgeted.
+ */
+
+#define QUERY_MAX_MATCHES 64
+
+typedef struct {
+  unsigned int count;
+  unsigned int queries[QUERY_MAX_MATCHES];
+  char values[QUERY_MAX_MATCHES][64];
+  unsigned int stop_after;
+} QueryLog;
+
+static unsigned char query_log_match(void* user, unsigned int query, char* value, unsigned int len) {
+  QueryLog* log = user;
+  if (log->count < QUERY_MAX_MATCHES) {
+    log->queries[log->count] = query;
+    snprintf(log->values[log->count], sizeof(log->values[0]), "%.*s", (int)len, value);
+  }
+  log->count++;
+  if (log->stop_after && log->count == log->stop_after) {
+    return SXMLExplorerStop;
+  }
+  return SXMLExplorerContinue;
+}
+
+static unsigned int query_log_count(QueryLog* log, unsigned int query) {
+  unsigned int i, n = 0;
+  for (i = 0; i < log->count && i < QUERY_MAX_MATCHES; i++) {
+    if (log->queries[i] == query) n++;
+  }
+  return n;
+}
+
+static const char* query_log_value(QueryLog* log, unsigned int query, unsigned int nth) {
+  unsigned int i;
+  for (i = 0; i < log->count && i < QUERY_MAX_MATCHES; i++) {
+    if (log->queries[i] == query && nth-- == 0) return log->values[i];
+  }
+  return "";
+}
+
+static char* query_read_file(const char* filename) {
+  FILE* f = fopen(filename, "rb");
+  if (!f) return NULL;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  rewind(f);
+  char* str = (char*)malloc(size + 1);
+  if (!str) { fclose(f); return NULL; }
+  fread(str, 1, size, f);
+  str[size] = '\0';
+  fclose(f);
+  return str;
+}
+
+void test_query_forms(void) {
+  char xml[] = "<?xml version=\"1.0\"?><a><b k=\"v\" id=\"1\"><c>one</c></b><b k=\"w\" id=\"2\"><c>two</c><d/></b>"
+               "<x><a><c>deep</c></a></x></a>";
+  QueryLog log;
+  memset(&log, 0, sizeof(log));
+
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLQuerySet* set = sxml_make_query_set(ex);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(set);
+  sxml_query_register_match_func(set, query_log_match, &log);
+
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/a/b/c"), 0);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/a/b/c/text()"), 1);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "//c/text()"), 2);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/a/b/@id"), 3);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/a/b[@k='w']/c/text()"), 4);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "//a//c"), 5);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/a/*/d"), 6);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "//@k"), 7);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/a/b[@k]"), 8);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+
+  CU_ASSERT_EQUAL(query_log_count(&log, 0), 2);
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 0, 0), "c");
+  CU_ASSERT_EQUAL(query_log_count(&log, 1), 2);
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 1, 1), "two");
+  CU_ASSERT_EQUAL(query_log_count(&log, 2), 3);
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 2, 2), "deep");
+  CU_ASSERT_EQUAL(query_log_count(&log, 3), 2);
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 3, 0), "1");
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 3, 1), "2");
+  CU_ASSERT_EQUAL(query_log_count(&log, 4), 1);
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 4, 0), "two");
+  // Reached through two <a> ancestors, reported once
+  CU_ASSERT_EQUAL(query_log_count(&log, 5), 3);
+  CU_ASSERT_EQUAL(query_log_count(&log, 6), 1);
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 6, 0), "d");
+  CU_ASSERT_EQUAL(query_log_count(&log, 7), 2);
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 7, 1), "w");
+  CU_ASSERT_EQUAL(query_log_count(&log, 8), 2);
+
+  // Document order: the attribute of the first <b> precedes its text
+  CU_ASSERT_EQUAL(log.queries[0], 3);
+  CU_ASSERT_EQUAL(log.queries[1], 7);
+  CU_ASSERT_EQUAL(log.queries[2], 8);
+
+  sxml_destroy_query_set(set);
+  sxml_destroy_explorer(ex);
+}
+
+void test_query_feeds(void) {
+  char* rss = query_read_file("test-data/test-rss.xml");
+  char* atom = query_read_file("test-data/test-oss-1.xml");
+  QueryLog log;
+  CU_ASSERT_PTR_NOT_NULL_FATAL(rss);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(atom);
+
+  memset(&log, 0, sizeof(log));
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLQuerySet* set = sxml_make_query_set(ex);
+  sxml_query_register_match_func(set, query_log_match, &log);
+  sxml_add_query(set, "/rss/channel/item/title/text()");
+  sxml_add_query(set, "//item/guid[@isPermaLink='false']/text()");
+  sxml_add_query(set, "//link/text()");
+  sxml_add_query(set, "/rss/@version");
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, rss), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 0, 0), "Example entry");
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 1, 0), "7bd204c6-1655-4c27-aeee-53f933c5395f");
+  CU_ASSERT_EQUAL(query_log_count(&log, 2), 2);
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 2, 1), "http://www.example.com/blog/post/1");
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 3, 0), "2.0");
+  sxml_destroy_query_set(set);
+  sxml_destroy_explorer(ex);
+
+  // Atom with entities on: one pass, feed-level and entry-level rules
+  memset(&log, 0, sizeof(log));
+  ex = sxml_make_explorer();
+  sxml_enable_entity_processing(ex, 1);
+  set = sxml_make_query_set(ex);
+  sxml_query_register_match_func(set, query_log_match, &log);
+  sxml_add_query(set, "/feed/id/text()");
+  sxml_add_query(set, "/feed/entry/id/text()");
+  sxml_add_query(set, "//entry/link/@href");
+  sxml_add_query(set, "/feed/entry/summary/text()");
+  sxml_add_query(set, "/feed/author/name/text()");
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, atom), SXMLExplorerComplete);
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 0, 0), "urn:uuid:60a76c80-d399-11d9-b93C-0003939e0af6");
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 1, 0), "urn:uuid:1225c695-cfb8-4ebb-aaaa-80da344efa6a");
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 2, 0), "http://example.org/2003/12/13/atom03");
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 3, 0), "Some text & more \"quoted\" content");
+  CU_ASSERT_STRING_EQUAL(query_log_value(&log, 4, 0), "John Doe");
+  CU_ASSERT_EQUAL(log.count, 5);
+  sxml_destroy_query_set(set);
+  sxml_destroy_explorer(ex);
+
+  free(rss);
+  free(atom);
+}
+
+void test_query_compile_errors(void) {
+  SXMLExplorer* ex = sxml_make_explorer();
+  SXMLQuerySet* set = sxml_make_query_set(ex);
+  char name[16];
+
+  CU_ASSERT_EQUAL(sxml_add_query(set, "a/b"), SXMLQueryInvalid);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/"), SXMLQueryInvalid);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/@id"), SXMLQueryInvalid);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/text()"), SXMLQueryInvalid);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/a[@k='v'"), SXMLQueryInvalid);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/a[k='v']"), SXMLQueryInvalid);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/a[@k=v]"), SXMLQueryInvalid);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/a/text()/b"), SXMLQueryInvalid);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/a/@id/b"), SXMLQueryInvalid);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/a//"), SXMLQueryInvalid);
+
+  // Ids stay dense after failures; identical expressions share their states
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/a/b"), 0);
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/a/b"), 1);
+  for (unsigned int i = 2; i < SXMLQueryMax; i++) {
+    snprintf(name, sizeof(name), "//q%u", i);
+    CU_ASSERT_EQUAL(sxml_add_query(set, name), i);
+  }
+  CU_ASSERT_EQUAL(sxml_add_query(set, "/a"), SXMLQueryInvalid);
+
+  sxml_destroy_query_set(set);
+  sxml_destroy_explorer(ex);
+}
+
+void test_query_budget_and_stop(void) {
+  char* xml = query_read_file("test-data/test-large-document.xml");
+  QueryLog whole, budgeted, stopped;
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  memset(&whole, 0, sizeof(whole));
+  memset(&budgeted, 0, sizeof(budgeted));
+  memset(&stopped, 0, sizeof(stopped));
+  stopped.stop_after = 2;
+
+  QueryLog* logs[] = { &whole, &budgeted, &stopped };
+  for (unsigned int run = 0; run < 3; run++) {
+    SXMLExplorer* ex = sxml_make_explorer();
+    SXMLQuerySet* set = sxml_make_query_set(ex);
+    unsigned char result = SXMLExplorerComplete;
+    sxml_query_register_match_func(set, query_log_match, logs[run]);
+    sxml_add_query(set, "//book/title/text()");
+    sxml_add_query(set, "//book[@category='fantasy']//keyword/text()");
+    sxml_add_query(set, "//format[@type='ebook']/@price");
+    if (run == 1) {
+      unsigned long pos = 0;
+      while ((result = sxml_run_explorer_budget(ex, xml + pos, 11, 0)) == SXMLExplorerSuspended) {
+        pos += sxml_explorer_consumed(ex);
+      }
+    } else {
+      result = sxml_run_explorer(ex, xml);
+    }
+    CU_ASSERT_EQUAL(result, run == 2 ? SXMLExplorerInterrupted : SXMLExplorerComplete);
+    sxml_destroy_query_set(set);
+    sxml_destroy_explorer(ex);
+  }
+
+  CU_ASSERT_EQUAL(query_log_count(&whole, 0), 5);
+  CU_ASSERT_STRING_EQUAL(query_log_value(&whole, 0, 0), "The Quantum Paradox");
+  CU_ASSERT_EQUAL(query_log_count(&whole, 1), 4);
+  CU_ASSERT_STRING_EQUAL(query_log_value(&whole, 1, 1), "magic");
+  CU_ASSERT_STRING_EQUAL(query_log_value(&whole, 2, 0), "12.99");
+  CU_ASSERT_EQUAL(budgeted.count, whole.count);
+  for (unsigned int i = 0; i < whole.count && i < QUERY_MAX_MATCHES; i++) {
+    CU_ASSERT_EQUAL(budgeted.queries[i], whole.queries[i]);
+    CU_ASSERT_STRING_EQUAL(budgeted.values[i], whole.values[i]);
+  }
+  CU_ASSERT_EQUAL(stopped.count, 2);
+
+  free(xml);
+}
+
+void add_query_tests(CU_pSuite* suite) {
+  CU_add_test(*suite, "Query forms", test_query_forms);
+  CU_add_test(*suite, "Queries on RSS and Atom", test_query_feeds);
+  CU_add_test(*suite, "Query compile errors", test_query_compile_errors);
+  CU_add_test(*suite, "Queries across budgeted runs and stop", test_query_budget_and_stop);
+}
@@ -0,0 +1,228 @@
+#include <CUnit/CUnit.h>
+#include <CUnit/Basic.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sparsexml-priv.h"
+#include "sparsexml-shard.h"
+#include "sparsexml-query.h"
+
+/*
+ * Shard planner tests: every cut must leave the explorer IN_CONTENT with an
+ * empty buffer, and sharded parsing must produce exactly the events of a
+ * whole-document parse.
+ */
+
+typedef struct {
+  char text[32768];
+  unsigned int len;
+} ShardLog;
+
+static unsigned char shard_log_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+  ShardLog* log = user;
+  int n = snprintf(log->text + log->len, sizeof(log->text) - log->len, "%d:%s|", (int)type, text);
+  if (n > 0 && log->len + n < sizeof(log->text)) log->len += n;
+  return SXMLExplorerContinue;
+}
+
+static char* shard_read_file(const char* filename) {
+  FILE* f = fopen(filename, "rb");
+  if (!f) return NULL;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  rewind(f);
+  char* str = (char*)malloc(size + 1);
+  if (!str) { fclose(f); return NULL; }
+  fread(str, 1, size, f);
+  str[size] = '\0';
+  fclose(f);
+  return str;
+}
+
+static void shard_check_document(const char* path, unsigned long target) {
+  char* xml = shard_read_file(path);
+  CU_ASSERT_PTR_NOT_NULL_FATAL(xml);
+  unsigned long len = strlen(xml);
+  static ShardLog whole, sharded;
+  SXMLShard shards[64];
+
+  memset(&whole, 0, sizeof(whole));
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_register_event_func(ex, shard_log_event, &whole);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  sxml_destroy_explorer(ex);
+
+  unsigned int count = sxml_plan_shards(xml, len, target, shards, 64);
+  CU_ASSERT(count > 1);
+  CU_ASSERT_EQUAL(shards[0].begin, 0);
+  CU_ASSERT_EQUAL(shards[count - 1].end, len);
+
+  memset(&sharded, 0, sizeof(sharded));
+  for (unsigned int i = 0; i < count; i++) {
+    if (i > 0) {
+      CU_ASSERT_EQUAL(shards[i].begin, shards[i - 1].end);
+      CU_ASSERT_EQUAL(xml[shards[i].begin - 1], '>');
+
+      // The real explorer agrees that the cut is a clean IN_CONTENT point
+      SXMLExplorer* probe = sxml_make_explorer();
+      CU_ASSERT_EQUAL(sxml_run_explorer_budget(probe, xml, shards[i].begin, 0), SXMLExplorerSuspended);
+      CU_ASSERT_EQUAL(sxml_explorer_consumed(probe), shards[i].begin);
+      CU_ASSERT_EQUAL(probe->state, IN_CONTENT);
+      CU_ASSERT_EQUAL(probe->bp, 0);
+      sxml_destroy_explorer(probe);
+    }
+    SXMLExplorer* worker = sxml_make_explorer();
+    sxml_register_event_func(worker, shard_log_event, &sharded);
+    CU_ASSERT_EQUAL(sxml_run_explorer_shard(worker, xml, &shards[i]), SXMLExplorerComplete);
+    CU_ASSERT_EQUAL(sxml_explorer_offset(worker), shards[i].end);
+    sxml_destroy_explorer(worker);
+  }
+  CU_ASSERT_STRING_EQUAL(sharded.text, whole.text);
+  free(xml);
+}
+
+void test_shard_plan_matches_whole_parse(void) {
+  shard_check_document("test-data/test-large-document.xml", 500);
+  shard_check_document("test-data/test-oss-1.xml", 60);
+  shard_check_document("test-data/test-with-cdata.xml", 20);
+  shard_check_document("test-data/test-with-comments.xml", 20);
+  shard_check_document("test-data/test-doctype-entities.xml", 20);
+}
+
+void test_shard_context(void) {
+  char xml[] = "<?xml version=\"1.0\"?><a><b x=\"1\"><c/><d y=\"<>\"/><!-- <e> --><f>t</f></b></a>";
+  SXMLShard shards[16];
+  unsigned int count = sxml_plan_shards(xml, strlen(xml), 1, shards, 16);
+  unsigned int i;
+
+  CU_ASSERT(count > 4);
+  for (i = 1; i < count; i++) {
+    const char* at = xml + shards[i].begin;
+    if (strncmp(at, "<c/>", 4) == 0 || strncmp(at, "<d ", 3) == 0) {
+      CU_ASSERT_STRING_EQUAL(shards[i].context, "a b");
+      CU_ASSERT_EQUAL(shards[i].depth, 2);
+    } else if (strncmp(at, "t</f>", 5) == 0) {
+      CU_ASSERT_STRING_EQUAL(shards[i].context, "a b f");
+    } else if (strncmp(at, "</a>", 4) == 0) {
+      CU_ASSERT_STRING_EQUAL(shards[i].context, "a");
+    }
+  }
+  CU_ASSERT_STRING_EQUAL(xml + shards[count - 1].begin, "</a>");
+  CU_ASSERT_EQUAL(shards[count - 1].depth, 1);
+}
+
+typedef struct {
+  SXMLExplorer* explorer;
+  ShardLog log;
+} ShardQueryLog;
+
+static void shard_log_text(ShardLog* log, const char* text) {
+  int n = snprintf(log->text + log->len, sizeof(log->text) - log->len, "%s", text);
+  if (n > 0 && log->len + n < sizeof(log->text)) log->len += n;
+}
+
+static unsigned char shard_log_match(void* user, unsigned int query, char* value, unsigned int len) {
+  ShardQueryLog* q = user;
+  char line[256];
+  snprintf(line, sizeof(line), "%u:%.*s@%s/%u|", query, (int)len, value, sxml_element_path(q->explorer, NULL),
+           sxml_element_depth(q->explorer));
+  shard_log_text(&q->log, line);
+  return SXMLExplorerContinue;
+}
+
+static unsigned char shard_log_end(void* user, unsigned int query) {
+  ShardQueryLog* q = user;
+  char line[32];
+  snprintf(line, sizeof(line), "/%u|", query);
+  shard_log_text(&q->log, line);
+  return SXMLExplorerContinue;
+}
+
+// Runs the queries over each shard in turn (one shard is the whole parse)
+static void shard_run_queries(char* xml, const SXMLShard* shards, unsigned int count, const char** queries,
+                              ShardQueryLog* q) {
+  unsigned int i, k;
+
+  memset(&q->log, 0, sizeof(q->log));
+  for (i = 0; i < count; i++) {
+    q->explorer = sxml_make_explorer();
+    SXMLQuerySet* set = sxml_make_query_set(q->explorer);
+    for (k = 0; queries[k] != NULL; k++) {
+      CU_ASSERT_EQUAL(sxml_add_query(set, queries[k]), k);
+    }
+    sxml_enable_element_path(q->explorer, 1);
+    sxml_query_register_match_func(set, shard_log_match, q);
+    sxml_query_register_end_func(set, shard_log_end, q);
+    CU_ASSERT_EQUAL(sxml_run_explorer_shard(q->explorer, xml, &shards[i]), SXMLExplorerComplete);
+    CU_ASSERT_EQUAL(sxml_element_depth(q->explorer), i + 1 < count ? shards[i + 1].depth : 0);
+    sxml_destroy_query_set(set);
+    sxml_destroy_explorer(q->explorer);
+  }
+}
+
+static void shard_check_queries(char* xml, unsigned long target, const char** queries, ShardQueryLog* whole,
+                                ShardQueryLog* sharded) {
+  SXMLShard shards[64];
+  SXMLShard all;
+  unsigned int count = sxml_plan_shards(xml, strlen(xml), target, shards, 64);
+
+  CU_ASSERT(count > 2);
+  all.begin = 0;
+  all.end = strlen(xml);
+  all.depth = 0;
+  all.context[0] = '\0';
+  shard_run_queries(xml, &all, 1, queries, whole);
+  shard_run_queries(xml, shards, count, queries, sharded);
+  CU_ASSERT_STRING_EQUAL(sharded->log.text, whole->log.text);
+}
+
+void test_shard_element_context(void) {
+  static ShardQueryLog whole, sharded;
+  char xml[] = "<a><b><c>1</c><c>2</c><c>3</c></b></a>";
+  const char* queries[] = { "/a/b/c/text()", "/a/b", "//c", NULL };
+  const char* library[] = { "/library/books/book/title/text()", "//book/@id", "/library/books", "//dc:title/text()", NULL };
+
+  // Every shard but the first starts inside a, b or c
+  shard_check_queries(xml, 1, queries, &whole, &sharded);
+  CU_ASSERT_STRING_EQUAL(whole.log.text, "1:b@a/b/2|2:c@a/b/c/3|0:1@a/b/c/3|/2|2:c@a/b/c/3|0:2@a/b/c/3|/2|"
+                                         "2:c@a/b/c/3|0:3@a/b/c/3|/2|/1|");
+
+  char* doc = shard_read_file("test-data/test-large-document.xml");
+  CU_ASSERT_PTR_NOT_NULL_FATAL(doc);
+  shard_check_queries(doc, 500, library, &whole, &sharded);
+  CU_ASSERT(strstr(whole.log.text, "0:") != NULL);
+  CU_ASSERT(strstr(whole.log.text, "1:book001@") != NULL);
+  CU_ASSERT(strstr(whole.log.text, "3:Digital Library Collection@library/metadata/dc:title/3|") != NULL);
+  free(doc);
+}
+
+void test_shard_plan_serialization(void) {
+  SXMLShard shard, parsed;
+  char line[256];
+  shard.begin = 120;
+  shard.end = 4096;
+  shard.depth = 2;
+  strcpy(shard.context, "library books");
+
+  unsigned int n = sxml_format_shard(&shard, line, sizeof(line));
+  CU_ASSERT_EQUAL(n, strlen(line));
+  CU_ASSERT_STRING_EQUAL(line, "120 4096 2 library books\n");
+  CU_ASSERT_EQUAL(sxml_parse_shard(&parsed, line), SXMLExplorerContinue);
+  CU_ASSERT_EQUAL(parsed.begin, 120);
+  CU_ASSERT_EQUAL(parsed.end, 4096);
+  CU_ASSERT_EQUAL(parsed.depth, 2);
+  CU_ASSERT_STRING_EQUAL(parsed.context, "library books");
+
+  CU_ASSERT_EQUAL(sxml_parse_shard(&parsed, "0 10 0\n"), SXMLExplorerContinue);
+  CU_ASSERT_STRING_EQUAL(parsed.context, "");
+  CU_ASSERT_EQUAL(sxml_parse_shard(&parsed, "10 0 0"), SXMLExplorerErrorMalformedXML);
+  CU_ASSERT_EQUAL(sxml_parse_shard(&parsed, "garbage"), SXMLExplorerErrorMalformedXML);
+}
+
+void add_shard_tests(CU_pSuite* suite) {
+  CU_add_test(*suite, "Sharded parse matches whole parse", test_shard_plan_matches_whole_parse);
+  CU_add_test(*suite, "Shard open-element context", test_shard_context);
+  CU_add_test(*suite, "Shard context for element consumers", test_shard_element_context);
+  CU_add_test(*suite, "Shard plan serialization", test_shard_plan_serialization);
+}
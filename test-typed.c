@@ -0,0 +1,184 @@
+#include <CUnit/CUnit.h>
+#include <CUnit/Basic.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "sparsexml.h"
+
+/*
+ * Typed value tests: integers, doubles, booleans and timestamps converted
+ * from spans that are neither copied nor NUL-terminated.
+ */
+
+void test_typed_integers(void) {
+  long long v = 7;
+
+  CU_ASSERT(sxml_to_int("0", 1, &v) && v == 0);
+  CU_ASSERT(sxml_to_int(" +42\n", 5, &v) && v == 42);
+  CU_ASSERT(sxml_to_int("-17", 3, &v) && v == -17);
+  CU_ASSERT(sxml_to_int("1234567890123", 13, &v) && v == 1234567890123LL);
+  CU_ASSERT(sxml_to_int("00000000000000000000012", 23, &v) && v == 12);
+  CU_ASSERT(sxml_to_int("9223372036854775807", 19, &v) && v == 9223372036854775807LL);
+  CU_ASSERT(sxml_to_int("-9223372036854775808", 20, &v) && v == -9223372036854775807LL - 1);
+  // The span ends where len says, whatever follows
+  CU_ASSERT(sxml_to_int("1500</pages>", 4, &v) && v == 1500);
+
+  v = 7;
+  CU_ASSERT_FALSE(sxml_to_int("9223372036854775808", 19, &v));
+  CU_ASSERT_FALSE(sxml_to_int("-9223372036854775809", 20, &v));
+  CU_ASSERT_FALSE(sxml_to_int("99999999999999999999", 20, &v));
+  CU_ASSERT_FALSE(sxml_to_int("", 0, &v));
+  CU_ASSERT_FALSE(sxml_to_int("  ", 2, &v));
+  CU_ASSERT_FALSE(sxml_to_int("-", 1, &v));
+  CU_ASSERT_FALSE(sxml_to_int("1 2", 3, &v));
+  CU_ASSERT_FALSE(sxml_to_int("12a45678", 8, &v));
+  CU_ASSERT_FALSE(sxml_to_int("1.0", 3, &v));
+  CU_ASSERT_FALSE(sxml_to_int("0x10", 4, &v));
+  CU_ASSERT_EQUAL(v, 7);
+}
+
+void test_typed_doubles(void) {
+  double d = 7;
+  unsigned long long state = 88172645463325252ULL;
+  char text[40];
+
+  CU_ASSERT(sxml_to_double("0.8", 3, &d) && d == 0.8);
+  CU_ASSERT(sxml_to_double(" 12.99 ", 7, &d) && d == 12.99);
+  CU_ASSERT(sxml_to_double("-1.5E3", 6, &d) && d == -1500.0);
+  CU_ASSERT(sxml_to_double(".5", 2, &d) && d == 0.5);
+  CU_ASSERT(sxml_to_double("1.", 2, &d) && d == 1.0);
+  CU_ASSERT(sxml_to_double("-0", 2, &d) && d == 0.0 && signbit(d));
+  CU_ASSERT(sxml_to_double("4.9e-324", 8, &d) && d == 4.9406564584124654e-324);
+  CU_ASSERT(sxml_to_double("2.2250738585072011e-308", 23, &d) && d == 2.2250738585072011e-308);
+  CU_ASSERT(sxml_to_double("1.7976931348623157e308", 22, &d) && d == 1.7976931348623157e308);
+  CU_ASSERT(sxml_to_double("1.8e308", 7, &d) && isinf(d));
+  CU_ASSERT(sxml_to_double("1e-400", 6, &d) && d == 0.0);
+  CU_ASSERT(sxml_to_double("9007199254740993", 16, &d) && d == 9007199254740992.0);
+  CU_ASSERT(sxml_to_double("123456789012345678901234567890", 30, &d) && d == 123456789012345678901234567890.0);
+  CU_ASSERT(sxml_to_double("INF", 3, &d) && isinf(d) && d > 0);
+  CU_ASSERT(sxml_to_double("-INF", 4, &d) && isinf(d) && d < 0);
+  CU_ASSERT(sxml_to_double("NaN", 3, &d) && isnan(d));
+  CU_ASSERT(sxml_to_double("29.95\" stock", 5, &d) && d == 29.95);
+
+  d = 7;
+  CU_ASSERT_FALSE(sxml_to_double("", 0, &d));
+  CU_ASSERT_FALSE(sxml_to_double(".", 1, &d));
+  CU_ASSERT_FALSE(sxml_to_double("1e", 2, &d));
+  CU_ASSERT_FALSE(sxml_to_double("1,5", 3, &d));
+  CU_ASSERT_FALSE(sxml_to_double("0x10", 4, &d));
+  CU_ASSERT_FALSE(sxml_to_double("inf", 3, &d));
+  CU_ASSERT_FALSE(sxml_to_double("-NaN", 4, &d));
+  CU_ASSERT_EQUAL(d, 7);
+
+  // Shortest round trip of random bit patterns, every exponent range
+  unsigned int i;
+  for (i = 0; i < 100000; i++) {
+    double in, out = 0;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    memcpy(&in, &state, sizeof(in));
+    if (!isfinite(in)) continue;
+    snprintf(text, sizeof(text), "%.17g", in);
+    if (!sxml_to_double(text, (unsigned int)strlen(text), &out) || memcmp(&in, &out, sizeof(in)) != 0) {
+      break;
+    }
+  }
+  CU_ASSERT_EQUAL(i, 100000);
+}
+
+void test_typed_booleans(void) {
+  unsigned char b = 7;
+  CU_ASSERT(sxml_to_bool("true", 4, &b) && b == 1);
+  CU_ASSERT(sxml_to_bool(" 0 ", 3, &b) && b == 0);
+  CU_ASSERT(sxml_to_bool("1", 1, &b) && b == 1);
+  CU_ASSERT(sxml_to_bool("false", 5, &b) && b == 0);
+  b = 7;
+  CU_ASSERT_FALSE(sxml_to_bool("True", 4, &b));
+  CU_ASSERT_FALSE(sxml_to_bool("yes", 3, &b));
+  CU_ASSERT_FALSE(sxml_to_bool("truex", 5, &b));
+  CU_ASSERT_EQUAL(b, 7);
+}
+
+void test_typed_timestamps(void) {
+  long long s = 7;
+  unsigned int ns = 7;
+
+  CU_ASSERT(sxml_to_timestamp("2003-12-13T18:30:02Z", 20, &s, &ns) && s == 1071340202LL && ns == 0);
+  CU_ASSERT(sxml_to_timestamp("2003-12-13T18:30:02.25-05:00", 28, &s, &ns) && s == 1071358202LL && ns == 250000000);
+  CU_ASSERT(sxml_to_timestamp("2003-12-13t18:30:02.123456789123z", 33, &s, &ns) && s == 1071340202LL && ns == 123456789);
+  CU_ASSERT(sxml_to_timestamp(" 2005-01-01 ", 12, &s, NULL) && s == 1104537600LL);
+  CU_ASSERT(sxml_to_timestamp("2005-01-01T12:00+01:00", 22, &s, NULL) && s == 1104577200LL);
+  CU_ASSERT(sxml_to_timestamp("2024-02-29T00:00:00Z", 20, &s, NULL) && s == 1709164800LL);
+  CU_ASSERT(sxml_to_timestamp("1969-12-31T23:59:59Z", 20, &s, NULL) && s == -1);
+  CU_ASSERT(sxml_to_timestamp("0001-01-01T00:00:00Z", 20, &s, NULL) && s == -62135596800LL);
+  CU_ASSERT(sxml_to_timestamp("2000-02-29T12:00:00.250+01:30", 29, &s, NULL) && s == 951820200LL);
+
+  s = 7;
+  CU_ASSERT_FALSE(sxml_to_timestamp("2023-02-29", 10, &s, NULL));
+  CU_ASSERT_FALSE(sxml_to_timestamp("1900-02-29", 10, &s, NULL));
+  CU_ASSERT_FALSE(sxml_to_timestamp("2023-04-31", 10, &s, NULL));
+  CU_ASSERT_FALSE(sxml_to_timestamp("2023-13-01", 10, &s, NULL));
+  CU_ASSERT_FALSE(sxml_to_timestamp("2003-12-13T18:30:02", 19, &s, NULL));
+  CU_ASSERT_FALSE(sxml_to_timestamp("2003-12-13T24:00:00Z", 20, &s, NULL));
+  CU_ASSERT_FALSE(sxml_to_timestamp("2003-12-13T18:30:02.Z", 21, &s, NULL));
+  CU_ASSERT_FALSE(sxml_to_timestamp("2003-12-13T18:30:02+0500", 24, &s, NULL));
+  CU_ASSERT_FALSE(sxml_to_timestamp("Sun, 06 Sep 2009 16:20:00 +0000", 31, &s, NULL));
+  CU_ASSERT_FALSE(sxml_to_timestamp("2003-1-13", 9, &s, NULL));
+  CU_ASSERT_EQUAL(s, 7);
+}
+
+typedef struct {
+  unsigned int priorities;
+  double priority_sum;
+  long long lastmod;
+} TypedSitemap;
+
+static unsigned char typed_sitemap_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+  TypedSitemap* sitemap = user;
+  double d;
+  long long s;
+  if (type != SXMLEventContent) return SXMLExplorerContinue;
+  if (sxml_to_timestamp(text, len, &s, NULL)) {
+    sitemap->lastmod = s;
+  } else if (sxml_to_double(text, len, &d)) {
+    sitemap->priorities++;
+    sitemap->priority_sum += d;
+  }
+  return SXMLExplorerContinue;
+}
+
+void test_typed_content(void) {
+  char* xml = NULL;
+  FILE* f = fopen("test-data/test-sitemap.xml", "rb");
+  TypedSitemap sitemap;
+  long size;
+  CU_ASSERT_PTR_NOT_NULL_FATAL(f);
+  fseek(f, 0, SEEK_END);
+  size = ftell(f);
+  rewind(f);
+  xml = malloc(size + 1);
+  CU_ASSERT_FATAL(fread(xml, 1, size, f) == (size_t)size);
+  xml[size] = '\0';
+  fclose(f);
+
+  memset(&sitemap, 0, sizeof(sitemap));
+  SXMLExplorer* ex = sxml_make_explorer();
+  sxml_register_event_func(ex, typed_sitemap_event, &sitemap);
+  CU_ASSERT_EQUAL(sxml_run_explorer(ex, xml), SXMLExplorerComplete);
+  CU_ASSERT_EQUAL(sitemap.lastmod, 1104537600LL);
+  CU_ASSERT_EQUAL(sitemap.priorities, 1);
+  CU_ASSERT(sitemap.priority_sum == 0.8);
+  sxml_destroy_explorer(ex);
+  free(xml);
+}
+
+void add_typed_tests(CU_pSuite* suite) {
+  CU_add_test(*suite, "Typed integers", test_typed_integers);
+  CU_add_test(*suite, "Typed doubles", test_typed_doubles);
+  CU_add_test(*suite, "Typed booleans", test_typed_booleans);
+  CU_add_test(*suite, "Typed timestamps", test_typed_timestamps);
+  CU_add_test(*suite, "Typed values in content callbacks", test_typed_content);
+}
@@ -9,6 +9,16 @@ void add_oss_xml_tests(CU_pSuite*);
 void add_entity_tests(CU_pSuite*);
 void add_exi_tests(CU_pSuite*);
 void add_chunked_tests(CU_pSuite*);
+void add_pipeline_tests(CU_pSuite*);
+void add_shard_tests(CU_pSuite*);
+void add_dispatch_tests(CU_pSuite*);
+void add_query_tests(CU_pSuite*);
+void add_bind_tests(CU_pSuite*);
+void add_gen_tests(CU_pSuite*);
+void add_typed_tests(CU_pSuite*);
+void add_aggregate_tests(CU_pSuite*);
+void add_columns_tests(CU_pSuite*);
+void add_json_tests(CU_pSuite*);
 
 // Static callback functions for tests
 static unsigned char test_parse_simple_xml_on_tag(char *name) {
@@ -248,7 +258,7 @@ void test_check_parsing_doctype(void) {
 }
 
 int main(void) {
-  CU_pSuite core_suite, internal_suite, advanced_suite, entity_suite, realworld_suite, chunked_suite, exi_suite;
+  CU_pSuite core_suite, internal_suite, advanced_suite, entity_suite, realworld_suite, chunked_suite, exi_suite, pipeline_suite, shard_suite, dispatch_suite, query_suite, bind_suite, gen_suite, typed_suite, aggregate_suite, columns_suite, json_suite;
   CU_initialize_registry();
 
   // Core API and Basic Parsing Suite
@@ -285,6 +295,46 @@ int main(void) {
   exi_suite = CU_add_suite("EXI Support", NULL, NULL);
   add_exi_tests(&exi_suite);
 
+  // Threaded Pipeline Suite
+  pipeline_suite = CU_add_suite("Threaded Pipeline", NULL, NULL);
+  add_pipeline_tests(&pipeline_suite);
+
+  // Shard Planning Suite
+  shard_suite = CU_add_suite("Shard Planning", NULL, NULL);
+  add_shard_tests(&shard_suite);
+
+  // Element Dispatch Suite
+  dispatch_suite = CU_add_suite("Element Dispatch", NULL, NULL);
+  add_dispatch_tests(&dispatch_suite);
+
+  // Streaming Query Suite
+  query_suite = CU_add_suite("Streaming Queries", NULL, NULL);
+  add_query_tests(&query_suite);
+
+  // Record Binding Suite
+  bind_suite = CU_add_suite("Record Binding", NULL, NULL);
+  add_bind_tests(&bind_suite);
+
+  // Generated Parser Suite
+  gen_suite = CU_add_suite("Generated Parsers", NULL, NULL);
+  add_gen_tests(&gen_suite);
+
+  // Typed Value Suite
+  typed_suite = CU_add_suite("Typed Values", NULL, NULL);
+  add_typed_tests(&typed_suite);
+
+  // Aggregation Suite
+  aggregate_suite = CU_add_suite("Aggregation", NULL, NULL);
+  add_aggregate_tests(&aggregate_suite);
+
+  // Columnar Extraction Suite
+  columns_suite = CU_add_suite("Columnar Extraction", NULL, NULL);
+  add_columns_tests(&columns_suite);
+
+  // JSON Conversion Suite
+  json_suite = CU_add_suite("JSON Conversion", NULL, NULL);
+  add_json_tests(&json_suite);
+
   CU_basic_set_mode(CU_BRM_VERBOSE);
   CU_basic_run_tests();
   CU_cleanup_registry();
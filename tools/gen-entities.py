@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""Generate sparsexml-entities.h: HTML5 named entities behind a minimal perfect hash.
+
+Usage: python3 tools/gen-entities.py > sparsexml-entities.h
+
+Lookup (see priv_sxml_lookup_entity in sparsexml.c):
+    h      = fnv1a(name)
+    slot   = mix32(h ^ displacement[h % BUCKETS]) % COUNT
+    entry  = table[slot], then compare the name to reject non-entities
+"""
+import html.entities
+import sys
+
+XML_ENTITIES = {"lt", "gt", "amp", "quot", "apos"}
+FNV_OFFSET = 0x811C9DC5
+FNV_PRIME = 0x01000193
+MASK = 0xFFFFFFFF
+
+
+def fnv1a(name):
+    h = FNV_OFFSET
+    for b in name.encode("ascii"):
+        h = ((h ^ b) * FNV_PRIME) & MASK
+    return h
+
+
+def mix32(h):
+    h ^= h >> 16
+    h = (h * 0x7FEB352D) & MASK
+    h ^= h >> 15
+    h = (h * 0x846CA68B) & MASK
+    h ^= h >> 16
+    return h
+
+
+def build(entities):
+    names = sorted(entities)
+    count = len(names)
+    buckets = (count + 3) // 4
+    grouped = [[] for _ in range(buckets)]
+    for name in names:
+        grouped[fnv1a(name) % buckets].append(name)
+
+    slots = [None] * count
+    displacement = [0] * buckets
+    for b in sorted(range(buckets), key=lambda b: -len(grouped[b])):
+        members = grouped[b]
+        if not members:
+            continue
+        for d in range(1, 0x10000):
+            taken = [mix32(fnv1a(n) ^ d) % count for n in members]
+            if len(set(taken)) == len(taken) and all(slots[t] is None for t in taken):
+                for n, t in zip(members, taken):
+                    slots[t] = n
+                displacement[b] = d
+                break
+        else:
+            sys.exit("no displacement for bucket %d" % b)
+    return slots, displacement, buckets
+
+
+def c_bytes(data):
+    return "".join("\\%03o" % b for b in data)
+
+
+def main():
+    entities = {k[:-1]: v for k, v in html.entities.html5.items() if k.endswith(";")}
+    slots, displacement, buckets = build(entities)
+
+    name_pool, value_pool, rows = [], [], []
+    name_off = value_off = 0
+    for name in slots:
+        value = entities[name].encode("utf-8")
+        kind = 1 if name in XML_ENTITIES else 0
+        rows.append("  { %d, %d, %d, %d, %d }," % (name_off, value_off, len(name), len(value), kind))
+        name_pool.append(name)
+        value_pool.append(value)
+        name_off += len(name)
+        value_off += len(value)
+
+    out = sys.stdout
+    out.write("// Generated by tools/gen-entities.py -- do not edit.\n")
+    out.write("// HTML5 named character references (the five XML entities included)\n")
+    out.write("// behind a minimal perfect hash; values are UTF-8.\n")
+    out.write("#ifndef __SXMLEntities__\n#define __SXMLEntities__\n\n")
+    out.write("#define SXMLEntityCount %d\n" % len(slots))
+    out.write("#define SXMLEntityBuckets %d\n" % buckets)
+    out.write("#define SXMLEntityMaxNameLength %d\n\n" % max(len(n) for n in slots))
+    out.write("typedef struct {\n")
+    out.write("  unsigned short name;       // Offset into sxml_entity_names\n")
+    out.write("  unsigned short value;      // Offset into sxml_entity_values\n")
+    out.write("  unsigned char name_len;\n")
+    out.write("  unsigned char value_len;\n")
+    out.write("  unsigned char xml;         // One of the five predefined XML entities\n")
+    out.write("} SXMLEntity;\n\n")
+
+    out.write("static const unsigned short sxml_entity_displacements[SXMLEntityBuckets] = {\n")
+    for i in range(0, buckets, 12):
+        out.write("  " + ", ".join(str(d) for d in displacement[i:i + 12]) + ",\n")
+    out.write("};\n\n")
+
+    out.write("static const SXMLEntity sxml_entity_table[SXMLEntityCount] = {\n")
+    out.write("\n".join(rows) + "\n};\n\n")
+
+    out.write("static const char sxml_entity_names[] =\n")
+    line = ""
+    for name in name_pool:
+        if len(line) + len(name) > 72:
+            out.write('  "%s"\n' % line)
+            line = ""
+        line += name
+    out.write('  "%s";\n\n' % line)
+
+    out.write("static const char sxml_entity_values[] =\n")
+    line = ""
+    for value in value_pool:
+        if len(line) + 4 * len(value) > 72:
+            out.write('  "%s"\n' % line)
+            line = ""
+        line += c_bytes(value)
+    out.write('  "%s";\n\n' % line)
+
+    out.write("#endif\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+"""Generate sparsexml-pow5.h: 128-bit powers of five for decimal to double conversion.
+
+Usage: python3 tools/gen-pow5.py > sparsexml-pow5.h
+
+Entry q (from SXMLPow5Min to SXMLPow5Max) is 5^q normalized so that bit 127
+is set: truncated for q >= 0, rounded up from the reciprocal for q < 0, as
+the Eisel-Lemire algorithm expects (see sxml_to_double in sparsexml.c).
+"""
+import sys
+
+POW5_MIN = -342
+POW5_MAX = 308
+
+
+def power(q):
+    if q >= 0:
+        p = 5 ** q
+        while p < (1 << 127):
+            p *= 2
+        while p >= (1 << 128):
+            p //= 2
+        return p
+    p = 5 ** -q
+    z = p.bit_length() if p & (p - 1) else p.bit_length() - 1
+    if q >= -27:
+        return 2 ** (z + 127) // p + 1
+    c = 2 ** (2 * z + 128) // p + 1
+    while c >= (1 << 128):
+        c //= 2
+    return c
+
+
+def main():
+    out = sys.stdout
+    out.write("// Generated by tools/gen-pow5.py -- do not edit.\n")
+    out.write("// 5^q as normalized 128-bit values (high, low), q from SXMLPow5Min.\n")
+    out.write("#ifndef __SXMLPow5__\n#define __SXMLPow5__\n\n")
+    out.write("#define SXMLPow5Min %d\n" % POW5_MIN)
+    out.write("#define SXMLPow5Max %d\n\n" % POW5_MAX)
+    out.write("static const unsigned long long sxml_pow5_table[%d] = {\n" % (2 * (POW5_MAX - POW5_MIN + 1)))
+    for q in range(POW5_MIN, POW5_MAX + 1):
+        p = power(q)
+        out.write("  0x%016xULL, 0x%016xULL,\n" % (p >> 64, p & ((1 << 64) - 1)))
+    out.write("};\n\n#endif\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,1171 @@
+/*
+ * sxml-gen: specialized record parsers for a fixed vocabulary
+ *
+ * Reads representative XML documents or an XSD, infers the element tree,
+ * picks a record element and writes a header/source pair: a struct with one
+ * typed field per leaf text and attribute under the record, and a parser for
+ * exactly that vocabulary. The generated parser takes the explorer's event
+ * func only; names go through a perfect hash generated here, element nesting
+ * through a constant transition table and every field through a switch that
+ * calls its typed conversion directly, so no symbol table, path tracking or
+ * query automaton is involved.
+ *
+ *   tools/sxml-gen -o gen/rss -r /rss/channel/item test-data/test-rss.xml
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "sparsexml.h"
+#include "sparsexml-bind.h"
+
+#define GenMaxNodes 1024
+#define GenMaxDepth 64
+#define GenNameLength 128
+#define GenMaxFields 32          // One bit each in the record func's mask
+#define GenUnknownType 0xFF
+#define GenPrime 16777619u
+
+typedef struct {
+  char name[GenNameLength];
+  int parent;                    // -1 for the document node
+  unsigned char attribute;
+  unsigned int count;            // Occurrences (2 for XSD maxOccurs > 1)
+  unsigned char has_children;
+  unsigned char has_text;
+  unsigned char type;            // SXMLBind*, GenUnknownType until a value is seen
+} GenNode;
+
+typedef struct {
+  GenNode nodes[GenMaxNodes];
+  unsigned int count;
+  unsigned char overflow;
+} GenModel;
+
+typedef struct {
+  int node;
+  char path[GenNameLength * 2];  // Relative to the record
+  char name[GenNameLength];      // C identifier
+  unsigned char type;
+} GenField;
+
+// =============================================================================
+// MODEL
+// =============================================================================
+
+static void gen_init_model(GenModel* model) {
+  memset(model, 0, sizeof(GenModel));
+  strcpy(model->nodes[0].name, "(document)");
+  model->nodes[0].parent = -1;
+  model->nodes[0].type = GenUnknownType;
+  model->count = 1;
+}
+
+static int gen_child(GenModel* model, int parent, const char* name, unsigned int len, unsigned char attribute) {
+  unsigned int i;
+  GenNode* node;
+
+  if (len >= GenNameLength) {
+    len = GenNameLength - 1;
+  }
+  for (i = 1; i < model->count; i++) {
+    node = &model->nodes[i];
+    if (node->parent == parent && node->attribute == attribute && strlen(node->name) == len &&
+        memcmp(node->name, name, len) == 0) {
+      return (int)i;
+    }
+  }
+  if (model->count == GenMaxNodes) {
+    model->overflow = 1;
+    return -1;
+  }
+  node = &model->nodes[model->count];
+  memcpy(node->name, name, len);
+  node->name[len] = '\0';
+  node->parent = parent;
+  node->attribute = attribute;
+  node->type = GenUnknownType;
+  if (!attribute) {
+    model->nodes[parent].has_children = 1;
+  }
+  return (int)model->count++;
+}
+
+static unsigned char gen_merge(unsigned char a, unsigned char b) {
+  if (a == GenUnknownType) {
+    return b;
+  }
+  if (b == GenUnknownType || a == b) {
+    return a;
+  }
+  if ((a == SXMLBindInt && b == SXMLBindDouble) || (a == SXMLBindDouble && b == SXMLBindInt)) {
+    return SXMLBindDouble;
+  }
+  return SXMLBindText;
+}
+
+// Narrowest type a sample value fits, GenUnknownType for blank values
+static unsigned char gen_classify(const char* value, unsigned int len) {
+  long long i;
+  double d;
+  unsigned int n;
+
+  while (len > 0 && isspace((unsigned char)*value)) {
+    value++;
+    len--;
+  }
+  while (len > 0 && isspace((unsigned char)value[len - 1])) {
+    len--;
+  }
+  if (len == 0) {
+    return GenUnknownType;
+  }
+  if ((len == 4 && memcmp(value, "true", 4) == 0) || (len == 5 && memcmp(value, "false", 5) == 0)) {
+    return SXMLBindBool;
+  }
+  if (sxml_bind_value(SXMLBindInt, value, len, &i)) {
+    return SXMLBindInt;
+  }
+  for (n = 0; n < len && strchr("0123456789+-.eE", value[n]) != NULL; n++);
+  if (n == len && sxml_bind_value(SXMLBindDouble, value, len, &d)) {
+    return SXMLBindDouble;
+  }
+  if (sxml_bind_value(SXMLBindTimestamp, value, len, &i)) {
+    return SXMLBindTimestamp;
+  }
+  return SXMLBindText;
+}
+
+// Tag events keep the '<' of the first tag and the whitespace around
+// attributes; line breaks inside a start tag arrive as blank tag events and
+// leading whitespace of the next attribute key
+static char* gen_trim(char* text, unsigned int* len) {
+  if (*len > 0 && text[0] == '<') {
+    text++;
+    (*len)--;
+  }
+  while (*len > 0 && isspace((unsigned char)*text)) {
+    text++;
+    (*len)--;
+  }
+  while (*len > 0 && isspace((unsigned char)text[*len - 1])) {
+    (*len)--;
+  }
+  return text;
+}
+
+static const char* gen_local(const char* name) {
+  const char* colon = strchr(name, ':');
+  return colon != NULL ? colon + 1 : name;
+}
+
+static char* gen_read_file(const char* path) {
+  FILE* f = fopen(path, "rb");
+  char* data;
+  long size;
+
+  if (f == NULL) {
+    return NULL;
+  }
+  fseek(f, 0, SEEK_END);
+  size = ftell(f);
+  rewind(f);
+  data = malloc(size + 1);
+  if (data != NULL && fread(data, 1, size, f) != (size_t)size) {
+    free(data);
+    data = NULL;
+  }
+  if (data != NULL) {
+    data[size] = '\0';
+  }
+  fclose(f);
+  return data;
+}
+
+// =============================================================================
+// SAMPLE DOCUMENTS
+// =============================================================================
+
+typedef struct {
+  GenModel* model;
+  int stack[GenMaxDepth];
+  unsigned int depth;
+  int attr;
+} GenSample;
+
+static unsigned char gen_sample_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+  GenSample* sample = user;
+  GenModel* model = sample->model;
+  int top = sample->depth > 0 ? sample->stack[sample->depth - 1] : 0;
+  unsigned char empty = 0;
+  int node;
+
+  switch (type) {
+    case SXMLEventTag:
+      text = gen_trim(text, &len);
+      if (len == 0) {
+        return SXMLExplorerContinue;
+      }
+      if (text[0] == '/') {
+        sample->depth -= sample->depth > 0;
+        return SXMLExplorerContinue;
+      }
+      if (text[len - 1] == '/') {
+        empty = 1;
+        len--;
+      }
+      if (sample->depth == GenMaxDepth || (node = gen_child(model, top, text, len, 0)) < 0) {
+        return SXMLExplorerErrorBufferOverflow;
+      }
+      model->nodes[node].count++;
+      sample->stack[sample->depth++] = node;
+      sample->depth -= empty;
+      break;
+    case SXMLEventAttributeKey:
+      text = gen_trim(text, &len);
+      sample->attr = gen_child(model, top, text, len, 1);
+      if (sample->attr >= 0) {
+        model->nodes[sample->attr].count++;
+      }
+      break;
+    case SXMLEventAttributeValue:
+      if (sample->attr > 0) {
+        model->nodes[sample->attr].type = gen_merge(model->nodes[sample->attr].type, gen_classify(text, len));
+      }
+      break;
+    case SXMLEventContent:
+      if (top > 0 && gen_classify(text, len) != GenUnknownType) {
+        model->nodes[top].has_text = 1;
+        model->nodes[top].type = gen_merge(model->nodes[top].type, gen_classify(text, len));
+      }
+      break;
+    default:
+      break;
+  }
+  return SXMLExplorerContinue;
+}
+
+static int gen_read_sample(GenModel* model, const char* path) {
+  SXMLExplorer* explorer;
+  GenSample sample;
+  unsigned char result;
+  char* xml = gen_read_file(path);
+
+  if (xml == NULL) {
+    fprintf(stderr, "sxml-gen: %s: cannot read\n", path);
+    return 1;
+  }
+  memset(&sample, 0, sizeof(sample));
+  sample.model = model;
+  explorer = sxml_make_explorer();
+  sxml_enable_entity_processing(explorer, 1);
+  sxml_register_event_func(explorer, gen_sample_event, &sample);
+  result = sxml_run_explorer(explorer, xml);
+  sxml_destroy_explorer(explorer);
+  free(xml);
+  if (result != SXMLExplorerComplete) {
+    fprintf(stderr, "sxml-gen: %s: parse failed (%d)\n", path, result);
+    return 1;
+  }
+  return 0;
+}
+
+// =============================================================================
+// XML SCHEMA
+// =============================================================================
+
+typedef struct {
+  char tag[32];                  // Local name: element, attribute, complexType...
+  char name[GenNameLength];
+  char type[GenNameLength];
+  char ref[GenNameLength];
+  char base[GenNameLength];
+  unsigned char many;            // maxOccurs above 1
+  int parent;
+} GenXsdNode;
+
+typedef struct {
+  GenXsdNode nodes[GenMaxNodes];
+  unsigned int count;
+  int stack[GenMaxDepth];
+  unsigned int depth;
+  char* value;                   // Field the next attribute value goes to
+  unsigned char occurs;
+} GenXsd;
+
+static unsigned char gen_xsd_event(void* user, SXMLEventType type, char* text, unsigned int len) {
+  GenXsd* xsd = user;
+  GenXsdNode* node;
+  unsigned char empty = 0;
+  const char* local;
+
+  switch (type) {
+    case SXMLEventTag:
+      text = gen_trim(text, &len);
+      if (len == 0) {
+        return SXMLExplorerContinue;
+      }
+      if (text[0] == '/') {
+        xsd->depth -= xsd->depth > 0;
+        return SXMLExplorerContinue;
+      }
+      if (text[len - 1] == '/') {
+        empty = 1;
+        len--;
+      }
+      if (xsd->depth == GenMaxDepth || xsd->count == GenMaxNodes) {
+        return SXMLExplorerErrorBufferOverflow;
+      }
+      node = &xsd->nodes[xsd->count];
+      memset(node, 0, sizeof(GenXsdNode));
+      snprintf(node->tag, sizeof(node->tag), "%.*s", (int)len, text);
+      local = gen_local(node->tag);
+      memmove(node->tag, local, strlen(local) + 1);
+      node->parent = xsd->depth > 0 ? xsd->stack[xsd->depth - 1] : -1;
+      xsd->stack[xsd->depth++] = (int)xsd->count++;
+      xsd->depth -= empty;
+      xsd->value = NULL;
+      break;
+    case SXMLEventAttributeKey:
+      text = gen_trim(text, &len);
+      node = &xsd->nodes[xsd->count - 1];
+      xsd->value = NULL;
+      xsd->occurs = len == 9 && memcmp(text, "maxOccurs", 9) == 0;
+      if (len == 4 && memcmp(text, "name", 4) == 0) {
+        xsd->value = node->name;
+      } else if (len == 4 && memcmp(text, "type", 4) == 0) {
+        xsd->value = node->type;
+      } else if (len == 3 && memcmp(text, "ref", 3) == 0) {
+        xsd->value = node->ref;
+      } else if (len == 4 && memcmp(text, "base", 4) == 0) {
+        xsd->value = node->base;
+      }
+      break;
+    case SXMLEventAttributeValue:
+      if (xsd->value != NULL) {
+        snprintf(xsd->value, GenNameLength, "%.*s", (int)len, text);
+      } else if (xsd->occurs) {
+        xsd->nodes[xsd->count - 1].many = strncmp(text, "unbounded", len) == 0 || atoi(text) > 1;
+      }
+      break;
+    default:
+      break;
+  }
+  return SXMLExplorerContinue;
+}
+
+// Top-level declaration (a child of xs:schema) of the given kind and name
+static int gen_xsd_top(GenXsd* xsd, const char* tag, const char* name) {
+  unsigned int i;
+  for (i = 0; i < xsd->count; i++) {
+    if (xsd->nodes[i].parent == 0 && strcmp(xsd->nodes[i].tag, tag) == 0 &&
+        strcmp(xsd->nodes[i].name, gen_local(name)) == 0) {
+      return (int)i;
+    }
+  }
+  return -1;
+}
+
+static int gen_xsd_descendant(GenXsd* xsd, int node, const char* tag) {
+  unsigned int i;
+  for (i = (unsigned int)node + 1; i < xsd->count; i++) {
+    int p = xsd->nodes[i].parent;
+    while (p > node) {
+      p = xsd->nodes[p].parent;
+    }
+    if (p != node) {
+      break;
+    }
+    if (strcmp(xsd->nodes[i].tag, tag) == 0) {
+      return (int)i;
+    }
+  }
+  return -1;
+}
+
+// Builtin types by local name; named simple types follow their restriction
+static unsigned char gen_xsd_type(GenXsd* xsd, const char* name, unsigned int level) {
+  static const char* const ints[] = {
+    "int", "integer", "long", "short", "byte", "unsignedInt", "unsignedLong", "unsignedShort",
+    "unsignedByte", "positiveInteger", "nonNegativeInteger", "negativeInteger", "nonPositiveInteger", "gYear"
+  };
+  const char* local = gen_local(name);
+  int simple, restriction;
+  unsigned int i;
+
+  for (i = 0; i < sizeof(ints) / sizeof(ints[0]); i++) {
+    if (strcmp(local, ints[i]) == 0) {
+      return SXMLBindInt;
+    }
+  }
+  if (strcmp(local, "decimal") == 0 || strcmp(local, "double") == 0 || strcmp(local, "float") == 0) {
+    return SXMLBindDouble;
+  }
+  if (strcmp(local, "boolean") == 0) {
+    return SXMLBindBool;
+  }
+  if (strcmp(local, "dateTime") == 0 || strcmp(local, "date") == 0) {
+    return SXMLBindTimestamp;
+  }
+  simple = gen_xsd_top(xsd, "simpleType", name);
+  if (simple >= 0 && level < GenMaxDepth &&
+      (restriction = gen_xsd_descendant(xsd, simple, "restriction")) >= 0) {
+    return gen_xsd_type(xsd, xsd->nodes[restriction].base, level + 1);
+  }
+  return SXMLBindText;
+}
+
+static void gen_xsd_element(GenModel* model, GenXsd* xsd, int element, int parent, unsigned int level);
+
+static void gen_xsd_content(GenModel* model, GenXsd* xsd, int type, int node, unsigned int level) {
+  unsigned int i;
+  int base, attr;
+
+  if (level >= GenMaxDepth) {
+    return;
+  }
+  for (i = (unsigned int)type + 1; i < xsd->count; i++) {
+    GenXsdNode* child = &xsd->nodes[i];
+    if (child->parent != type) {
+      continue;
+    }
+    if (strcmp(child->tag, "element") == 0) {
+      gen_xsd_element(model, xsd, (int)i, node, level + 1);
+    } else if (strcmp(child->tag, "attribute") == 0) {
+      const char* name = gen_local(child->name[0] != '\0' ? child->name : child->ref);
+      if ((attr = gen_child(model, node, name, (unsigned int)strlen(name), 1)) > 0) {
+        model->nodes[attr].count++;
+        model->nodes[attr].type = child->type[0] != '\0' ? gen_xsd_type(xsd, child->type, 0) : SXMLBindText;
+      }
+    } else {
+      if ((strcmp(child->tag, "extension") == 0 || strcmp(child->tag, "restriction") == 0) && child->base[0] != '\0') {
+        if ((base = gen_xsd_top(xsd, "complexType", child->base)) >= 0) {
+          gen_xsd_content(model, xsd, base, node, level + 1);
+        } else if (strcmp(xsd->nodes[type].tag, "simpleContent") == 0) {
+          model->nodes[node].has_text = 1;
+          model->nodes[node].type = gen_xsd_type(xsd, child->base, 0);
+        }
+      }
+      gen_xsd_content(model, xsd, (int)i, node, level + 1);
+    }
+  }
+}
+
+static void gen_xsd_element(GenModel* model, GenXsd* xsd, int element, int parent, unsigned int level) {
+  unsigned char many = xsd->nodes[element].many;
+  int node, type, target;
+
+  if (xsd->nodes[element].ref[0] != '\0') {
+    if ((target = gen_xsd_top(xsd, "element", xsd->nodes[element].ref)) < 0) {
+      return;
+    }
+    element = target;
+  }
+  node = gen_child(model, parent, xsd->nodes[element].name, (unsigned int)strlen(xsd->nodes[element].name), 0);
+  if (node < 0 || level >= GenMaxDepth) {
+    return;
+  }
+  if (model->nodes[node].count < (many ? 2u : 1u)) {
+    model->nodes[node].count = many ? 2 : 1;
+  }
+
+  if (xsd->nodes[element].type[0] != '\0') {
+    if ((type = gen_xsd_top(xsd, "complexType", xsd->nodes[element].type)) >= 0) {
+      gen_xsd_content(model, xsd, type, node, level);
+    } else {
+      model->nodes[node].has_text = 1;
+      model->nodes[node].type = gen_xsd_type(xsd, xsd->nodes[element].type, 0);
+    }
+    return;
+  }
+  for (type = element + 1; type < (int)xsd->count; type++) {
+    if (xsd->nodes[type].parent != element) {
+      continue;
+    }
+    if (strcmp(xsd->nodes[type].tag, "complexType") == 0) {
+      gen_xsd_content(model, xsd, type, node, level);
+      return;
+    }
+    if (strcmp(xsd->nodes[type].tag, "simpleType") == 0) {
+      int restriction = gen_xsd_descendant(xsd, type, "restriction");
+      model->nodes[node].has_text = 1;
+      model->nodes[node].type = restriction >= 0 ? gen_xsd_type(xsd, xsd->nodes[restriction].base, 0) : SXMLBindText;
+      return;
+    }
+  }
+  model->nodes[node].has_text = 1;
+  model->nodes[node].type = SXMLBindText;
+}
+
+static unsigned char gen_xsd_complex(GenXsd* xsd, int element) {
+  unsigned int i;
+  if (xsd->nodes[element].type[0] != '\0') {
+    return gen_xsd_top(xsd, "complexType", xsd->nodes[element].type) >= 0;
+  }
+  for (i = (unsigned int)element + 1; i < xsd->count; i++) {
+    if (xsd->nodes[i].parent == element && strcmp(xsd->nodes[i].tag, "complexType") == 0) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Expands the top-level element named by root (the first complex one when NULL)
+static int gen_read_schema(GenModel* model, const char* path, const char* root) {
+  SXMLExplorer* explorer;
+  GenXsd* xsd;
+  unsigned char result;
+  unsigned int i;
+  int element = -1;
+  char* xml = gen_read_file(path);
+
+  if (xml == NULL) {
+    fprintf(stderr, "sxml-gen: %s: cannot read\n", path);
+    return 1;
+  }
+  xsd = calloc(1, sizeof(GenXsd));
+  explorer = sxml_make_explorer();
+  sxml_enable_entity_processing(explorer, 1);
+  sxml_register_event_func(explorer, gen_xsd_event, xsd);
+  result = sxml_run_explorer(explorer, xml);
+  sxml_destroy_explorer(explorer);
+  free(xml);
+  if (result != SXMLExplorerComplete || xsd->count == 0 || strcmp(xsd->nodes[0].tag, "schema") != 0) {
+    fprintf(stderr, "sxml-gen: %s: not a schema (%d)\n", path, result);
+    free(xsd);
+    return 1;
+  }
+
+  for (i = 1; i < xsd->count && element < 0; i++) {
+    if (xsd->nodes[i].parent == 0 && strcmp(xsd->nodes[i].tag, "element") == 0 &&
+        (root != NULL ? strcmp(xsd->nodes[i].name, root) == 0 : gen_xsd_complex(xsd, (int)i))) {
+      element = (int)i;
+    }
+  }
+  if (element < 0) {
+    fprintf(stderr, "sxml-gen: %s: no top-level element %s\n", path, root != NULL ? root : "");
+    free(xsd);
+    return 1;
+  }
+  gen_xsd_element(model, xsd, element, 0, 0);
+  free(xsd);
+  return 0;
+}
+
+// =============================================================================
+// RECORD AND FIELDS
+// =============================================================================
+
+static unsigned int gen_depth(GenModel* model, int node) {
+  unsigned int depth = 0;
+  for (; node > 0; node = model->nodes[node].parent) {
+    depth++;
+  }
+  return depth;
+}
+
+static unsigned char gen_below(GenModel* model, int node, int ancestor) {
+  for (; node > 0; node = model->nodes[node].parent) {
+    if (node == ancestor) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// An explicit "/a/b/c", or else the most frequent element with children,
+// the deepest (then the latest) among equals
+static int gen_find_record(GenModel* model, const char* path) {
+  int node = 0, best = -1;
+  unsigned int i;
+
+  if (path != NULL) {
+    while (*path == '/') {
+      const char* step = ++path;
+      while (*path != '/' && *path != '\0') {
+        path++;
+      }
+      for (i = 1; i < model->count; i++) {
+        GenNode* n = &model->nodes[i];
+        if (n->parent == node && !n->attribute && strlen(n->name) == (size_t)(path - step) &&
+            memcmp(n->name, step, path - step) == 0) {
+          break;
+        }
+      }
+      if (i == model->count) {
+        return -1;
+      }
+      node = (int)i;
+    }
+    return *path == '\0' && node > 0 ? node : -1;
+  }
+
+  for (i = 1; i < model->count; i++) {
+    GenNode* n = &model->nodes[i];
+    if (n->attribute || !n->has_children) {
+      continue;
+    }
+    if (best < 0 || n->count > model->nodes[best].count ||
+        (n->count == model->nodes[best].count && gen_depth(model, (int)i) >= gen_depth(model, best))) {
+      best = (int)i;
+    }
+  }
+  return best;
+}
+
+static void gen_node_path(GenModel* model, int node, int record, char* out, size_t size) {
+  char rest[GenNameLength * 2];
+  if (node == record || node <= 0) {
+    out[0] = '\0';
+    return;
+  }
+  gen_node_path(model, model->nodes[node].parent, record, rest, sizeof(rest));
+  snprintf(out, size, "%s%s%s%s", rest, rest[0] != '\0' ? "/" : "", model->nodes[node].attribute ? "@" : "",
+           model->nodes[node].name);
+}
+
+static unsigned char gen_keyword(const char* name) {
+  static const char* const keywords[] = {
+    "auto", "break", "case", "char", "const", "continue", "default", "do", "double", "else", "enum",
+    "extern", "float", "for", "goto", "if", "inline", "int", "long", "register", "restrict", "return",
+    "short", "signed", "sizeof", "static", "struct", "switch", "typedef", "union", "unsigned", "void",
+    "volatile", "while", "fields"
+  };
+  unsigned int i;
+  for (i = 0; i < sizeof(keywords) / sizeof(keywords[0]); i++) {
+    if (strcmp(name, keywords[i]) == 0) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static void gen_identifier(const char* text, char* out, size_t size) {
+  size_t n = 0;
+  if (isdigit((unsigned char)*text)) {
+    out[n++] = '_';
+  }
+  for (; *text != '\0' && n + 1 < size; text++) {
+    if (*text == '@') {
+      continue;
+    }
+    out[n++] = isalnum((unsigned char)*text) ? *text : '_';
+  }
+  out[n] = '\0';
+}
+
+static unsigned int gen_collect_fields(GenModel* model, int record, GenField* fields) {
+  unsigned int i, j, count = 0, suffix;
+  char base[GenNameLength];
+
+  for (i = 1; i < model->count; i++) {
+    GenNode* n = &model->nodes[i];
+    if (!gen_below(model, (int)i, record) || (!n->attribute && (!n->has_text || n->has_children))) {
+      continue;
+    }
+    if (count == GenMaxFields) {
+      fprintf(stderr, "sxml-gen: more than %d fields, dropping %s\n", GenMaxFields, n->name);
+      continue;
+    }
+    fields[count].node = (int)i;
+    fields[count].type = n->type == GenUnknownType ? SXMLBindText : n->type;
+    gen_node_path(model, (int)i, record, fields[count].path, sizeof(fields[count].path));
+    if (fields[count].path[0] == '\0') {
+      strcpy(fields[count].path, "text()");
+    }
+    gen_identifier(strcmp(fields[count].path, "text()") == 0 ? "text" : fields[count].path, base, sizeof(base));
+    if (gen_keyword(base)) {
+      memmove(base + 2, base, strlen(base) + 1);
+      memcpy(base, "f_", 2);
+    }
+    strcpy(fields[count].name, base);
+    for (suffix = 2, j = 0; j < count; j++) {
+      if (strcmp(fields[j].name, fields[count].name) == 0) {
+        snprintf(fields[count].name, sizeof(fields[count].name), "%.100s_%u", base, suffix++);
+        j = (unsigned int)-1;
+      }
+    }
+    count++;
+  }
+  return count;
+}
+
+// =============================================================================
+// PERFECT HASH
+// =============================================================================
+
+static unsigned int gen_hash(unsigned int seed, const char* name, unsigned int len) {
+  unsigned int h = seed;
+  while (len-- > 0) {
+    h ^= (unsigned char)*name++;
+    h *= GenPrime;
+  }
+  return h ^ (h >> 15);
+}
+
+// Seed and power-of-two table size placing every name in its own slot
+static void gen_perfect_hash(char names[][GenNameLength], unsigned int count, unsigned int* seed, unsigned int* slots) {
+  unsigned char* used;
+  unsigned int size, s, i;
+
+  for (size = 8; size < count * 2; size <<= 1);
+  for (;; size <<= 1) {
+    used = malloc(size);
+    for (s = 0x811C9DC5u; s < 0x811C9DC5u + 100000u; s++) {
+      memset(used, 0, size);
+      for (i = 1; i < count; i++) {
+        unsigned int slot = gen_hash(s, names[i], (unsigned int)strlen(names[i])) & (size - 1);
+        if (used[slot]) {
+          break;
+        }
+        used[slot] = 1;
+      }
+      if (i == count) {
+        free(used);
+        *seed = s;
+        *slots = size;
+        return;
+      }
+    }
+    free(used);
+  }
+}
+
+// =============================================================================
+// EMIT
+// =============================================================================
+
+typedef struct {
+  const char* prefix;
+  char record_type[GenNameLength * 2];
+  char upper[GenNameLength * 2];  // Macro prefix: PREFIX_RECORD
+  const char* header;             // Header file name for #include
+  const char* sources;
+
+  GenModel* model;
+  int record;
+  GenField fields[GenMaxFields];
+  unsigned int field_count;
+
+  char (*tokens)[GenNameLength];  // Token 0 is the unknown name
+  unsigned int token_count;
+  int* state_of;                  // Model node to state: 0 unknown, 1 document
+  unsigned int state_count;
+} GenOutput;
+
+static const char* gen_c_type(unsigned char type) {
+  switch (type) {
+    case SXMLBindInt: return "long long";
+    case SXMLBindDouble: return "double";
+    case SXMLBindBool: return "unsigned char";
+    case SXMLBindTimestamp: return "long long";
+  }
+  return "SXMLSpan";
+}
+
+static const char* gen_convert(unsigned char type) {
+  switch (type) {
+    case SXMLBindInt: return "sxml_to_int";
+    case SXMLBindDouble: return "sxml_to_double";
+    case SXMLBindBool: return "sxml_to_bool";
+  }
+  return "sxml_to_timestamp";
+}
+
+static unsigned int gen_token(GenOutput* out, const char* name) {
+  unsigned int i;
+  for (i = 1; i < out->token_count; i++) {
+    if (strcmp(out->tokens[i], name) == 0) {
+      return i;
+    }
+  }
+  strcpy(out->tokens[out->token_count], name);
+  return out->token_count++;
+}
+
+static void gen_upper(const char* text, char* out) {
+  for (; *text != '\0'; text++) {
+    *out++ = (char)toupper((unsigned char)*text);
+  }
+  *out = '\0';
+}
+
+static void gen_write_header(GenOutput* out, FILE* f) {
+  char guard[GenNameLength * 2], field[GenNameLength * 2];
+  char path[GenNameLength * 4];
+  unsigned int i;
+
+  gen_upper(out->prefix, guard);
+  gen_node_path(out->model, out->record, 0, path, sizeof(path));
+  fprintf(f, "/* Generated by sxml-gen from %s; do not edit. */\n", out->sources);
+  fprintf(f, "#ifndef __%s_GEN__\n#define __%s_GEN__\n\n", guard, guard);
+  fprintf(f, "#include \"sparsexml.h\"\n#include \"sparsexml-bind.h\"\n\n");
+  fprintf(f, "// Record /%s\ntypedef struct {\n", path);
+  for (i = 0; i < out->field_count; i++) {
+    fprintf(f, "  %s %s;  // %s\n", gen_c_type(out->fields[i].type), out->fields[i].name, out->fields[i].path);
+  }
+  if (out->field_count == 0) {
+    fprintf(f, "  char empty;\n");
+  }
+  fprintf(f, "} %s;\n\n", out->record_type);
+  for (i = 0; i < out->field_count; i++) {
+    gen_upper(out->fields[i].name, field);
+    fprintf(f, "#define %s_%s (1ul << %u)\n", out->upper, field, i);
+  }
+  fprintf(f, "\ntypedef struct __%s_parser %s_parser;\n\n", out->prefix, out->prefix);
+  fprintf(f, "// Takes over the explorer's event func and turns entity processing on;\n");
+  fprintf(f, "// destroy the parser before the explorer\n");
+  fprintf(f, "%s_parser* %s_make_parser(SXMLExplorer*);\n", out->prefix, out->prefix);
+  fprintf(f, "void %s_destroy_parser(%s_parser*);\n\n", out->prefix, out->prefix);
+  fprintf(f, "// Record func: unsigned char (*)(void* user, %s* record, unsigned long fields),\n", out->record_type);
+  fprintf(f, "// fields holding the %s_* bits of the fields found. Text spans stay valid\n", out->upper);
+  fprintf(f, "// until the next record starts.\n");
+  fprintf(f, "void %s_register_record_func(%s_parser*, void*, void*);\n\n#endif\n", out->prefix, out->prefix);
+}
+
+static void gen_write_source(GenOutput* out, FILE* f) {
+  GenModel* model = out->model;
+  const char* p = out->prefix;
+  const char* cell = out->state_count < 256 ? "unsigned char" : "unsigned short";
+  unsigned int seed, slots, i, t, s;
+  unsigned int* slot_token;
+  char macro[GenNameLength];
+
+  gen_upper(p, macro);
+  gen_perfect_hash(out->tokens, out->token_count, &seed, &slots);
+  slot_token = calloc(slots, sizeof(unsigned int));
+  for (t = 1; t < out->token_count; t++) {
+    slot_token[gen_hash(seed, out->tokens[t], (unsigned int)strlen(out->tokens[t])) & (slots - 1)] = t;
+  }
+
+  fprintf(f, "/* Generated by sxml-gen from %s; do not edit. */\n", out->sources);
+  fprintf(f, "#include <stdlib.h>\n#include <string.h>\n\n#include \"%s\"\n\n", out->header);
+  fprintf(f, "#define %s_STATES %u\n", macro, out->state_count);
+  fprintf(f, "#define %s_TOKENS %u\n", macro, out->token_count);
+  fprintf(f, "#define %s_SLOTS %u\n", macro, slots);
+  fprintf(f, "#define %s_RECORD %d\n", macro, out->state_of[out->record]);
+  fprintf(f, "#define %s_MAX_DEPTH 256\n", macro);
+  fprintf(f, "#define %s_ARENA_LENGTH 4096\n\n", macro);
+
+  fprintf(f, "struct __%s_parser {\n", p);
+  fprintf(f, "  SXMLExplorer* explorer;\n");
+  fprintf(f, "  %s stack[%s_MAX_DEPTH];\n", cell, macro);
+  fprintf(f, "  unsigned int depth;\n");
+  fprintf(f, "  unsigned int attr;\n");
+  fprintf(f, "  %s record;\n", out->record_type);
+  fprintf(f, "  unsigned long fields;\n");
+  fprintf(f, "  char arena[%s_ARENA_LENGTH];\n", macro);
+  fprintf(f, "  unsigned int arena_used;\n");
+  fprintf(f, "  unsigned char (*record_func)(void *, %s *, unsigned long);\n", out->record_type);
+  fprintf(f, "  void* record_user;\n};\n\n");
+
+  // Names
+  fprintf(f, "static const char* const %s_names[%s_TOKENS] = {\n  \"\"", p, macro);
+  for (t = 1; t < out->token_count; t++) {
+    fprintf(f, ",%s\"%s\"", t % 6 == 0 ? "\n  " : " ", out->tokens[t]);
+  }
+  fprintf(f, "\n};\n\nstatic const unsigned char %s_lengths[%s_TOKENS] = {\n  0", p, macro);
+  for (t = 1; t < out->token_count; t++) {
+    fprintf(f, ",%s%u", t % 16 == 0 ? "\n  " : " ", (unsigned int)strlen(out->tokens[t]));
+  }
+  fprintf(f, "\n};\n\nstatic const %s %s_slots[%s_SLOTS] = {\n  ",
+          out->token_count < 256 ? "unsigned char" : "unsigned short", p, macro);
+  for (i = 0; i < slots; i++) {
+    fprintf(f, "%u%s", slot_token[i], i + 1 == slots ? "\n" : (i % 16 == 15 ? ",\n  " : ", "));
+  }
+  fprintf(f, "};\n\n");
+  free(slot_token);
+
+  // Transitions: state x token, state 0 absorbs unknown subtrees
+  fprintf(f, "static const %s %s_next[%s_STATES][%s_TOKENS] = {\n", cell, p, macro, macro);
+  for (s = 0; s < out->state_count; s++) {
+    int from = -1;
+    char path[GenNameLength * 4];
+    for (i = 0; i < model->count && s > 0; i++) {
+      if (out->state_of[i] == (int)s) {
+        from = (int)i;
+        break;
+      }
+    }
+    fprintf(f, "  {");
+    for (t = 0; t < out->token_count; t++) {
+      int to = 0;
+      for (i = 1; i < model->count && from >= 0; i++) {
+        if (model->nodes[i].parent == from && !model->nodes[i].attribute && strcmp(model->nodes[i].name, out->tokens[t]) == 0) {
+          to = out->state_of[i];
+        }
+      }
+      fprintf(f, "%s%d", t == 0 ? " " : ", ", to);
+    }
+    gen_node_path(model, from, 0, path, sizeof(path));
+    fprintf(f, " },  // %s%s\n", s == 0 ? "(unknown)" : "/", path);
+  }
+  fprintf(f, "};\n\n");
+
+  // Text fields by state
+  fprintf(f, "static const unsigned char %s_text_field[%s_STATES] = {\n  ", p, macro);
+  for (s = 0; s < out->state_count; s++) {
+    unsigned int field = 0;
+    for (i = 0; i < out->field_count; i++) {
+      if (!model->nodes[out->fields[i].node].attribute && out->state_of[out->fields[i].node] == (int)s) {
+        field = i + 1;
+      }
+    }
+    fprintf(f, "%u%s", field, s + 1 == out->state_count ? "\n" : (s % 16 == 15 ? ",\n  " : ", "));
+  }
+  fprintf(f, "};\n\n");
+
+  fprintf(f, "static unsigned int %s_token(const char* name, unsigned int len) {\n", p);
+  fprintf(f, "  unsigned int h = 0x%08Xu, n, t;\n", seed);
+  fprintf(f, "  for (n = 0; n < len; n++) {\n");
+  fprintf(f, "    h = (h ^ (unsigned char)name[n]) * %uu;\n  }\n", GenPrime);
+  fprintf(f, "  t = %s_slots[(h ^ (h >> 15)) & (%s_SLOTS - 1)];\n", p, macro);
+  fprintf(f, "  return t != 0 && %s_lengths[t] == len && memcmp(%s_names[t], name, len) == 0 ? t : 0;\n}\n\n", p, p);
+
+  // Attribute fields by state and token
+  fprintf(f, "static unsigned int %s_attr_field(unsigned int state, unsigned int token) {\n", p);
+  fprintf(f, "  switch (state) {\n");
+  for (s = 1; s < out->state_count; s++) {
+    unsigned char open = 0;
+    for (i = 0; i < out->field_count; i++) {
+      GenNode* n = &model->nodes[out->fields[i].node];
+      if (!n->attribute || out->state_of[n->parent] != (int)s) {
+        continue;
+      }
+      if (!open) {
+        fprintf(f, "    case %u:\n      switch (token) {\n", s);
+        open = 1;
+      }
+      fprintf(f, "        case %u: return %u;  // %s\n", gen_token(out, n->name), i + 1, out->fields[i].path);
+    }
+    if (open) {
+      fprintf(f, "      }\n      break;\n");
+    }
+  }
+  fprintf(f, "  }\n  return 0;\n}\n\n");
+
+  fprintf(f, "static unsigned char %s_space(char c) {\n", p);
+  fprintf(f, "  return c == ' ' || c == '\\t' || c == '\\n' || c == '\\r';\n}\n\n");
+
+  fprintf(f, "static unsigned char %s_text(%s_parser* parser, SXMLSpan* span, const char* text, unsigned int len) {\n", p, p);
+  fprintf(f, "  if (parser->arena_used + len + 1 > %s_ARENA_LENGTH) {\n    return 0;\n  }\n", macro);
+  fprintf(f, "  span->text = parser->arena + parser->arena_used;\n");
+  fprintf(f, "  span->len = len;\n");
+  fprintf(f, "  memcpy(parser->arena + parser->arena_used, text, len);\n");
+  fprintf(f, "  parser->arena[parser->arena_used + len] = '\\0';\n");
+  fprintf(f, "  parser->arena_used += len + 1;\n  return 1;\n}\n\n");
+
+  fprintf(f, "static void %s_store(%s_parser* parser, unsigned int field, const char* text, unsigned int len) {\n", p, p);
+  fprintf(f, "  unsigned char stored = 0;\n");
+  fprintf(f, "  if (parser->fields & (1ul << field)) {\n    return;\n  }\n");
+  fprintf(f, "  switch (field) {\n");
+  for (i = 0; i < out->field_count; i++) {
+    if (out->fields[i].type == SXMLBindText) {
+      fprintf(f, "    case %u: stored = %s_text(parser, &parser->record.%s, text, len); break;\n", i, p, out->fields[i].name);
+    } else if (out->fields[i].type == SXMLBindTimestamp) {
+      fprintf(f, "    case %u: stored = sxml_to_timestamp(text, len, &parser->record.%s, NULL); break;\n", i, out->fields[i].name);
+    } else {
+      fprintf(f, "    case %u: stored = %s(text, len, &parser->record.%s); break;\n", i,
+              gen_convert(out->fields[i].type), out->fields[i].name);
+    }
+  }
+  fprintf(f, "  }\n  if (stored) {\n    parser->fields |= 1ul << field;\n  }\n}\n\n");
+
+  fprintf(f, "static unsigned char %s_pop(%s_parser* parser) {\n", p, p);
+  fprintf(f, "  if (parser->depth == 0) {\n    return SXMLExplorerErrorMalformedXML;\n  }\n");
+  fprintf(f, "  if (parser->stack[--parser->depth] == %s_RECORD && parser->record_func != NULL) {\n", macro);
+  fprintf(f, "    return parser->record_func(parser->record_user, &parser->record, parser->fields);\n  }\n");
+  fprintf(f, "  return SXMLExplorerContinue;\n}\n\n");
+
+  fprintf(f, "static unsigned char %s_tag(%s_parser* parser, const char* name, unsigned int len) {\n", p, p);
+  fprintf(f, "  unsigned char empty = 0;\n  unsigned int state;\n\n");
+  fprintf(f, "  // The first tag keeps its '<'; line breaks inside a start tag arrive as\n");
+  fprintf(f, "  // blank tag events\n");
+  fprintf(f, "  if (len > 0 && name[0] == '<') {\n    name++;\n    len--;\n  }\n");
+  fprintf(f, "  while (len > 0 && %s_space(name[len - 1])) {\n    len--;\n  }\n", p);
+  fprintf(f, "  if (len == 0) {\n    return SXMLExplorerContinue;\n  }\n");
+  fprintf(f, "  if (name[0] == '/') {\n    return %s_pop(parser);\n  }\n", p);
+  fprintf(f, "  if (name[len - 1] == '/') {\n    empty = 1;\n    len--;\n  }\n");
+  fprintf(f, "  if (parser->depth == %s_MAX_DEPTH) {\n    return SXMLExplorerErrorBufferOverflow;\n  }\n", macro);
+  fprintf(f, "  state = %s_next[parser->depth > 0 ? parser->stack[parser->depth - 1] : 1][%s_token(name, len)];\n", p, p);
+  fprintf(f, "  parser->stack[parser->depth++] = (%s)state;\n", cell);
+  fprintf(f, "  if (state == %s_RECORD) {\n", macro);
+  fprintf(f, "    memset(&parser->record, 0, sizeof(parser->record));\n");
+  fprintf(f, "    parser->fields = 0;\n    parser->arena_used = 0;\n  }\n");
+  fprintf(f, "  return empty ? %s_pop(parser) : SXMLExplorerContinue;\n}\n\n", p);
+
+  fprintf(f, "static unsigned char %s_event(void* user, SXMLEventType type, char* text, unsigned int len) {\n", p);
+  fprintf(f, "  %s_parser* parser = user;\n  unsigned int field;\n\n", p);
+  fprintf(f, "  switch (type) {\n");
+  fprintf(f, "    case SXMLEventTag:\n      return %s_tag(parser, text, len);\n", p);
+  fprintf(f, "    case SXMLEventAttributeKey:\n");
+  fprintf(f, "      while (len > 0 && %s_space(*text)) {\n        text++;\n        len--;\n      }\n", p);
+  fprintf(f, "      parser->attr = %s_token(text, len);\n      break;\n", p);
+  fprintf(f, "    case SXMLEventAttributeValue:\n");
+  fprintf(f, "      if (parser->depth > 0 && (field = %s_attr_field(parser->stack[parser->depth - 1], parser->attr)) != 0) {\n", p);
+  fprintf(f, "        %s_store(parser, field - 1, text, len);\n      }\n      break;\n", p);
+  fprintf(f, "    case SXMLEventContent:\n");
+  fprintf(f, "      if (parser->depth > 0 && (field = %s_text_field[parser->stack[parser->depth - 1]]) != 0) {\n", p);
+  fprintf(f, "        %s_store(parser, field - 1, text, len);\n      }\n      break;\n", p);
+  fprintf(f, "    default:\n      break;\n  }\n  return SXMLExplorerContinue;\n}\n\n");
+
+  fprintf(f, "%s_parser* %s_make_parser(SXMLExplorer* explorer) {\n", p, p);
+  fprintf(f, "  %s_parser* parser = calloc(1, sizeof(%s_parser));\n", p, p);
+  fprintf(f, "  if (parser == NULL) {\n    return NULL;\n  }\n");
+  fprintf(f, "  parser->explorer = explorer;\n");
+  fprintf(f, "  sxml_enable_entity_processing(explorer, 1);\n");
+  fprintf(f, "  sxml_register_event_func(explorer, %s_event, parser);\n  return parser;\n}\n\n", p);
+  fprintf(f, "void %s_destroy_parser(%s_parser* parser) {\n", p, p);
+  fprintf(f, "  sxml_register_event_func(parser->explorer, NULL, NULL);\n  free(parser);\n}\n\n");
+  fprintf(f, "void %s_register_record_func(%s_parser* parser, void* func, void* user) {\n", p, p);
+  fprintf(f, "  parser->record_func = func;\n  parser->record_user = user;\n}\n");
+}
+
+static int gen_write(GenOutput* out, const char* base) {
+  char path[4096];
+  FILE* f;
+
+  snprintf(path, sizeof(path), "%s.h", base);
+  if ((f = fopen(path, "w")) == NULL) {
+    fprintf(stderr, "sxml-gen: %s: cannot write\n", path);
+    return 1;
+  }
+  gen_write_header(out, f);
+  fclose(f);
+
+  snprintf(path, sizeof(path), "%s.c", base);
+  if ((f = fopen(path, "w")) == NULL) {
+    fprintf(stderr, "sxml-gen: %s: cannot write\n", path);
+    return 1;
+  }
+  gen_write_source(out, f);
+  fclose(f);
+  return 0;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+static void gen_usage(void) {
+  fprintf(stderr,
+          "usage: sxml-gen -o base [-p prefix] [-r record-path] input.xml... | input.xsd\n"
+          "  -o B   write B.h and B.c\n"
+          "  -p P   prefix of generated names (default: file name of B)\n"
+          "  -r R   record element as an absolute path, e.g. /rss/channel/item\n"
+          "         (default: the most frequent element with children)\n");
+}
+
+int main(int argc, char** argv) {
+  static GenModel model;
+  static char tokens[GenMaxNodes + 1][GenNameLength];
+  static int state_of[GenMaxNodes];
+  static char sources[1024];
+  const char* base = NULL;
+  const char* prefix = NULL;
+  const char* record = NULL;
+  char header[GenNameLength];
+  char record_name[GenNameLength];
+  GenOutput out;
+  unsigned int inputs = 0, i;
+  int arg, errors = 0;
+
+  gen_init_model(&model);
+  for (arg = 1; arg < argc; arg++) {
+    if (strcmp(argv[arg], "-o") == 0 && arg + 1 < argc) {
+      base = argv[++arg];
+    } else if (strcmp(argv[arg], "-p") == 0 && arg + 1 < argc) {
+      prefix = argv[++arg];
+    } else if (strcmp(argv[arg], "-r") == 0 && arg + 1 < argc) {
+      record = argv[++arg];
+    } else if (argv[arg][0] == '-') {
+      gen_usage();
+      return 2;
+    }
+  }
+  if (base == NULL) {
+    gen_usage();
+    return 2;
+  }
+
+  for (arg = 1; arg < argc; arg++) {
+    const char* input = argv[arg];
+    size_t len = strlen(input);
+    if (input[0] == '-') {
+      arg++;
+      continue;
+    }
+    if (len > 4 && strcmp(input + len - 4, ".xsd") == 0) {
+      char root[GenNameLength] = "";
+      if (record != NULL) {
+        sscanf(record, "/%127[^/]", root);
+      }
+      errors += gen_read_schema(&model, input, root[0] != '\0' ? root : NULL);
+    } else {
+      errors += gen_read_sample(&model, input);
+    }
+    snprintf(sources + strlen(sources), sizeof(sources) - strlen(sources), "%s%s", inputs++ > 0 ? ", " : "", input);
+  }
+  if (inputs == 0) {
+    gen_usage();
+    return 2;
+  }
+  if (errors > 0) {
+    return 1;
+  }
+  if (model.overflow) {
+    fprintf(stderr, "sxml-gen: more than %d distinct elements and attributes\n", GenMaxNodes);
+    return 1;
+  }
+
+  memset(&out, 0, sizeof(out));
+  out.model = &model;
+  out.sources = sources;
+  if ((out.record = gen_find_record(&model, record)) < 0) {
+    fprintf(stderr, "sxml-gen: no record element %s\n", record != NULL ? record : "found");
+    return 1;
+  }
+
+  // Prefix and header name from the output base
+  snprintf(header, sizeof(header), "%s.h", strrchr(base, '/') != NULL ? strrchr(base, '/') + 1 : base);
+  if (prefix == NULL) {
+    static char derived[GenNameLength];
+    char stem[GenNameLength];
+    snprintf(stem, sizeof(stem), "%.*s", (int)(strlen(header) - 2), header);
+    gen_identifier(stem, derived, sizeof(derived));
+    prefix = derived;
+  }
+  out.prefix = prefix;
+  out.header = header;
+  gen_identifier(gen_local(model.nodes[out.record].name), record_name, sizeof(record_name));
+  snprintf(out.record_type, sizeof(out.record_type), "%s_%s", prefix, record_name);
+  gen_upper(out.record_type, out.upper);
+
+  out.field_count = gen_collect_fields(&model, out.record, out.fields);
+
+  // States: 0 unknown, 1 document, then every element; tokens: element names
+  // first, attribute names as the attribute switch asks for them
+  out.tokens = tokens;
+  out.token_count = 1;
+  out.state_of = state_of;
+  out.state_count = 2;
+  state_of[0] = 1;
+  for (i = 1; i < model.count; i++) {
+    if (!model.nodes[i].attribute) {
+      state_of[i] = (int)out.state_count++;
+      gen_token(&out, model.nodes[i].name);
+    }
+  }
+  for (i = 0; i < out.field_count; i++) {
+    if (model.nodes[out.fields[i].node].attribute) {
+      gen_token(&out, model.nodes[out.fields[i].node].name);
+    }
+  }
+
+  if (gen_write(&out, base) != 0) {
+    return 1;
+  }
+  printf("%s: %u fields, %u states, %u names\n", out.record_type, out.field_count, out.state_count, out.token_count - 1);
+  return 0;
+}
@@ -0,0 +1,643 @@
+/*
+ * sxml-scan: parallel scanner for XML/EXI corpora
+ *
+ * Walks the given files, directories and file lists, runs the explorer over
+ * every document on a work-stealing thread pool and prints per-file and
+ * aggregate tag/attribute/content counts, throughput and errors.
+ *
+ * Files larger than the split size are cut into sub-tasks by the shard
+ * planner so that a single huge document keeps every core busy.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+
+#include "sparsexml.h"
+#include "sparsexml-shard.h"
+
+#define ScanDefaultSplitSize (4u * 1024u * 1024u)
+#define ScanMaxThreads 256
+
+typedef struct {
+  char* path;
+  char* data;              // Whole file, NUL-terminated
+  size_t size;
+  unsigned char is_exi;
+
+  atomic_uint pending;     // Sub-tasks still running for this file
+  atomic_ullong tags;
+  atomic_ullong attributes;
+  atomic_ullong contents;
+  atomic_ullong comments;
+  atomic_ullong busy_ns;   // Sum of sub-task parse times
+  atomic_uchar status;     // First non-complete result wins
+  int io_errno;
+} ScanFile;
+
+typedef struct {
+  ScanFile* file;
+  size_t begin;            // SIZE_MAX: load (and maybe split) the whole file
+  size_t end;
+} ScanTask;
+
+typedef struct {
+  ScanTask* tasks;
+  size_t head;             // Thieves take from here
+  size_t tail;             // Owner pushes and pops here
+  size_t cap;
+  pthread_mutex_t lock;
+} ScanDeque;
+
+typedef struct {
+  ScanFile* files;
+  size_t file_count;
+  size_t file_cap;
+
+  ScanDeque* deques;
+  unsigned int threads;
+  size_t split_size;
+  unsigned char entities;
+  unsigned char tags_only;
+  atomic_size_t outstanding;
+} ScanPool;
+
+// Callbacks carry no context, so counters live per worker thread and are
+// folded into the owning file after every sub-task.
+static _Thread_local unsigned long long scan_tags;
+static _Thread_local unsigned long long scan_attributes;
+static _Thread_local unsigned long long scan_contents;
+static _Thread_local unsigned long long scan_comments;
+
+static unsigned char scan_on_tag(char* name) {
+  (void)name;
+  scan_tags++;
+  return SXMLExplorerContinue;
+}
+
+static unsigned char scan_on_content(char* content) {
+  (void)content;
+  scan_contents++;
+  return SXMLExplorerContinue;
+}
+
+static unsigned char scan_on_attribute_key(char* key) {
+  (void)key;
+  scan_attributes++;
+  return SXMLExplorerContinue;
+}
+
+static unsigned char scan_on_comment(char* comment) {
+  (void)comment;
+  scan_comments++;
+  return SXMLExplorerContinue;
+}
+
+static unsigned long long scan_now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long long)ts.tv_sec * 1000000000ull + (unsigned long long)ts.tv_nsec;
+}
+
+static const char* scan_status_name(unsigned char status) {
+  switch (status) {
+    case SXMLExplorerComplete: return "ok";
+    case SXMLExplorerInterrupted: return "interrupted";
+    case SXMLExplorerErrorInvalidEntity: return "invalid-entity";
+    case SXMLExplorerErrorBufferOverflow: return "buffer-overflow";
+    case SXMLExplorerErrorMalformedXML: return "malformed";
+    case SXMLExplorerSuspended: return "suspended";
+  }
+  return "unknown";
+}
+
+static int scan_has_suffix(const char* path, const char* suffix) {
+  size_t len = strlen(path);
+  size_t slen = strlen(suffix);
+  return len >= slen && strcmp(path + len - slen, suffix) == 0;
+}
+
+// =============================================================================
+// WORK-STEALING DEQUE
+// =============================================================================
+
+// Returns -1 when the deque cannot grow; the task is not queued
+static int scan_deque_push(ScanDeque* deque, ScanTask task) {
+  pthread_mutex_lock(&deque->lock);
+  if (deque->tail == deque->cap) {
+    size_t live = deque->tail - deque->head;
+    if (deque->head > 0 && live < deque->cap / 2) {
+      memmove(deque->tasks, deque->tasks + deque->head, live * sizeof(ScanTask));
+    } else {
+      size_t cap = deque->cap ? deque->cap * 2 : 64;
+      ScanTask* tasks = realloc(deque->tasks, cap * sizeof(ScanTask));
+      if (tasks == NULL) {
+        pthread_mutex_unlock(&deque->lock);
+        return -1;
+      }
+      deque->tasks = tasks;
+      deque->cap = cap;
+    }
+    deque->head = 0;
+    deque->tail = live;
+  }
+  deque->tasks[deque->tail++] = task;
+  pthread_mutex_unlock(&deque->lock);
+  return 0;
+}
+
+static int scan_deque_pop(ScanDeque* deque, ScanTask* task) {
+  int found = 0;
+  pthread_mutex_lock(&deque->lock);
+  if (deque->tail > deque->head) {
+    *task = deque->tasks[--deque->tail];
+    found = 1;
+  }
+  pthread_mutex_unlock(&deque->lock);
+  return found;
+}
+
+static int scan_deque_steal(ScanDeque* deque, ScanTask* task) {
+  int found = 0;
+  if (pthread_mutex_trylock(&deque->lock) != 0) {
+    return 0;
+  }
+  if (deque->tail > deque->head) {
+    *task = deque->tasks[deque->head++];
+    found = 1;
+  }
+  pthread_mutex_unlock(&deque->lock);
+  return found;
+}
+
+// =============================================================================
+// TASKS
+// =============================================================================
+
+static void scan_record_status(ScanFile* file, unsigned char status) {
+  unsigned char expected = SXMLExplorerComplete;
+  if (status != SXMLExplorerComplete) {
+    atomic_compare_exchange_strong(&file->status, &expected, status);
+  }
+}
+
+static void scan_release_file(ScanFile* file) {
+  if (atomic_fetch_sub(&file->pending, 1) == 1) {
+    free(file->data);
+    file->data = NULL;
+  }
+}
+
+static int scan_load_file(ScanFile* file) {
+  FILE* f = fopen(file->path, "rb");
+  long size;
+
+  if (f == NULL) {
+    return errno;
+  }
+  if (fseek(f, 0, SEEK_END) != 0 || (size = ftell(f)) < 0) {
+    int err = errno;
+    fclose(f);
+    return err;
+  }
+  rewind(f);
+  file->data = malloc((size_t)size + 1);
+  if (file->data == NULL) {
+    fclose(f);
+    return ENOMEM;
+  }
+  file->size = fread(file->data, 1, (size_t)size, f);
+  file->data[file->size] = '\0';
+  fclose(f);
+  return 0;
+}
+
+static void scan_run_range(ScanPool* pool, ScanFile* file, size_t begin, size_t end) {
+  SXMLExplorer* explorer = sxml_make_explorer();
+  unsigned long long started;
+  unsigned char status;
+
+  sxml_register_func(explorer, scan_on_tag, scan_on_content, scan_on_attribute_key, NULL);
+  sxml_register_comment_func(explorer, scan_on_comment);
+  sxml_enable_tag_scan(explorer, pool->tags_only);
+  if (pool->entities) {
+    sxml_enable_entity_processing(explorer, 1);
+    sxml_enable_numeric_entities(explorer, 1);
+    sxml_enable_extended_entities(explorer, 1);
+  }
+
+  scan_tags = scan_attributes = scan_contents = scan_comments = 0;
+  started = scan_now_ns();
+
+  if (file->is_exi) {
+    status = sxml_run_explorer_exi(explorer, (unsigned char*)file->data, (unsigned int)file->size);
+  } else {
+    SXMLShard shard;
+    shard.begin = begin;
+    shard.end = end;
+    shard.depth = 0;
+    shard.context[0] = '\0';
+    status = sxml_run_explorer_shard(explorer, file->data, &shard);
+  }
+
+  atomic_fetch_add(&file->busy_ns, scan_now_ns() - started);
+  atomic_fetch_add(&file->tags, scan_tags);
+  atomic_fetch_add(&file->attributes, scan_attributes);
+  atomic_fetch_add(&file->contents, scan_contents);
+  atomic_fetch_add(&file->comments, scan_comments);
+  scan_record_status(file, status);
+
+  sxml_destroy_explorer(explorer);
+}
+
+static void scan_execute(ScanPool* pool, unsigned int self, ScanTask task) {
+  ScanFile* file = task.file;
+
+  if (task.begin == SIZE_MAX) {
+    file->io_errno = scan_load_file(file);
+    if (file->io_errno != 0) {
+      atomic_store(&file->pending, 0);
+      atomic_fetch_sub(&pool->outstanding, 1);
+      return;
+    }
+    if (!file->is_exi && file->size > pool->split_size) {
+      // Queue every shard after the first for thieves, keep the first one
+      unsigned int max_shards = (unsigned int)(file->size / pool->split_size) + 2;
+      SXMLShard* shards = malloc(max_shards * sizeof(SXMLShard));
+      unsigned int count, s;
+      if (shards == NULL) {
+        // Reported like a file that could not be read
+        file->io_errno = ENOMEM;
+        scan_release_file(file);
+        atomic_fetch_sub(&pool->outstanding, 1);
+        return;
+      }
+      count = sxml_plan_shards(file->data, file->size, pool->split_size, shards, max_shards);
+      for (s = 1; s < count; s++) {
+        ScanTask sub;
+        sub.file = file;
+        sub.begin = shards[s].begin;
+        sub.end = shards[s].end;
+        atomic_fetch_add(&file->pending, 1);
+        atomic_fetch_add(&pool->outstanding, 1);
+        if (scan_deque_push(&pool->deques[self], sub) != 0) {
+          // The rest of the file goes unscanned and is reported as an error
+          fprintf(stderr, "sxml-scan: %s: %s\n", file->path, strerror(ENOMEM));
+          file->io_errno = ENOMEM;
+          atomic_fetch_sub(&file->pending, 1);
+          atomic_fetch_sub(&pool->outstanding, 1);
+          break;
+        }
+      }
+      task.begin = 0;
+      task.end = shards[0].end;
+      free(shards);
+    } else {
+      task.begin = 0;
+      task.end = file->size;
+    }
+  }
+
+  scan_run_range(pool, file, task.begin, task.end);
+  scan_release_file(file);
+  atomic_fetch_sub(&pool->outstanding, 1);
+}
+
+typedef struct {
+  ScanPool* pool;
+  unsigned int self;
+} ScanWorker;
+
+static void* scan_worker(void* arg) {
+  ScanWorker* worker = arg;
+  ScanPool* pool = worker->pool;
+  ScanTask task;
+
+  while (atomic_load(&pool->outstanding) > 0) {
+    unsigned int i;
+    int found = scan_deque_pop(&pool->deques[worker->self], &task);
+    for (i = 1; !found && i < pool->threads; i++) {
+      found = scan_deque_steal(&pool->deques[(worker->self + i) % pool->threads], &task);
+    }
+    if (found) {
+      scan_execute(pool, worker->self, task);
+    } else {
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+// =============================================================================
+// INPUT COLLECTION
+// =============================================================================
+
+// The add functions return -1 when out of memory, which ends the scan
+static int scan_add_file(ScanPool* pool, const char* path) {
+  ScanFile* file;
+  char* copy = strdup(path);
+  if (copy == NULL) {
+    fprintf(stderr, "sxml-scan: %s: %s\n", path, strerror(ENOMEM));
+    return -1;
+  }
+  if (pool->file_count == pool->file_cap) {
+    size_t cap = pool->file_cap ? pool->file_cap * 2 : 64;
+    ScanFile* files = realloc(pool->files, cap * sizeof(ScanFile));
+    if (files == NULL) {
+      fprintf(stderr, "sxml-scan: %s: %s\n", path, strerror(ENOMEM));
+      free(copy);
+      return -1;
+    }
+    pool->files = files;
+    pool->file_cap = cap;
+  }
+  file = &pool->files[pool->file_count++];
+  memset(file, 0, sizeof(*file));
+  file->path = copy;
+  file->is_exi = scan_has_suffix(path, ".exi");
+  atomic_init(&file->status, SXMLExplorerComplete);
+  return 0;
+}
+
+static int scan_add_path(ScanPool* pool, const char* path, int explicit);
+
+static int scan_add_directory(ScanPool* pool, const char* path) {
+  DIR* dir = opendir(path);
+  struct dirent* entry;
+  int ret = 0;
+  if (dir == NULL) {
+    fprintf(stderr, "sxml-scan: %s: %s\n", path, strerror(errno));
+    return 0;
+  }
+  while ((entry = readdir(dir)) != NULL) {
+    size_t len;
+    char* child;
+    if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+      continue;
+    }
+    len = strlen(path) + strlen(entry->d_name) + 2;
+    child = malloc(len);
+    if (child == NULL) {
+      fprintf(stderr, "sxml-scan: %s: %s\n", path, strerror(ENOMEM));
+      ret = -1;
+      break;
+    }
+    snprintf(child, len, "%s/%s", path, entry->d_name);
+    ret = scan_add_path(pool, child, 0);
+    free(child);
+    if (ret != 0) {
+      break;
+    }
+  }
+  closedir(dir);
+  return ret;
+}
+
+static int scan_add_path(ScanPool* pool, const char* path, int explicit) {
+  struct stat st;
+  if (stat(path, &st) != 0) {
+    // Reported as an I/O error
+    return explicit ? scan_add_file(pool, path) : 0;
+  }
+  if (S_ISDIR(st.st_mode)) {
+    return scan_add_directory(pool, path);
+  } else if (explicit || scan_has_suffix(path, ".xml") || scan_has_suffix(path, ".exi")) {
+    return scan_add_file(pool, path);
+  }
+  return 0;
+}
+
+static int scan_add_list(ScanPool* pool, const char* list) {
+  FILE* f = strcmp(list, "-") == 0 ? stdin : fopen(list, "r");
+  char line[4096];
+  int ret = 0;
+  if (f == NULL) {
+    fprintf(stderr, "sxml-scan: %s: %s\n", list, strerror(errno));
+    return -1;
+  }
+  while (ret == 0 && fgets(line, sizeof(line), f) != NULL) {
+    size_t len = strcspn(line, "\r\n");
+    line[len] = '\0';
+    if (len > 0 && line[0] != '#') {
+      ret = scan_add_path(pool, line, 1);
+    }
+  }
+  if (f != stdin) {
+    fclose(f);
+  }
+  return ret;
+}
+
+// =============================================================================
+// MAIN
+// =============================================================================
+
+static void scan_usage(void) {
+  fprintf(stderr,
+          "usage: sxml-scan [-j threads] [-s split-bytes] [-l list] [-e] [-t] [-q] [-p] [path...]\n"
+          "  -j N   worker threads (default: online CPUs)\n"
+          "  -s N   split files larger than N bytes into sub-tasks (default %u)\n"
+          "  -l F   read paths from F, one per line ('-' for stdin)\n"
+          "  -e     enable entity processing (standard, numeric, extended)\n"
+          "  -t     tags and attributes only: skip content, comments and CDATA\n"
+          "  -q     print only the aggregate summary\n"
+          "  -p     print a shard plan (split-bytes per shard) instead of scanning\n",
+          ScanDefaultSplitSize);
+}
+
+// Prints "<path>\t<shard line>" for every shard of every XML input, for
+// distributing ranges to independent workers.
+static int scan_print_plans(ScanPool* pool, size_t target) {
+  char line[SXMLShardContextLength + 64];
+  int errors = 0;
+  size_t i;
+  for (i = 0; i < pool->file_count; i++) {
+    ScanFile* file = &pool->files[i];
+    unsigned int max_shards, count, s;
+    SXMLShard* shards;
+    if (file->is_exi) {
+      continue;
+    }
+    if ((file->io_errno = scan_load_file(file)) != 0) {
+      fprintf(stderr, "sxml-scan: %s: %s\n", file->path, strerror(file->io_errno));
+      errors++;
+      continue;
+    }
+    max_shards = (unsigned int)(file->size / target) + 2;
+    shards = malloc(max_shards * sizeof(SXMLShard));
+    if (shards == NULL) {
+      fprintf(stderr, "sxml-scan: %s: %s\n", file->path, strerror(ENOMEM));
+      errors++;
+      free(file->data);
+      file->data = NULL;
+      continue;
+    }
+    count = sxml_plan_shards(file->data, file->size, target, shards, max_shards);
+    for (s = 0; s < count; s++) {
+      sxml_format_shard(&shards[s], line, sizeof(line));
+      printf("%s\t%s", file->path, line);
+    }
+    free(shards);
+    free(file->data);
+    file->data = NULL;
+  }
+  return errors > 0 ? 1 : 0;
+}
+
+static double scan_rate(unsigned long long bytes, unsigned long long ns) {
+  return ns > 0 ? (double)bytes / ((double)ns / 1e9) : 0.0;
+}
+
+int main(int argc, char** argv) {
+  ScanPool pool;
+  ScanWorker workers[ScanMaxThreads];
+  pthread_t tids[ScanMaxThreads];
+  unsigned long long started, elapsed;
+  unsigned long long total_bytes = 0, total_tags = 0, total_attributes = 0;
+  unsigned long long total_contents = 0, total_comments = 0;
+  unsigned int errors = 0;
+  unsigned char quiet = 0;
+  unsigned char plan = 0;
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  size_t i, started_threads;
+  int arg, err;
+
+  memset(&pool, 0, sizeof(pool));
+  pool.threads = cpus > 0 ? (unsigned int)cpus : 1;
+  pool.split_size = ScanDefaultSplitSize;
+
+  for (arg = 1; arg < argc; arg++) {
+    if (strcmp(argv[arg], "-j") == 0 && arg + 1 < argc) {
+      pool.threads = (unsigned int)atoi(argv[++arg]);
+    } else if (strcmp(argv[arg], "-s") == 0 && arg + 1 < argc) {
+      pool.split_size = (size_t)strtoull(argv[++arg], NULL, 10);
+    } else if (strcmp(argv[arg], "-l") == 0 && arg + 1 < argc) {
+      if (scan_add_list(&pool, argv[++arg]) != 0) {
+        return 2;
+      }
+    } else if (strcmp(argv[arg], "-e") == 0) {
+      pool.entities = 1;
+    } else if (strcmp(argv[arg], "-t") == 0) {
+      pool.tags_only = 1;
+    } else if (strcmp(argv[arg], "-q") == 0) {
+      quiet = 1;
+    } else if (strcmp(argv[arg], "-p") == 0) {
+      plan = 1;
+    } else if (argv[arg][0] == '-' && argv[arg][1] != '\0') {
+      scan_usage();
+      return 2;
+    } else if (scan_add_path(&pool, argv[arg], 1) != 0) {
+      return 2;
+    }
+  }
+
+  if (pool.file_count == 0) {
+    scan_usage();
+    return 2;
+  }
+  if (pool.threads == 0) {
+    pool.threads = 1;
+  }
+  if (pool.threads > ScanMaxThreads) {
+    pool.threads = ScanMaxThreads;
+  }
+  if (pool.split_size == 0) {
+    pool.split_size = ScanDefaultSplitSize;
+  }
+  if (plan) {
+    int ret = scan_print_plans(&pool, pool.split_size);
+    for (i = 0; i < pool.file_count; i++) {
+      free(pool.files[i].path);
+    }
+    free(pool.files);
+    return ret;
+  }
+
+  pool.deques = calloc(pool.threads, sizeof(ScanDeque));
+  if (pool.deques == NULL) {
+    fprintf(stderr, "sxml-scan: %s\n", strerror(ENOMEM));
+    return 2;
+  }
+  for (i = 0; i < pool.threads; i++) {
+    pthread_mutex_init(&pool.deques[i].lock, NULL);
+  }
+  atomic_init(&pool.outstanding, pool.file_count);
+  for (i = 0; i < pool.file_count; i++) {
+    ScanTask task;
+    task.file = &pool.files[i];
+    task.begin = SIZE_MAX;
+    task.end = SIZE_MAX;
+    atomic_init(&pool.files[i].pending, 1);
+    if (scan_deque_push(&pool.deques[i % pool.threads], task) != 0) {
+      fprintf(stderr, "sxml-scan: %s: %s\n", task.file->path, strerror(ENOMEM));
+      return 2;
+    }
+  }
+
+  started = scan_now_ns();
+  for (i = 0; i < pool.threads; i++) {
+    workers[i].pool = &pool;
+    workers[i].self = (unsigned int)i;
+    if ((err = pthread_create(&tids[i], NULL, scan_worker, &workers[i])) != 0) {
+      fprintf(stderr, "sxml-scan: cannot start worker thread: %s\n", strerror(err));
+      break;
+    }
+  }
+  // Workers already running steal the queues of those that did not start
+  for (started_threads = i, i = 0; i < started_threads; i++) {
+    pthread_join(tids[i], NULL);
+  }
+  if (started_threads == 0) {
+    return 1;
+  }
+  elapsed = scan_now_ns() - started;
+
+  if (!quiet) {
+    printf("%-40s %12s %10s %10s %10s %8s %12s  %s\n",
+           "file", "bytes", "tags", "attrs", "contents", "comments", "MB/s", "status");
+  }
+  for (i = 0; i < pool.file_count; i++) {
+    ScanFile* file = &pool.files[i];
+    const char* status = file->io_errno ? strerror(file->io_errno) : scan_status_name(atomic_load(&file->status));
+    if (file->io_errno || atomic_load(&file->status) != SXMLExplorerComplete) {
+      errors++;
+    }
+    total_bytes += file->size;
+    total_tags += atomic_load(&file->tags);
+    total_attributes += atomic_load(&file->attributes);
+    total_contents += atomic_load(&file->contents);
+    total_comments += atomic_load(&file->comments);
+    if (!quiet) {
+      printf("%-40s %12zu %10llu %10llu %10llu %8llu %12.2f  %s\n",
+             file->path, file->size,
+             atomic_load(&file->tags), atomic_load(&file->attributes),
+             atomic_load(&file->contents), atomic_load(&file->comments),
+             scan_rate(file->size, atomic_load(&file->busy_ns)) / 1e6, status);
+    }
+  }
+
+  printf("total: %zu files, %llu bytes, %llu tags, %llu attrs, %llu contents, %llu comments, "
+         "%u errors, %.3f s, %.2f MB/s on %u threads\n",
+         pool.file_count, total_bytes, total_tags, total_attributes, total_contents, total_comments,
+         errors, (double)elapsed / 1e9, scan_rate(total_bytes, elapsed) / 1e6, pool.threads);
+
+  for (i = 0; i < pool.threads; i++) {
+    pthread_mutex_destroy(&pool.deques[i].lock);
+    free(pool.deques[i].tasks);
+  }
+  for (i = 0; i < pool.file_count; i++) {
+    free(pool.files[i].path);
+    free(pool.files[i].data);
+  }
+  free(pool.deques);
+  free(pool.files);
+  return errors > 0 || started_threads < pool.threads ? 1 : 0;
+}